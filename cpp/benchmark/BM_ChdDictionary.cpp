@@ -213,6 +213,56 @@ namespace dnv::vista::sdk::benchmarks
 		state.counters["HashRate"] = benchmark::Counter( state.iterations(), benchmark::Counter::kIsRate );
 	}
 
+	//=====================================================================
+	// Construction benchmarks - by key count
+	//=====================================================================
+
+	/* Tag-like keys, e.g. "tag-000042/C101.31" */
+	static std::vector<std::pair<std::string, int>> constructionItems( size_t count )
+	{
+		std::vector<std::pair<std::string, int>> items;
+		items.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			items.emplace_back( fmt::format( "tag-{:06}/C{}.{}", i, i % 997, i % 31 ), static_cast<int>( i ) );
+		}
+
+		return items;
+	}
+
+	static void constructDictionary( benchmark::State& state, ChdConstructionMode mode, size_t threadCount = 0 )
+	{
+		const auto items = constructionItems( static_cast<size_t>( state.range( 0 ) ) );
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto copy = items;
+			state.ResumeTiming();
+
+			ChdDictionary<int> dictionary( std::move( copy ), mode, threadCount );
+			benchmark::DoNotOptimize( dictionary );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * items.size() ) );
+	}
+
+	static void BM_construct_Sequential( benchmark::State& state )
+	{
+		constructDictionary( state, ChdConstructionMode::Sequential );
+	}
+
+	static void BM_construct_Parallel( benchmark::State& state )
+	{
+		constructDictionary( state, ChdConstructionMode::Parallel );
+	}
+
+	/* Fixed thread count, so that the speculative seed search also runs on machines with few cores */
+	static void BM_construct_Parallel_4Threads( benchmark::State& state )
+	{
+		constructDictionary( state, ChdConstructionMode::Parallel, 4 );
+	}
+
 	//=====================================================================
 	// Benchmark registrations
 	//=====================================================================
@@ -252,6 +302,11 @@ namespace dnv::vista::sdk::benchmarks
 	/* Comparative benchmarks */
 	BENCHMARK( BM_hash_BenchmarkTriple )->MinTime( 5.0 )->Unit( benchmark::kNanosecond );
 	BENCHMARK( BM_hash_Distribution )->MinTime( 3.0 )->Unit( benchmark::kNanosecond );
+
+	/* Construction time versus key count */
+	BENCHMARK( BM_construct_Sequential )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Iterations( 5 )->Unit( benchmark::kMillisecond );
+	BENCHMARK( BM_construct_Parallel )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Iterations( 5 )->Unit( benchmark::kMillisecond );
+	BENCHMARK( BM_construct_Parallel_4Threads )->RangeMultiplier( 4 )->Range( 1 << 10, 1 << 18 )->Iterations( 5 )->Unit( benchmark::kMillisecond );
 }
 
 BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 
 #include "dnv/vista/sdk/Gmod.h"
 #include "dnv/vista/sdk/GmodDto.h"
+#include "dnv/vista/sdk/GmodSnapshot.h"
 #include "dnv/vista/sdk/VIS.h"
 
 using namespace dnv::vista::sdk;
@@ -35,6 +36,59 @@ namespace dnv::vista::sdk::benchmarks
 	BENCHMARK( BM_gmodLoad )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kMillisecond );
+
+	static void BM_gmodDtoParseDom( benchmark::State& state )
+	{
+		const std::string text = VIS::instance().gmodDto( VisVersion::v3_7a ).toJson().dump();
+
+		for ( auto _ : state )
+		{
+			auto dto = GmodDto::tryFromJson( nlohmann::json::parse( text ) );
+
+			benchmark::DoNotOptimize( dto );
+		}
+	}
+
+	BENCHMARK( BM_gmodDtoParseDom )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
+
+	static void BM_gmodDtoParseSax( benchmark::State& state )
+	{
+		const std::string text = VIS::instance().gmodDto( VisVersion::v3_7a ).toJson().dump();
+
+		for ( auto _ : state )
+		{
+			auto dto = GmodDto::tryParse( text );
+
+			benchmark::DoNotOptimize( dto );
+		}
+	}
+
+	BENCHMARK( BM_gmodDtoParseSax )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
+
+	static void BM_gmodSnapshotLoad( benchmark::State& state )
+	{
+		const auto path = std::filesystem::temp_directory_path() / GmodSnapshot::fileName( VisVersion::v3_7a );
+		GmodSnapshot::write( VIS::instance().gmod( VisVersion::v3_7a ), path );
+
+		for ( auto _ : state )
+		{
+			auto snapshot = GmodSnapshot::open( path );
+			auto gmod = std::make_unique<Gmod>( snapshot );
+
+			benchmark::DoNotOptimize( gmod );
+		}
+
+		std::error_code ec;
+		std::filesystem::remove( path, ec );
+	}
+
+	BENCHMARK( BM_gmodSnapshotLoad )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
 }
 
 BENCHMARK_MAIN();
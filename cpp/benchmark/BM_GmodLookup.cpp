@@ -6,6 +6,7 @@
 #include "pch.h"
 
 #include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/StringInterner.h"
 #include "dnv/vista/sdk/VIS.h"
 
 using namespace dnv::vista::sdk;
@@ -14,6 +15,9 @@ namespace dnv::vista::sdk::benchmarks
 {
 	static std::unordered_map<std::string, const GmodNode*> g_dict;
 	static std::unordered_map<std::string, const GmodNode*> g_frozenDict;
+	static std::vector<std::string_view> g_allCodes;
+	static std::vector<std::string> g_missingCodes;
+	static std::vector<uint32_t> g_allCodeIds;
 	static const Gmod* g_gmod = nullptr;
 	static bool g_initialized = false;
 
@@ -33,7 +37,24 @@ namespace dnv::vista::sdk::benchmarks
 				const auto& node = enumerator.current();
 				g_dict[node.code()] = &node;
 				g_frozenDict[node.code()] = &node;
+				g_allCodes.push_back( node.code() );
 			}
+
+			/* Visit codes in a fixed random order so that lookups do not follow table layout */
+			std::mt19937 rng( 42 );
+			std::shuffle( g_allCodes.begin(), g_allCodes.end(), rng );
+
+			for ( const auto code : g_allCodes )
+			{
+				g_allCodeIds.push_back( StringInterner::instance().intern( code ) );
+			}
+
+			/* Near misses: same shape as real codes, but never present */
+			for ( const auto code : g_allCodes )
+			{
+				g_missingCodes.push_back( std::string{ code } + "9" );
+			}
+
 			g_initialized = true;
 		}
 	}
@@ -115,6 +136,126 @@ namespace dnv::vista::sdk::benchmarks
 		}
 	}
 
+	static void BM_gmodBatched( benchmark::State& state )
+	{
+		initializeData();
+
+		const std::array<std::string_view, 4> codes{ "VE", "400a", "400", "H346.11112" };
+		std::array<const GmodNode*, 4> nodes{};
+
+		for ( auto _ : state )
+		{
+			bool result = g_gmod->tryGetNodes( codes, nodes ) == codes.size();
+
+			benchmark::DoNotOptimize( result );
+			benchmark::DoNotOptimize( nodes );
+		}
+	}
+
+	static void BM_gmodAllCodes( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const auto code : g_allCodes )
+			{
+				const GmodNode* node;
+				found += g_gmod->tryGetNode( code, node ) ? 1 : 0;
+			}
+
+			benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_allCodes.size() ) );
+	}
+
+	static void BM_gmodAllCodeIds( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const auto codeId : g_allCodeIds )
+			{
+				const GmodNode* node;
+				found += g_gmod->tryGetNode( codeId, node ) ? 1 : 0;
+			}
+
+			benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_allCodeIds.size() ) );
+	}
+
+	static void BM_gmodMissingCodes( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( const auto& code : g_missingCodes )
+			{
+				const GmodNode* node;
+				found += g_gmod->tryGetNode( code, node ) ? 1 : 0;
+			}
+
+			benchmark::DoNotOptimize( found );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_missingCodes.size() ) );
+	}
+
+	static void BM_gmodAllCodesBatched( benchmark::State& state )
+	{
+		initializeData();
+
+		std::vector<const GmodNode*> nodes( g_allCodes.size() );
+
+		for ( auto _ : state )
+		{
+			size_t found = g_gmod->tryGetNodes( g_allCodes, nodes );
+
+			benchmark::DoNotOptimize( found );
+			benchmark::DoNotOptimize( nodes.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_allCodes.size() ) );
+	}
+
+	static void BM_nodeWithLocation( benchmark::State& state )
+	{
+		initializeData();
+
+		const GmodNode& node = ( *g_gmod )["C101.31"];
+		const Location location{ "1" };
+
+		for ( auto _ : state )
+		{
+			GmodNode located = node.withLocation( location );
+
+			benchmark::DoNotOptimize( located );
+		}
+	}
+
+	static void BM_nodeLocated( benchmark::State& state )
+	{
+		initializeData();
+
+		const GmodNode& node = ( *g_gmod )["C101.31"];
+		const std::optional<Location> location{ Location{ "1" } };
+
+		for ( auto _ : state )
+		{
+			GmodLocatedNode located = node.located( location );
+
+			benchmark::DoNotOptimize( located );
+		}
+	}
+
 	BENCHMARK( BM_dict )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kNanosecond );
@@ -126,6 +267,34 @@ namespace dnv::vista::sdk::benchmarks
 	BENCHMARK( BM_gmod )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_gmodBatched )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_gmodAllCodes )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_gmodAllCodeIds )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_gmodMissingCodes )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_gmodAllCodesBatched )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_nodeWithLocation )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_nodeLocated )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kNanosecond );
 }
 
 BENCHMARK_MAIN();
@@ -6,6 +6,7 @@
 #include "pch.h"
 
 #include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/GmodPathCache.h"
 #include "dnv/vista/sdk/VIS.h"
 
 using namespace dnv::vista::sdk;
@@ -139,6 +140,36 @@ namespace dnv::vista::sdk::benchmarks
 #endif
 	}
 
+	static void BM_tryParseCached( benchmark::State& state )
+	{
+		initializeData();
+
+		GmodPathCache cache;
+
+		for ( auto _ : state )
+		{
+			std::shared_ptr<const GmodPath> outPath;
+			bool result = cache.tryParse( "411.1/C101.72/I101", *g_gmod, *g_locations, outPath );
+
+			benchmark::DoNotOptimize( result );
+			benchmark::DoNotOptimize( outPath );
+		}
+	}
+
+	static void BM_copyIndividualized( benchmark::State& state )
+	{
+		initializeData();
+
+		const GmodPath path = GmodPath::parse( "612.21-1/C701.13/S93", *g_gmod, *g_locations );
+
+		for ( auto _ : state )
+		{
+			GmodPath copy = path;
+
+			benchmark::DoNotOptimize( copy );
+		}
+	}
+
 	BENCHMARK( BM_tryParse )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kMicrosecond );
@@ -154,6 +185,14 @@ namespace dnv::vista::sdk::benchmarks
 	BENCHMARK( BM_tryParseFullPathIndividualized )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_tryParseCached )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_copyIndividualized )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
 }
 
 BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+/**
+ * @file BM_GmodPathParseMany.cpp
+ * @brief Bulk GMOD path parsing throughput over the items of testdata/LocalIds.txt
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/VIS.h"
+
+using namespace dnv::vista::sdk;
+
+namespace dnv::vista::sdk::benchmarks
+{
+	static const Gmod* g_gmod = nullptr;
+	static const Locations* g_locations = nullptr;
+	static std::vector<std::string> g_paths;
+	static std::vector<std::string_view> g_items;
+	static bool g_initialized = false;
+
+	/* Primary and secondary items of the 3-4a LocalIds, repeated up to a file of typical size */
+	static void initializeData()
+	{
+		if ( g_initialized )
+		{
+			return;
+		}
+
+		auto& vis = VIS::instance();
+		g_gmod = &vis.gmod( VisVersion::v3_4a );
+		g_locations = &vis.locations( VisVersion::v3_4a );
+
+		constexpr std::string_view prefix = "/dnv-v2/vis-3-4a/";
+		std::ifstream file( "testdata/LocalIds.txt" );
+		std::string line;
+		while ( std::getline( file, line ) )
+		{
+			std::string_view localId = line;
+			if ( !localId.starts_with( prefix ) )
+			{
+				continue;
+			}
+
+			localId.remove_prefix( prefix.size() );
+			localId = localId.substr( 0, localId.find( "/meta" ) );
+
+			size_t secondary = localId.find( "/sec/" );
+			g_paths.emplace_back( localId.substr( 0, secondary ) );
+			if ( secondary != std::string_view::npos )
+			{
+				g_paths.emplace_back( localId.substr( secondary + 5 ) );
+			}
+		}
+
+		if ( g_paths.empty() )
+		{
+			throw std::runtime_error( "BM_GmodPathParseMany: no 3-4a items found in testdata/LocalIds.txt" );
+		}
+
+		constexpr size_t itemCount = 100'000;
+		g_items.reserve( itemCount );
+		while ( g_items.size() < itemCount )
+		{
+			g_items.push_back( g_paths[g_items.size() % g_paths.size()] );
+		}
+
+		g_initialized = true;
+	}
+
+	static void BM_tryParseMany( benchmark::State& state )
+	{
+		initializeData();
+
+		GmodPathParseOptions options{};
+		options.threadCount = static_cast<size_t>( state.range( 0 ) );
+
+		for ( auto _ : state )
+		{
+			std::vector<GmodPathParseOutcome> outcomes = GmodPath::tryParseMany( g_items, *g_gmod, *g_locations, options );
+
+			benchmark::DoNotOptimize( outcomes );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_items.size() ) );
+	}
+
+	static void BM_tryParseLoop( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			size_t parsed = 0;
+			for ( std::string_view item : g_items )
+			{
+				std::optional<GmodPath> outPath;
+				parsed += GmodPath::tryParse( item, *g_gmod, *g_locations, outPath ) ? 1 : 0;
+			}
+
+			benchmark::DoNotOptimize( parsed );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * g_items.size() ) );
+	}
+
+	BENCHMARK( BM_tryParseLoop )
+		->Unit( benchmark::kMillisecond )
+		->UseRealTime();
+
+	BENCHMARK( BM_tryParseMany )
+		->RangeMultiplier( 2 )
+		->Range( 1, 16 )
+		->Unit( benchmark::kMillisecond )
+		->UseRealTime();
+}
+
+BENCHMARK_MAIN();
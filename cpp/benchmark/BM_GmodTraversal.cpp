@@ -13,6 +13,7 @@ using namespace dnv::vista::sdk;
 namespace dnv::vista::sdk::benchmarks
 {
 	static const Gmod* g_gmod = nullptr;
+	static const Gmod* g_latestGmod = nullptr;
 	static bool g_initialized = false;
 
 	static void initializeData()
@@ -21,6 +22,7 @@ namespace dnv::vista::sdk::benchmarks
 		{
 			auto& vis = VIS::instance();
 			g_gmod = &vis.gmod( VisVersion::v3_4a );
+			g_latestGmod = &vis.gmod( VisVersion::v3_8a );
 			g_initialized = true;
 		}
 	}
@@ -51,9 +53,86 @@ namespace dnv::vista::sdk::benchmarks
 		}
 	}
 
+	static void BM_fullTraversalInlined( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			int nodeCount = 0;
+
+			bool result = dnv::vista::sdk::GmodTraversal::traverse(
+				*g_gmod, [&nodeCount]( const std::vector<const GmodNode*>&, const GmodNode& ) {
+					++nodeCount;
+					return TraversalHandlerResult::Continue;
+				} );
+
+			benchmark::DoNotOptimize( result );
+			benchmark::DoNotOptimize( nodeCount );
+		}
+	}
+
+	static void BM_pathsView( benchmark::State& state )
+	{
+		initializeData();
+
+		for ( auto _ : state )
+		{
+			int nodeCount = 0;
+
+			for ( const GmodTraversal::TraversalPath path : GmodTraversal::paths( *g_gmod ) )
+			{
+				benchmark::DoNotOptimize( path.node );
+				++nodeCount;
+			}
+
+			benchmark::DoNotOptimize( nodeCount );
+		}
+	}
+
+	static void BM_fullTraversalParallel( benchmark::State& state )
+	{
+		initializeData();
+
+		ParallelTraversalOptions options;
+		options.threadCount = static_cast<size_t>( state.range( 0 ) );
+
+		for ( auto _ : state )
+		{
+			size_t nodeCount = 0;
+
+			bool result = dnv::vista::sdk::GmodTraversal::traverseParallel(
+				nodeCount, *g_latestGmod,
+				[]( size_t& count, const std::vector<const GmodNode*>&, const GmodNode& ) {
+					++count;
+					return TraversalHandlerResult::Continue;
+				},
+				[]( size_t& count, size_t&& workerCount ) { count += workerCount; },
+				options );
+
+			benchmark::DoNotOptimize( result );
+			benchmark::DoNotOptimize( nodeCount );
+		}
+	}
+
 	BENCHMARK( BM_fullTraversal )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kMillisecond );
+
+	BENCHMARK( BM_fullTraversalInlined )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
+
+	BENCHMARK( BM_pathsView )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
+
+	BENCHMARK( BM_fullTraversalParallel )
+		->RangeMultiplier( 2 )
+		->Range( 1, 16 )
+		->UseRealTime()
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMillisecond );
 }
 
 BENCHMARK_MAIN();
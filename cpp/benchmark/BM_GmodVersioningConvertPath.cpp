@@ -15,6 +15,8 @@ namespace dnv::vista::sdk::benchmarks
 {
 	static const Gmod* g_gmod = nullptr;
 	static GmodPath g_gmodPath;
+	static GmodPath g_reconstructedPath;
+	static GmodPath g_locatedReconstructedPath;
 	static bool g_initialized = false;
 
 	static void initializeData()
@@ -31,6 +33,10 @@ namespace dnv::vista::sdk::benchmarks
 			}
 
 			g_gmodPath = std::move( parsedPath.value() );
+
+			/* Converted to "511.31/C121.31/C221": the mapped nodes do not form a path and are reconstructed */
+			g_reconstructedPath = g_gmod->parsePath( "511.331/C221" );
+			g_locatedReconstructedPath = g_gmod->parsePath( "1012.21/C1147.221/C1051.7/C101.61/S203.2-1/S101" );
 			g_initialized = true;
 		}
 	}
@@ -53,6 +59,84 @@ namespace dnv::vista::sdk::benchmarks
 			benchmark::DoNotOptimize( result );
 		}
 
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_end;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_end, sizeof( pmc_end ) );
+		auto memoryDelta = static_cast<double>( pmc_end.WorkingSetSize - initialMemory );
+		state.counters["MemoryDeltaKB"] = benchmark::Counter( memoryDelta / 1024.0 );
+#endif
+	}
+
+	static void BM_convertPathAcrossVersions( benchmark::State& state )
+	{
+		initializeData();
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_start;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_start, sizeof( pmc_start ) );
+		size_t initialMemory = pmc_start.WorkingSetSize;
+#endif
+
+		auto& vis = VIS::instance();
+
+		for ( auto _ : state )
+		{
+			auto result = vis.convertPath( VisVersion::v3_4a, g_gmodPath, VisVersion::v3_8a );
+			benchmark::DoNotOptimize( result );
+		}
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_end;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_end, sizeof( pmc_end ) );
+		auto memoryDelta = static_cast<double>( pmc_end.WorkingSetSize - initialMemory );
+		state.counters["MemoryDeltaKB"] = benchmark::Counter( memoryDelta / 1024.0 );
+#endif
+	}
+
+	static void BM_convertPathReconstructed( benchmark::State& state )
+	{
+		initializeData();
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_start;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_start, sizeof( pmc_start ) );
+		size_t initialMemory = pmc_start.WorkingSetSize;
+#endif
+
+		auto& vis = VIS::instance();
+
+		for ( auto _ : state )
+		{
+			auto result = vis.convertPath( VisVersion::v3_4a, g_reconstructedPath, VisVersion::v3_6a );
+			benchmark::DoNotOptimize( result );
+		}
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_end;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_end, sizeof( pmc_end ) );
+		auto memoryDelta = static_cast<double>( pmc_end.WorkingSetSize - initialMemory );
+		state.counters["MemoryDeltaKB"] = benchmark::Counter( memoryDelta / 1024.0 );
+#endif
+	}
+
+	static void BM_convertPathReconstructedWithLocation( benchmark::State& state )
+	{
+		initializeData();
+
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS_EX pmc_start;
+		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_start, sizeof( pmc_start ) );
+		size_t initialMemory = pmc_start.WorkingSetSize;
+#endif
+
+		auto& vis = VIS::instance();
+
+		for ( auto _ : state )
+		{
+			auto result = vis.convertPath( VisVersion::v3_4a, g_locatedReconstructedPath, VisVersion::v3_6a );
+			benchmark::DoNotOptimize( result );
+		}
+
 #ifdef _WIN32
 		PROCESS_MEMORY_COUNTERS_EX pmc_end;
 		GetProcessMemoryInfo( GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&pmc_end, sizeof( pmc_end ) );
@@ -64,6 +148,18 @@ namespace dnv::vista::sdk::benchmarks
 	BENCHMARK( BM_convertPath )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_convertPathAcrossVersions )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_convertPathReconstructed )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
+
+	BENCHMARK( BM_convertPathReconstructedWithLocation )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kMicrosecond );
 }
 
 BENCHMARK_MAIN();
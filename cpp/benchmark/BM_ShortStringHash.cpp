@@ -61,6 +61,21 @@ namespace dnv::vista::sdk::benchmarks
 		}
 	};
 
+	/* Key of the requested length, cycling through characters typical of GMOD codes */
+	static std::string keyOfLength( size_t length )
+	{
+		constexpr std::string_view alphabet = "H346.11112C101.31-2";
+
+		std::string key;
+		key.reserve( length );
+		for ( size_t i = 0; i < length; ++i )
+		{
+			key.push_back( alphabet[i % alphabet.size()] );
+		}
+
+		return key;
+	}
+
 	static uint32_t hashCodeOrdinal( std::string_view str )
 	{
 		const char* data = str.data();
@@ -235,6 +250,58 @@ namespace dnv::vista::sdk::benchmarks
 		}
 	}
 
+	static void BM_crc32Wide_400( benchmark::State& state )
+	{
+		initializeData();
+
+		const std::string input = "400";
+		for ( auto _ : state )
+		{
+			auto result = ChdDictionary<int>::hash( input );
+			benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_crc32Wide_H346_11112( benchmark::State& state )
+	{
+		initializeData();
+
+		const std::string input = "H346.11112";
+		for ( auto _ : state )
+		{
+			auto result = ChdDictionary<int>::hash( input );
+			benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_crc32Intrinsic_Length( benchmark::State& state )
+	{
+		initializeData();
+
+		const std::string input = keyOfLength( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			/* Keeps the hash of the unchanged key from being hoisted out of the loop */
+			benchmark::DoNotOptimize( input );
+			auto result = hash<CRC32IntrinsicHasher>( input );
+			benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_crc32Wide_Length( benchmark::State& state )
+	{
+		initializeData();
+
+		const std::string input = keyOfLength( static_cast<size_t>( state.range( 0 ) ) );
+		for ( auto _ : state )
+		{
+			/* Keeps the hash of the unchanged key from being hoisted out of the loop */
+			benchmark::DoNotOptimize( input );
+			auto result = ChdDictionary<int>::hash( input );
+			benchmark::DoNotOptimize( result );
+		}
+	}
+
 	BENCHMARK( BM_bcl_400 )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kNanosecond );
@@ -267,6 +334,36 @@ namespace dnv::vista::sdk::benchmarks
 		->MinTime( 10.0 )
 		->Unit( benchmark::kNanosecond );
 
+	BENCHMARK( BM_crc32Wide_400 )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_crc32Wide_H346_11112 )
+		->MinTime( 10.0 )
+		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_crc32Intrinsic_Length )
+		->Arg( 2 )
+		->Arg( 3 )
+		->Arg( 4 )
+		->Arg( 7 )
+		->Arg( 10 )
+		->Arg( 16 )
+		->Arg( 32 )
+		->MinTime( 2.0 )
+		->Unit( benchmark::kNanosecond );
+
+	BENCHMARK( BM_crc32Wide_Length )
+		->Arg( 2 )
+		->Arg( 3 )
+		->Arg( 4 )
+		->Arg( 7 )
+		->Arg( 10 )
+		->Arg( 16 )
+		->Arg( 32 )
+		->MinTime( 2.0 )
+		->Unit( benchmark::kNanosecond );
+
 	BENCHMARK( BM_fnv_400 )
 		->MinTime( 10.0 )
 		->Unit( benchmark::kNanosecond );
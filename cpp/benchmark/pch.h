@@ -9,9 +9,20 @@
 #endif
 
 /* STL */
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <list>
 #include <mutex>
+#include <random>
+#include <ranges>
 #include <shared_mutex>
+#include <span>
+#include <thread>
 #include <unordered_set>
 
 /* Libs */
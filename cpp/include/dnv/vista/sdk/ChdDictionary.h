@@ -162,6 +162,35 @@ namespace dnv::vista::sdk
 			 */
 			[[nodiscard]] inline static uint32_t crc32( uint32_t hash, uint8_t ch ) noexcept;
 
+			/**
+			 * @brief Computes the CRC32 of one character followed by a zero high byte in a single step.
+			 * @details Equivalent to `crc32( crc32( hash, ch ), 0 )`, using one 16-bit CRC instruction.
+			 * @param[in] hash The current hash value.
+			 * @param[in] ch The character (byte) to incorporate into the hash.
+			 * @return The updated hash value.
+			 * @note Requires SSE4.2 support. Use hasSSE42Support() to check availability.
+			 */
+			[[nodiscard]] inline static uint32_t crc32Char( uint32_t hash, uint8_t ch ) noexcept;
+
+			/**
+			 * @brief Computes the CRC32 of a 4-character chunk followed by four zero high bytes in a single step.
+			 * @details Equivalent to feeding the four chunk bytes, then four zero bytes, through `crc32()`.
+			 *          The zero padding is the zero extension of the chunk to 64 bits, so one 64-bit CRC
+			 *          instruction replaces eight dependent 8-bit ones (two 32-bit ones on 32-bit targets).
+			 * @param[in] hash The current hash value.
+			 * @param[in] chunk The four characters, loaded little-endian.
+			 * @return The updated hash value.
+			 * @note Requires SSE4.2 support. Use hasSSE42Support() to check availability.
+			 */
+			[[nodiscard]] inline static uint32_t crc32Chunk( uint32_t hash, uint32_t chunk ) noexcept;
+
+			/**
+			 * @brief Loads four characters as a little-endian 32-bit chunk for `crc32Chunk()`.
+			 * @param[in] data Pointer to at least four characters.
+			 * @return The chunk value.
+			 */
+			[[nodiscard]] inline static uint32_t loadChunk( const char* data ) noexcept;
+
 			/**
 			 * @brief Computes the final table index using the seed mixing function for the CHD algorithm.
 			 * @param[in] seed The seed value associated with the hash bucket.
@@ -213,6 +242,23 @@ namespace dnv::vista::sdk
 		explicit invalid_operation_exception( std::string_view message );
 	};
 
+	//=====================================================================
+	// ChdConstructionMode enumeration
+	//=====================================================================
+
+	/**
+	 * @brief Selects how the ChdDictionary constructor searches bucket seeds.
+	 * @details Both modes produce the identical table and seed layout.
+	 */
+	enum class ChdConstructionMode
+	{
+		/** @brief Single-threaded construction. */
+		Sequential = 0,
+
+		/** @brief Hashing and seed search spread over the hardware threads; small inputs fall back to sequential. */
+		Parallel
+	};
+
 	//=====================================================================
 	// ChdDictionary class
 	//=====================================================================
@@ -229,6 +275,17 @@ namespace dnv::vista::sdk
 	 * needs to be queried frequently and efficiently. It includes optimizations like
 	 * optional SSE4.2 hashing and thread-local caching.
 	 *
+	 * Lookups run against a compact index kept apart from the values: a dense array of 32-bit
+	 * fingerprints (the primary hash of the key in each slot) and the keys packed into one
+	 * contiguous blob addressed by 32-bit offsets. A lookup compares the fingerprint first, so a
+	 * missing key is almost always rejected without touching a key or a value; the value array,
+	 * whose elements may be large (e.g. GmodNode), is only accessed once the key has matched.
+	 *
+	 * The values themselves are not split from their keys: `m_table` still stores
+	 * `std::pair<std::string, TValue>` slots, because Iterator and Enumerator hand out references
+	 * to those pairs and the construction paths build and move them as pairs. The key strings in
+	 * `m_table` are therefore cold copies; only the index above is read before a match.
+	 *
 	 * @tparam TValue The type of values stored in the dictionary.
 	 *
 	 * @warning **UTF-16 Compatibility Note:**
@@ -260,12 +317,57 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Constructs the dictionary from a vector of key-value pairs.
+		 * @details Keys whose full hash equals an earlier key's cannot be separated by any seed;
+		 *          they are stored in free slots outside of the perfect hash and found by a linear scan.
 		 * @param[in] items A vector of key-value pairs. The keys must be unique.
 		 * @throws std::invalid_argument if duplicate keys are found.
 		 * @throws std::runtime_error if perfect hash construction fails.
 		 */
 		explicit ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items );
 
+		/**
+		 * @brief Constructs the dictionary from a vector of key-value pairs using the given construction mode.
+		 * @details In parallel mode, the seeds of consecutive buckets are searched speculatively and
+		 *          concurrently against the slot occupancy at the start of each window of buckets,
+		 *          then committed in bucket order. A speculative seed is the smallest one valid for a
+		 *          subset of the final occupancy, so it is kept when its slots are still free and the
+		 *          search otherwise resumes right after it: the result is identical to sequential
+		 *          construction. Keys whose full hash equals an earlier key's are stored in free
+		 *          slots outside of the perfect hash and found by a linear scan.
+		 * @param[in] items A vector of key-value pairs. The keys must be unique.
+		 * @param[in] mode The construction mode.
+		 * @param[in] threadCount Number of threads for parallel mode; 0 uses the hardware concurrency.
+		 * @throws std::invalid_argument if duplicate keys are found.
+		 * @throws std::runtime_error if perfect hash construction fails.
+		 */
+		ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items, ChdConstructionMode mode, size_t threadCount = 0 );
+
+		/**
+		 * @brief Restores the dictionary from a previously computed table layout.
+		 * @details Skips the bucket sort and seed search entirely. The table must be in the
+		 *          exact slot order produced by a previous construction (empty slots carry an
+		 *          empty key), and `seeds` must be the matching seed table. The layout is
+		 *          validated by resolving every stored key through the seed table once.
+		 * @param[in] table The slot-ordered key-value pairs, including empty slots.
+		 * @param[in] seeds The CHD seed table. Must have the same size as `table`.
+		 * @throws std::invalid_argument if the table size is not a power of 2, the sizes differ,
+		 *         or a key does not resolve to its own slot.
+		 */
+		ChdDictionary( std::vector<std::pair<std::string, TValue>>&& table, std::vector<int>&& seeds );
+
+		/**
+		 * @brief Constructs the dictionary from unordered items and a precomputed seed table.
+		 * @details Skips the bucket sort and seed search entirely: each item is placed in the slot
+		 *          its key resolves to through `seeds`, which is typically produced offline by the
+		 *          CHD seed builder tool (see `ChdSeedTable`). Any seed table that maps the keys to
+		 *          distinct slots is accepted.
+		 * @param[in] items A vector of key-value pairs, in any order. The keys must be unique.
+		 * @param[in] seeds The precomputed CHD seed table. Its size is the table size.
+		 * @throws std::invalid_argument if duplicate keys are found, the seed table size is not a
+		 *         power of 2 or is smaller than the item count, or it maps two keys to the same slot.
+		 */
+		ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items, std::span<const int> seeds );
+
 		/** @brief Default constructor */
 		ChdDictionary() = default;
 
@@ -329,6 +431,14 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] inline size_t size() const noexcept;
 
+		/**
+		 * @brief Returns the CHD seed table.
+		 * @details One entry per table slot. Together with the slot order exposed through
+		 *          `Iterator::index()`, this fully describes the perfect hash layout.
+		 * @return A constant reference to the seed table.
+		 */
+		[[nodiscard]] inline const std::vector<int>& seeds() const noexcept;
+
 		//----------------------------------------------
 		// State inspection methods
 		//----------------------------------------------
@@ -355,6 +465,21 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] inline bool tryGetValue( std::string_view key, const TValue*& outValue ) const;
 
+		/**
+		 * @brief Looks up several keys at once.
+		 * @details Keys are processed in groups of `LOOKUP_BATCH_SIZE`: the hashes of a group are
+		 *          computed in lockstep so that the CRC dependency chains of different keys overlap,
+		 *          then the seed slots of the whole group are prefetched, resolved to table slots,
+		 *          which are prefetched in turn before the keys are compared. Results are identical
+		 *          to calling `tryGetValue()` for every key.
+		 * @param[in] keys The keys to look up.
+		 * @param[out] outValues Receives, for each key, a pointer to its value or `nullptr` if the key
+		 *                       is not present. Must have the same size as `keys`.
+		 * @return The number of keys found.
+		 * @throws std::invalid_argument if `outValues` and `keys` differ in size.
+		 */
+		inline size_t tryGetValues( std::span<const std::string_view> keys, std::span<const TValue*> outValues ) const;
+
 		//----------------------------------------------
 		// Iteration
 		//----------------------------------------------
@@ -395,7 +520,10 @@ namespace dnv::vista::sdk
 		/**
 		 * @brief Calculates hash value using hardware-accelerated CRC32 or software FNV-1a fallback.
 		 * @details Two-path implementation:
-		 *   - **SSE4.2 Path:** Uses _mm_crc32_u64 for 4-character chunks (3-5x faster)
+		 *   - **SSE4.2 Path:** One _mm_crc32_u64 per 4-character chunk (the chunk zero-extended to
+		 *     64 bits supplies the four zero high bytes) and one _mm_crc32_u16 per trailing character.
+		 *     Produces the same value as feeding every byte and zero high byte through _mm_crc32_u8,
+		 *     with a dependency chain 8x shorter for chunks and 2x shorter for the tail.
 		 *   - **Fallback Path:** Uses FNV-1a algorithm for compatibility
 		 *   Both paths simulate UTF-16 processing for C# compatibility.
 		 * @param[in] key ASCII string key to hash
@@ -403,7 +531,70 @@ namespace dnv::vista::sdk
 		 */
 		static inline uint32_t hash( std::string_view key ) noexcept;
 
+		//---------------------------
+		// Constants
+		//---------------------------
+
+		/** @brief Number of keys hashed and resolved together by `tryGetValues()`. */
+		static constexpr size_t LOOKUP_BATCH_SIZE{ 8 };
+
+		/** @brief Item count below which `ChdConstructionMode::Parallel` builds sequentially. */
+		static constexpr size_t PARALLEL_CONSTRUCTION_THRESHOLD{ 4096 };
+
 	private:
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Hashes up to `LOOKUP_BATCH_SIZE` keys with their CRC32 chains interleaved.
+		 * @details Produces exactly the values of `hash()` for every key.
+		 * @param[in] keys The keys to hash.
+		 * @param[out] hashes Receives one hash per key.
+		 */
+		static inline void hashBatch( std::span<const std::string_view> keys, uint32_t* hashes ) noexcept;
+
+		/** @brief One key of a hash bucket: item index + 1 and primary hash. */
+		using BucketEntry = std::pair<unsigned int, uint32_t>;
+
+		/**
+		 * @brief Finds the smallest seed that places every key of a bucket in a distinct free slot.
+		 * @param[in] bucket The keys of the bucket.
+		 * @param[in] indices Slot occupancy; non-zero entries are taken.
+		 * @param[in] firstSeed The first seed to try; smaller seeds are known to be invalid.
+		 * @param[in] bucketIndex The bucket position, for error reporting.
+		 * @param[out] slots Receives the slot of each key for the returned seed.
+		 * @return The seed.
+		 * @throws std::runtime_error if the seed search exceeds its threshold.
+		 */
+		static inline uint32_t findBucketSeed(
+			std::span<const BucketEntry> bucket, const std::vector<unsigned int>& indices,
+			uint32_t firstSeed, size_t bucketIndex, std::vector<uint32_t>& slots );
+
+		/**
+		 * @brief Builds the fingerprint and key blob lookup index from `m_table`.
+		 * @details Called once at the end of every constructor, after the slot order is final.
+		 * @throws std::length_error if the keys do not fit in a blob addressable by 32-bit offsets.
+		 */
+		inline void buildLookupIndex();
+
+		/**
+		 * @brief Checks whether a slot holds the given key, using the lookup index only.
+		 * @param[in] slot The table slot the key resolved to.
+		 * @param[in] key The non-empty key.
+		 * @param[in] hashValue The primary hash of `key`.
+		 * @return `true` if the slot holds `key`.
+		 */
+		[[nodiscard]] inline bool slotMatches( size_t slot, std::string_view key, uint32_t hashValue ) const noexcept;
+
+		/**
+		 * @brief Finds a key among the slots of full-hash collisions.
+		 * @param[in] key The key to find.
+		 * @param[in] hashValue The primary hash of `key`.
+		 * @return The slot holding `key`, or the table size if it is not a collision slot.
+		 */
+		[[nodiscard]] inline size_t findCollisionSlot( std::string_view key, uint32_t hashValue ) const noexcept;
+
 		//----------------------------------------------
 		// Private member variables
 		//----------------------------------------------
@@ -414,6 +605,18 @@ namespace dnv::vista::sdk
 		/** @brief The seed values used by the CHD perfect hash function to resolve hash collisions. Size matches `m_table`. */
 		std::vector<int> m_seeds;
 
+		/** @brief Primary hash of the key stored in each slot (0 for empty slots). Size matches `m_table`. */
+		std::vector<uint32_t> m_fingerprints;
+
+		/** @brief Offsets of each slot's key in `m_keyBlob`; slot `i` spans `[m_keyOffsets[i], m_keyOffsets[i + 1])`. */
+		std::vector<uint32_t> m_keyOffsets;
+
+		/** @brief All keys concatenated in slot order. */
+		std::string m_keyBlob;
+
+		/** @brief Slots of keys whose full hash equals another key's, so they are not stored where the seeds resolve them. */
+		std::vector<uint32_t> m_collisionSlots;
+
 	public:
 		//----------------------------------------------
 		// ChdDictionary::Iterator class
@@ -515,6 +718,12 @@ namespace dnv::vista::sdk
 			 */
 			inline Iterator operator++( int );
 
+			/**
+			 * @brief Gets the table slot the iterator is positioned on.
+			 * @return The slot index within the dictionary's internal table.
+			 */
+			[[nodiscard]] inline size_t index() const noexcept;
+
 			//---------------------------
 			// Comparison
 			//---------------------------
@@ -73,6 +73,28 @@ namespace dnv::vista::sdk
 			return _mm_crc32_u8( hash, ch );
 		}
 
+		inline uint32_t Hashing::crc32Char( uint32_t hash, uint8_t ch ) noexcept
+		{
+			return _mm_crc32_u16( hash, ch );
+		}
+
+		inline uint32_t Hashing::crc32Chunk( uint32_t hash, uint32_t chunk ) noexcept
+		{
+#if defined( _M_X64 ) || defined( __x86_64__ )
+			return static_cast<uint32_t>( _mm_crc32_u64( hash, chunk ) );
+#else
+			return _mm_crc32_u32( _mm_crc32_u32( hash, chunk ), 0 );
+#endif
+		}
+
+		inline uint32_t Hashing::loadChunk( const char* data ) noexcept
+		{
+			uint32_t chunk;
+			std::memcpy( &chunk, data, sizeof( chunk ) );
+
+			return chunk;
+		}
+
 		inline constexpr uint32_t Hashing::seed( uint32_t seed, uint32_t hash, size_t size ) noexcept
 		{
 			/* Mixes the primary hash with the seed to find the final table slot */
@@ -101,8 +123,18 @@ namespace dnv::vista::sdk
 
 	template <typename TValue>
 	inline ChdDictionary<TValue>::ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items )
+		: ChdDictionary{ std::move( items ), ChdConstructionMode::Sequential }
+	{
+	}
+
+	template <typename TValue>
+	inline ChdDictionary<TValue>::ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items, ChdConstructionMode mode, size_t threadCount )
 		: m_table{},
-		  m_seeds{}
+		  m_seeds{},
+		  m_fingerprints{},
+		  m_keyOffsets{},
+		  m_keyBlob{},
+		  m_collisionSlots{}
 	{
 		if ( items.empty() )
 		{
@@ -117,21 +149,66 @@ namespace dnv::vista::sdk
 		}
 		size *= 2;
 
+		const size_t workerCount{ mode == ChdConstructionMode::Parallel && items.size() >= PARALLEL_CONSTRUCTION_THRESHOLD
+									  ? ( threadCount != 0 ? threadCount : std::max<size_t>( 1, std::thread::hardware_concurrency() ) )
+									  : 1 };
+
+		/* Runs task( worker ) on workerCount threads (the calling thread is worker 0) */
+		auto runWorkers = [workerCount]( auto&& task ) {
+			std::vector<std::future<void>> futures;
+			futures.reserve( workerCount - 1 );
+			for ( size_t worker{ 1 }; worker < workerCount; ++worker )
+			{
+				futures.push_back( std::async( std::launch::async, [&task, worker]() { task( worker ); } ) );
+			}
+
+			task( 0 );
+
+			for ( auto& future : futures )
+			{
+				future.get();
+			}
+		};
+
 		m_table.reserve( size );
 		m_seeds.reserve( size );
 
-		auto hashBuckets{ std::vector<std::vector<std::pair<unsigned, uint32_t>>>( size ) };
+		auto hashes{ std::vector<uint32_t>( items.size() ) };
+		runWorkers( [&]( size_t worker ) {
+			const size_t chunk{ ( items.size() + workerCount - 1 ) / workerCount };
+			const size_t last{ std::min( items.size(), ( worker + 1 ) * chunk ) };
+			for ( size_t i{ worker * chunk }; i < last; ++i )
+			{
+				hashes[i] = hash( items[i].first );
+			}
+		} );
+
+		auto hashBuckets{ std::vector<std::vector<BucketEntry>>( size ) };
 		for ( auto& bucket : hashBuckets )
 		{
 			bucket.reserve( 4 );
 		}
 
+		/* Keys sharing their full 32-bit hash with an earlier key land in the same slot for every seed */
+		std::vector<size_t> colliders;
 		for ( size_t i{ 0 }; i < items.size(); ++i )
 		{
-			const auto& key{ items[i].first };
-			uint32_t hashValue{ hash( key ) };
-			auto bucketForItemIdx{ hashValue & ( size - 1 ) };
-			hashBuckets[bucketForItemIdx].emplace_back( static_cast<unsigned int>( i + 1 ), hashValue );
+			uint32_t hashValue{ hashes[i] };
+			auto& bucket{ hashBuckets[hashValue & ( size - 1 )] };
+
+			const auto sameHash{ std::find_if( bucket.begin(), bucket.end(), [hashValue]( const BucketEntry& entry ) { return entry.second == hashValue; } ) };
+			if ( sameHash != bucket.end() ) [[unlikely]]
+			{
+				if ( items[sameHash->first - 1].first == items[i].first )
+				{
+					throw std::invalid_argument( fmt::format( "Duplicate key '{}'", items[i].first ) );
+				}
+
+				colliders.push_back( i );
+				continue;
+			}
+
+			bucket.emplace_back( static_cast<unsigned int>( i + 1 ), hashValue );
 		}
 
 		std::sort( hashBuckets.begin(), hashBuckets.end(), []( const auto& a, const auto& b ) {
@@ -142,58 +219,80 @@ namespace dnv::vista::sdk
 		auto indices{ std::vector<unsigned int>( size, 0 ) };
 		auto seeds{ std::vector<int>( size, 0 ) };
 
-		size_t currentBucketIdx{ 0 };
-		for ( ; currentBucketIdx < hashBuckets.size() && hashBuckets[currentBucketIdx].size() > 1; ++currentBucketIdx )
+		size_t multiItemBucketCount{ 0 };
+		while ( multiItemBucketCount < hashBuckets.size() && hashBuckets[multiItemBucketCount].size() > 1 )
 		{
-			const auto& subKeys{ hashBuckets[currentBucketIdx] };
-			auto entries{ std::unordered_map<size_t, unsigned>() };
-			entries.reserve( subKeys.size() );
-			uint32_t currentSeedValue{ 0 };
+			++multiItemBucketCount;
+		}
 
-			while ( true )
+		/* Claims the slots found for a bucket and records its seed */
+		auto commitBucket = [&]( size_t bucketIdx, uint32_t seed, const std::vector<uint32_t>& slots ) {
+			const auto& subKeys{ hashBuckets[bucketIdx] };
+			for ( size_t k{ 0 }; k < subKeys.size(); ++k )
 			{
-				++currentSeedValue;
-				entries.clear();
-				bool seedValid{ true };
+				indices[slots[k]] = subKeys[k].first;
+			}
+			seeds[subKeys[0].second & ( size - 1 )] = static_cast<int>( seed );
+		};
 
-				for ( const auto& k : subKeys )
+		std::vector<uint32_t> slots;
+		if ( workerCount == 1 )
+		{
+			for ( size_t bucketIdx{ 0 }; bucketIdx < multiItemBucketCount; ++bucketIdx )
+			{
+				const uint32_t seed{ findBucketSeed( hashBuckets[bucketIdx], indices, 1, bucketIdx, slots ) };
+				commitBucket( bucketIdx, seed, slots );
+			}
+		}
+		else
+		{
+			/*
+			 * Speculate the seeds of a window of buckets concurrently against the occupancy at the
+			 * start of the window, then commit them in bucket order. Occupancy only grows, so a seed
+			 * below the speculated one stays invalid: the speculated seed is kept if its slots are
+			 * still free, and the search resumes after it otherwise.
+			 */
+			const size_t windowSize{ workerCount * 32 };
+			auto candidates{ std::vector<uint32_t>( windowSize ) };
+			auto candidateSlots{ std::vector<std::vector<uint32_t>>( windowSize ) };
+
+			for ( size_t windowStart{ 0 }; windowStart < multiItemBucketCount; windowStart += windowSize )
+			{
+				const size_t windowCount{ std::min( windowSize, multiItemBucketCount - windowStart ) };
+
+				runWorkers( [&]( size_t worker ) {
+					for ( size_t w{ worker }; w < windowCount; w += workerCount )
+					{
+						candidates[w] = findBucketSeed(
+							hashBuckets[windowStart + w], indices, 1, windowStart + w, candidateSlots[w] );
+					}
+				} );
+
+				for ( size_t w{ 0 }; w < windowCount; ++w )
 				{
-					/* Calculate final position using secondary hash with current seed */
-					auto finalHash{ internal::Hashing::seed( currentSeedValue, k.second, size ) };
-					bool slotOccupied = indices[finalHash] != 0;
-					bool entryClaimedThisTry = entries.count( finalHash ) != 0;
+					const size_t bucketIdx{ windowStart + w };
 
-					if ( !slotOccupied && !entryClaimedThisTry )
+					bool stillFree{ true };
+					for ( const uint32_t slot : candidateSlots[w] )
 					{
-						entries[finalHash] = k.first;
+						stillFree = stillFree && indices[slot] == 0;
+					}
+
+					if ( stillFree )
+					{
+						commitBucket( bucketIdx, candidates[w], candidateSlots[w] );
 					}
 					else
 					{
-						seedValid = false;
-						break;
+						const uint32_t seed{ findBucketSeed( hashBuckets[bucketIdx], indices, candidates[w] + 1, bucketIdx, slots ) };
+						commitBucket( bucketIdx, seed, slots );
 					}
 				}
-
-				if ( seedValid )
-				{
-					break;
-				}
-
-				if ( currentSeedValue > size * MAX_SEED_SEARCH_MULTIPLIER )
-				{
-					throw std::runtime_error( fmt::format(
-						"Bucket {}: Seed search exceeded threshold ({}), aborting construction!",
-						currentBucketIdx, currentSeedValue ) );
-				}
 			}
-
-			for ( const auto& [finalHash, itemIdx] : entries )
-			{
-				indices[finalHash] = itemIdx;
-			}
-			seeds[subKeys[0].second & ( size - 1 )] = static_cast<int>( currentSeedValue );
 		}
 
+		size_t currentBucketIdx{ multiItemBucketCount };
+
 		/* Resizes m_table to 'size' elements, initializing new slots with an empty string key and a value copied from the first input item. */
 		m_table.resize( size, { std::string(), items[0].second } );
 
@@ -225,7 +324,158 @@ namespace dnv::vista::sdk
 			seeds[k.second & ( size - 1 )] = -static_cast<int>( slotIndexInMTable + 1 );
 		}
 
+		/* Full-hash collisions take the next free slots and are found through m_collisionSlots */
+		for ( const size_t itemIndex : colliders )
+		{
+			m_table[freeSlots[freeSlotsIndex++]] = std::move( items[itemIndex] );
+		}
+
+		m_seeds = std::move( seeds );
+
+		buildLookupIndex();
+	}
+
+	template <typename TValue>
+	inline ChdDictionary<TValue>::ChdDictionary( std::vector<std::pair<std::string, TValue>>&& table, std::vector<int>&& seeds )
+		: m_table{},
+		  m_seeds{},
+		  m_fingerprints{},
+		  m_keyOffsets{},
+		  m_keyBlob{},
+		  m_collisionSlots{}
+	{
+		if ( table.empty() && seeds.empty() )
+		{
+			return;
+		}
+
+		const size_t size{ table.size() };
+		if ( seeds.size() != size )
+		{
+			throw std::invalid_argument( fmt::format(
+				"Seed table size ({}) does not match table size ({})", seeds.size(), size ) );
+		}
+
+		if ( ( size & ( size - 1 ) ) != 0 )
+		{
+			throw std::invalid_argument( fmt::format( "Table size ({}) is not a power of 2", size ) );
+		}
+
+		for ( size_t slot{ 0 }; slot < size; ++slot )
+		{
+			const auto& key{ table[slot].first };
+			if ( key.empty() )
+			{
+				continue;
+			}
+
+			/* Resolve the key exactly like tryGetValue() does */
+			const uint32_t hashValue{ hash( key ) };
+			const int seed{ seeds[hashValue & ( size - 1 )] };
+			const size_t finalIndex{ seed < 0
+										 ? static_cast<size_t>( -seed - 1 )
+										 : internal::Hashing::seed( static_cast<uint32_t>( seed ), hashValue, size ) };
+
+			/* A key stored elsewhere is only valid as a full-hash collision of the key in its own slot */
+			if ( finalIndex != slot &&
+				 ( finalIndex >= size || table[finalIndex].first.empty() || hash( table[finalIndex].first ) != hashValue ) )
+			{
+				throw std::invalid_argument( fmt::format(
+					"Key '{}' resolves to slot {} but is stored in slot {}", key, finalIndex, slot ) );
+			}
+		}
+
+		m_table = std::move( table );
 		m_seeds = std::move( seeds );
+
+		buildLookupIndex();
+	}
+
+	template <typename TValue>
+	inline ChdDictionary<TValue>::ChdDictionary( std::vector<std::pair<std::string, TValue>>&& items, std::span<const int> seeds )
+		: m_table{},
+		  m_seeds{},
+		  m_fingerprints{},
+		  m_keyOffsets{},
+		  m_keyBlob{},
+		  m_collisionSlots{}
+	{
+		if ( items.empty() )
+		{
+			return;
+		}
+
+		const size_t size{ seeds.size() };
+		if ( size == 0 || ( size & ( size - 1 ) ) != 0 )
+		{
+			throw std::invalid_argument( fmt::format( "Seed table size ({}) is not a power of 2", size ) );
+		}
+
+		if ( size < items.size() )
+		{
+			throw std::invalid_argument( fmt::format(
+				"Seed table size ({}) is smaller than the item count ({})", size, items.size() ) );
+		}
+
+		/* Resolve every key exactly like tryGetValue() does; slot owners are stored as index + 1 */
+		auto indices{ std::vector<uint32_t>( size, 0 ) };
+		std::vector<size_t> colliders;
+		for ( size_t i{ 0 }; i < items.size(); ++i )
+		{
+			const uint32_t hashValue{ hash( items[i].first ) };
+			const int seed{ seeds[hashValue & ( size - 1 )] };
+			const size_t finalIndex{ seed < 0
+										 ? static_cast<size_t>( -static_cast<int64_t>( seed ) - 1 )
+										 : internal::Hashing::seed( static_cast<uint32_t>( seed ), hashValue, size ) };
+
+			if ( finalIndex >= size )
+			{
+				throw std::invalid_argument( fmt::format(
+					"Key '{}' resolves to slot {} outside of the table", items[i].first, finalIndex ) );
+			}
+
+			/* Duplicates resolve like the key they repeat, so they are told apart before any layout error */
+			if ( indices[finalIndex] != 0 && hash( items[indices[finalIndex] - 1].first ) == hashValue ) [[unlikely]]
+			{
+				const auto isDuplicate = [&]( size_t other ) { return items[other].first == items[i].first; };
+				if ( isDuplicate( indices[finalIndex] - 1 ) || std::any_of( colliders.begin(), colliders.end(), isDuplicate ) )
+				{
+					throw std::invalid_argument( fmt::format( "Duplicate key '{}'", items[i].first ) );
+				}
+
+				colliders.push_back( i );
+				continue;
+			}
+
+			if ( indices[finalIndex] != 0 )
+			{
+				throw std::invalid_argument( fmt::format(
+					"Keys '{}' and '{}' resolve to the same slot {}",
+					items[indices[finalIndex] - 1].first, items[i].first, finalIndex ) );
+			}
+
+			indices[finalIndex] = static_cast<uint32_t>( i + 1 );
+		}
+
+		/* Empty slots get an empty key and a copy of the first value, as in the seed-searching constructor */
+		m_table.resize( size, { std::string(), items[0].second } );
+		auto nextCollider{ colliders.begin() };
+		for ( size_t slot{ 0 }; slot < size; ++slot )
+		{
+			if ( indices[slot] != 0 )
+			{
+				m_table[slot] = std::move( items[indices[slot] - 1] );
+			}
+			else if ( nextCollider != colliders.end() )
+			{
+				/* Full-hash collisions take free slots and are found through m_collisionSlots */
+				m_table[slot] = std::move( items[*nextCollider++] );
+			}
+		}
+
+		m_seeds.assign( seeds.begin(), seeds.end() );
+
+		buildLookupIndex();
 	}
 
 	//----------------------------------------------
@@ -280,6 +530,12 @@ namespace dnv::vista::sdk
 		return m_table.size();
 	}
 
+	template <typename TValue>
+	inline const std::vector<int>& ChdDictionary<TValue>::seeds() const noexcept
+	{
+		return m_seeds;
+	}
+
 	//----------------------------------------------
 	// State inspection methods
 	//----------------------------------------------
@@ -329,18 +585,97 @@ namespace dnv::vista::sdk
 			finalIndex = finalHash;
 		}
 
-		const auto& kvp = m_table[finalIndex];
-
-		if ( key.size() == kvp.first.size() && std::memcmp( key.data(), kvp.first.data(), key.size() ) == 0 ) [[likely]]
+		if ( slotMatches( finalIndex, key, hashValue ) ) [[likely]]
 		{
-			outValue = &kvp.second;
+			outValue = &m_table[finalIndex].second;
 
 			return true;
 		}
 
+		if ( !m_collisionSlots.empty() && m_fingerprints[finalIndex] == hashValue ) [[unlikely]]
+		{
+			finalIndex = findCollisionSlot( key, hashValue );
+			if ( finalIndex < tableSize )
+			{
+				outValue = &m_table[finalIndex].second;
+
+				return true;
+			}
+		}
+
 		return false;
 	}
 
+	template <typename TValue>
+	inline size_t ChdDictionary<TValue>::tryGetValues( std::span<const std::string_view> keys, std::span<const TValue*> outValues ) const
+	{
+		if ( outValues.size() != keys.size() )
+		{
+			throw std::invalid_argument( fmt::format(
+				"Output span size ({}) does not match key count ({})", outValues.size(), keys.size() ) );
+		}
+
+		if ( m_table.empty() ) [[unlikely]]
+		{
+			std::fill( outValues.begin(), outValues.end(), nullptr );
+
+			return 0;
+		}
+
+		const size_t tableSize{ m_table.size() };
+		size_t found{ 0 };
+
+		std::array<uint32_t, LOOKUP_BATCH_SIZE> hashes;
+		std::array<size_t, LOOKUP_BATCH_SIZE> slots;
+
+		for ( size_t offset{ 0 }; offset < keys.size(); offset += LOOKUP_BATCH_SIZE )
+		{
+			const size_t count{ std::min( LOOKUP_BATCH_SIZE, keys.size() - offset ) };
+			const auto batch{ keys.subspan( offset, count ) };
+
+			/* Stage 1: interleaved hashing, then prefetch every seed slot of the batch */
+			hashBatch( batch, hashes.data() );
+			for ( size_t k{ 0 }; k < count; ++k )
+			{
+				_mm_prefetch( reinterpret_cast<const char*>( &m_seeds[hashes[k] & ( tableSize - 1 )] ), _MM_HINT_T0 );
+			}
+
+			/* Stage 2: resolve seeds to table slots, then prefetch their fingerprints */
+			for ( size_t k{ 0 }; k < count; ++k )
+			{
+				const int seed{ m_seeds[hashes[k] & ( tableSize - 1 )] };
+				slots[k] = seed < 0
+							   ? static_cast<size_t>( -seed - 1 )
+							   : internal::Hashing::seed( static_cast<uint32_t>( seed ), hashes[k], tableSize );
+				_mm_prefetch( reinterpret_cast<const char*>( &m_fingerprints[slots[k]] ), _MM_HINT_T0 );
+			}
+
+			/* Stage 3: compare fingerprints, then keys; values are only touched on a match */
+			for ( size_t k{ 0 }; k < count; ++k )
+			{
+				const auto& key{ batch[k] };
+
+				if ( !key.empty() && slotMatches( slots[k], key, hashes[k] ) )
+				{
+					outValues[offset + k] = &m_table[slots[k]].second;
+					++found;
+				}
+				else if ( !key.empty() && !m_collisionSlots.empty() && m_fingerprints[slots[k]] == hashes[k] ) [[unlikely]]
+				{
+					const size_t slot{ findCollisionSlot( key, hashes[k] ) };
+					outValues[offset + k] = slot < tableSize ? &m_table[slot].second : nullptr;
+					found += slot < tableSize ? 1 : 0;
+				}
+				else
+				{
+					outValues[offset + k] = nullptr;
+				}
+			}
+		}
+
+		return found;
+	}
+
 	//----------------------------------------------
 	// Iteration
 	//----------------------------------------------
@@ -402,17 +737,8 @@ namespace dnv::vista::sdk
 
 			while ( length >= 4 )
 			{
-				/* Process 4 low bytes at once */
-				hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( data[0] ) );
-				hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( data[1] ) );
-				hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( data[2] ) );
-				hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( data[3] ) );
-
-				/* Process 4 high bytes (UTF-16 simulation - all zeros for ASCII) */
-				hashValue = internal::Hashing::crc32( hashValue, 0 );
-				hashValue = internal::Hashing::crc32( hashValue, 0 );
-				hashValue = internal::Hashing::crc32( hashValue, 0 );
-				hashValue = internal::Hashing::crc32( hashValue, 0 );
+				/* 4 low bytes followed by 4 high bytes (UTF-16 simulation - all zeros for ASCII) */
+				hashValue = internal::Hashing::crc32Chunk( hashValue, internal::Hashing::loadChunk( data ) );
 
 				data += 4;
 				length -= 4;
@@ -420,9 +746,8 @@ namespace dnv::vista::sdk
 
 			for ( size_t i = 0; i < length; ++i )
 			{
-				hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( data[i] ) );
-				/* UTF-16 high byte */
-				hashValue = internal::Hashing::crc32( hashValue, 0 );
+				/* Low byte followed by the UTF-16 high byte */
+				hashValue = internal::Hashing::crc32Char( hashValue, static_cast<uint8_t>( data[i] ) );
 			}
 		}
 		else
@@ -437,6 +762,175 @@ namespace dnv::vista::sdk
 		return hashValue;
 	}
 
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
+
+	template <typename TValue>
+	inline void ChdDictionary<TValue>::hashBatch( std::span<const std::string_view> keys, uint32_t* hashes ) noexcept
+	{
+		static bool hasSSE42 = internal::hasSSE42Support();
+
+		if ( !hasSSE42 )
+		{
+			for ( size_t k{ 0 }; k < keys.size(); ++k )
+			{
+				hashes[k] = hash( keys[k] );
+			}
+
+			return;
+		}
+
+		size_t maxLength{ 0 };
+		for ( size_t k{ 0 }; k < keys.size(); ++k )
+		{
+			hashes[k] = internal::FNV_OFFSET_BASIS;
+			maxLength = std::max( maxLength, keys[k].size() );
+		}
+
+		/* Same byte sequence as hash(), advanced one 4-character chunk per key per round */
+		for ( size_t position{ 0 }; position + 4 <= maxLength; position += 4 )
+		{
+			for ( size_t k{ 0 }; k < keys.size(); ++k )
+			{
+				if ( position + 4 <= keys[k].size() )
+				{
+					hashes[k] = internal::Hashing::crc32Chunk( hashes[k], internal::Hashing::loadChunk( keys[k].data() + position ) );
+				}
+			}
+		}
+
+		for ( size_t k{ 0 }; k < keys.size(); ++k )
+		{
+			const size_t length{ keys[k].size() };
+			for ( size_t i{ length & ~static_cast<size_t>( 3 ) }; i < length; ++i )
+			{
+				hashes[k] = internal::Hashing::crc32Char( hashes[k], static_cast<uint8_t>( keys[k][i] ) );
+			}
+		}
+	}
+
+	//---------------------------
+	// Construction
+	//---------------------------
+
+	template <typename TValue>
+	inline uint32_t ChdDictionary<TValue>::findBucketSeed(
+		std::span<const BucketEntry> bucket, const std::vector<unsigned int>& indices,
+		uint32_t firstSeed, size_t bucketIndex, std::vector<uint32_t>& slots )
+	{
+		const size_t size{ indices.size() };
+		slots.resize( bucket.size() );
+
+		for ( uint32_t currentSeedValue{ firstSeed };; ++currentSeedValue )
+		{
+			bool seedValid{ true };
+			for ( size_t k{ 0 }; k < bucket.size() && seedValid; ++k )
+			{
+				/* Calculate final position using secondary hash with current seed */
+				slots[k] = internal::Hashing::seed( currentSeedValue, bucket[k].second, size );
+				seedValid = indices[slots[k]] == 0;
+
+				/* Buckets hold a handful of keys: a linear scan beats a set */
+				for ( size_t l{ 0 }; l < k && seedValid; ++l )
+				{
+					seedValid = slots[l] != slots[k];
+				}
+			}
+
+			if ( seedValid )
+			{
+				return currentSeedValue;
+			}
+
+			if ( currentSeedValue > size * MAX_SEED_SEARCH_MULTIPLIER )
+			{
+				throw std::runtime_error( fmt::format(
+					"Bucket {}: Seed search exceeded threshold ({}), aborting construction!",
+					bucketIndex, currentSeedValue ) );
+			}
+		}
+	}
+
+	//---------------------------
+	// Lookup index
+	//---------------------------
+
+	template <typename TValue>
+	inline void ChdDictionary<TValue>::buildLookupIndex()
+	{
+		const size_t size{ m_table.size() };
+
+		size_t blobSize{ 0 };
+		for ( const auto& [key, value] : m_table )
+		{
+			blobSize += key.size();
+		}
+
+		if ( blobSize > std::numeric_limits<uint32_t>::max() )
+		{
+			throw std::length_error( fmt::format( "Key blob size ({}) exceeds 32-bit offsets", blobSize ) );
+		}
+
+		m_fingerprints.assign( size, 0 );
+		m_keyOffsets.resize( size + 1 );
+		m_keyBlob.clear();
+		m_keyBlob.reserve( blobSize );
+		m_collisionSlots.clear();
+
+		for ( size_t slot{ 0 }; slot < size; ++slot )
+		{
+			const auto& key{ m_table[slot].first };
+
+			m_keyOffsets[slot] = static_cast<uint32_t>( m_keyBlob.size() );
+			if ( !key.empty() )
+			{
+				const uint32_t hashValue{ hash( key ) };
+				m_fingerprints[slot] = hashValue;
+				m_keyBlob.append( key );
+
+				const int seed{ m_seeds[hashValue & ( size - 1 )] };
+				const size_t resolvedSlot{ seed < 0
+											   ? static_cast<size_t>( -seed - 1 )
+											   : internal::Hashing::seed( static_cast<uint32_t>( seed ), hashValue, size ) };
+				if ( resolvedSlot != slot ) [[unlikely]]
+				{
+					m_collisionSlots.push_back( static_cast<uint32_t>( slot ) );
+				}
+			}
+		}
+		m_keyOffsets[size] = static_cast<uint32_t>( m_keyBlob.size() );
+	}
+
+	template <typename TValue>
+	inline bool ChdDictionary<TValue>::slotMatches( size_t slot, std::string_view key, uint32_t hashValue ) const noexcept
+	{
+		/* Empty slots have an empty key, so a fingerprint collision there still fails the length check */
+		if ( m_fingerprints[slot] != hashValue )
+		{
+			return false;
+		}
+
+		const uint32_t begin{ m_keyOffsets[slot] };
+		const uint32_t length{ m_keyOffsets[slot + 1] - begin };
+
+		return key.size() == length && std::memcmp( key.data(), m_keyBlob.data() + begin, length ) == 0;
+	}
+
+	template <typename TValue>
+	inline size_t ChdDictionary<TValue>::findCollisionSlot( std::string_view key, uint32_t hashValue ) const noexcept
+	{
+		for ( const uint32_t slot : m_collisionSlots )
+		{
+			if ( slotMatches( slot, key, hashValue ) )
+			{
+				return slot;
+			}
+		}
+
+		return m_table.size();
+	}
+
 	//----------------------------------------------
 	// ChdDictionary::Iterator class
 	//----------------------------------------------
@@ -511,6 +1005,12 @@ namespace dnv::vista::sdk
 		return tmp;
 	}
 
+	template <typename TValue>
+	inline size_t ChdDictionary<TValue>::Iterator::index() const noexcept
+	{
+		return m_index;
+	}
+
 	//---------------------------
 	// Comparison
 	//---------------------------
@@ -0,0 +1,93 @@
+/**
+ * @file ChdSeedTable.h
+ * @brief Precomputed CHD seed table files.
+ * @details This file defines the ChdSeedTable class, which reads and writes the seed tables
+ *          produced offline for the embedded resources. Constructing a ChdDictionary from a
+ *          precomputed seed table replaces the bucket sort and seed search with a single
+ *          validating placement pass.
+ */
+
+#pragma once
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// ChdSeedTable class
+	//=====================================================================
+
+	/**
+	 * @brief Reader and writer for precomputed CHD seed table files.
+	 * @details File layout (little-endian):
+	 *          - `char[8]`   magic "VISCHD\0\0"
+	 *          - `uint32_t`  format version
+	 *          - `uint32_t`  item count the seeds were computed for
+	 *          - `uint32_t`  table size (number of seeds, power of 2)
+	 *          - `uint32_t`  CRC-32 of the seed array
+	 *          - `int32_t[]` seeds
+	 */
+	class ChdSeedTable final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Current seed table format version. Files with a different version are rejected. */
+		static constexpr uint32_t FORMAT_VERSION{ 1 };
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		/** @brief Default constructor. */
+		ChdSeedTable() = delete;
+
+		/** @brief Copy constructor */
+		ChdSeedTable( const ChdSeedTable& ) = delete;
+
+		/** @brief Move constructor */
+		ChdSeedTable( ChdSeedTable&& ) noexcept = delete;
+
+		/** @brief Destructor */
+		~ChdSeedTable() = delete;
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		ChdSeedTable& operator=( const ChdSeedTable& ) = delete;
+
+		/** @brief Move assignment operator */
+		ChdSeedTable& operator=( ChdSeedTable&& ) noexcept = delete;
+
+		//----------------------------------------------
+		// Static methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Writes a seed table file.
+		 * @param path Destination path. An existing file is replaced.
+		 * @param seeds The CHD seed table, e.g. `ChdDictionary::seeds()`.
+		 * @param itemCount The number of keys the seeds were computed for.
+		 * @throws std::runtime_error If the file cannot be written.
+		 */
+		static void write( const std::filesystem::path& path, std::span<const int> seeds, size_t itemCount );
+
+		/**
+		 * @brief Reads and verifies a seed table file without throwing.
+		 * @param path Path of the seed table file.
+		 * @param expectedItemCount The number of keys the caller is about to insert.
+		 * @param[out] seeds Receives the seed table on success; left empty otherwise.
+		 * @return True if a well-formed table for `expectedItemCount` keys was read, false otherwise.
+		 */
+		static bool tryRead( const std::filesystem::path& path, size_t expectedItemCount, std::vector<int>& seeds ) noexcept;
+
+		/**
+		 * @brief Gets the conventional seed table file name for a resource.
+		 * @param baseName The resource name without extension, e.g. "gmod-vis-3-4a".
+		 * @return The file name, e.g. "gmod-vis-3-4a.chd".
+		 */
+		[[nodiscard]] static std::string fileName( std::string_view baseName );
+	};
+}
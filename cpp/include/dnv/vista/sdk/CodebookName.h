@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "StaticChdDictionary.h"
+
 namespace dnv::vista::sdk
 {
 	//=====================================================================
@@ -27,7 +27,7 @@ namespace dnv::vista::sdk
 		// Enum mapping tables
 		//=====================================================================
 
-		static const std::unordered_map<std::string_view, CodebookName> s_prefixMap{
+		static constexpr StaticChdDictionary<CodebookName, 11> s_prefixMap{ { {
 			{ POSITION_PREFIX, CodebookName::Position },
 			{ QUANTITY_PREFIX, CodebookName::Quantity },
 			{ CALCULATION_PREFIX, CodebookName::Calculation },
@@ -38,7 +38,7 @@ namespace dnv::vista::sdk
 			{ FUNCTIONAL_SERVICES_PREFIX, CodebookName::FunctionalServices },
 			{ MAINTENANCE_CATEGORY_PREFIX, CodebookName::MaintenanceCategory },
 			{ ACTIVITY_TYPE_PREFIX, CodebookName::ActivityType },
-			{ DETAIL_PREFIX, CodebookName::Detail } };
+			{ DETAIL_PREFIX, CodebookName::Detail } } } };
 	}
 
 	//=====================================================================
@@ -56,10 +56,9 @@ namespace dnv::vista::sdk
 			throw std::invalid_argument( "Prefix cannot be empty." );
 		}
 
-		const auto it = s_prefixMap.find( prefix );
-		if ( it != s_prefixMap.end() ) [[likely]]
+		if ( const CodebookName* name = s_prefixMap.find( prefix ) ) [[likely]]
 		{
-			return it->second;
+			return *name;
 		}
 
 		throw std::invalid_argument( "Unknown prefix: " + std::string( prefix ) );
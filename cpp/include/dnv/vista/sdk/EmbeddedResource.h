@@ -107,6 +107,17 @@ namespace dnv::vista::sdk
 		 */
 		static std::optional<FormatDataTypesDto> formatDataTypes( const std::string& version );
 
+		/**
+		 * @brief Locate a resource file on disk
+		 *
+		 * Searches the same directories as the resource loaders, without opening the file.
+		 * Used for resources that are memory-mapped rather than streamed, such as GMOD snapshots.
+		 *
+		 * @param resourceName Resource file name
+		 * @return Path of the resource file if found, std::nullopt otherwise
+		 */
+		static std::optional<std::filesystem::path> resourcePath( const std::string& resourceName );
+
 	private:
 		//----------------------------------------------------------------------
 		// Resource access implementation
@@ -135,14 +146,15 @@ namespace dnv::vista::sdk
 		static std::shared_ptr<std::istream> stream( const std::string& resourceName );
 
 		/**
-		 * @brief Get decompressed stream for gzipped resource
+		 * @brief Get decompressed contents of gzipped resource
 		 *
-		 * Loads a gzipped resource and decompresses it using zlib.
+		 * Loads a gzipped resource and inflates it using zlib into a buffer
+		 * pre-sized from the uncompressed size in the gzip trailer.
 		 *
 		 * @param resourceName Compressed resource name
-		 * @return Shared pointer to input stream containing the decompressed data
+		 * @return The decompressed data
 		 * @throws std::runtime_error if decompression fails
 		 */
-		static std::shared_ptr<std::istream> decompressedStream( const std::string& resourceName );
+		static std::string decompressed( const std::string& resourceName );
 	};
 }
@@ -22,6 +22,387 @@ namespace dnv::vista::sdk
 	enum class VisVersion;
 	class GmodDto;
 	class GmodPath;
+	class GmodSnapshot;
+
+	namespace internal
+	{
+		//=====================================================================
+		// GmodGraph struct
+		//=====================================================================
+
+		/**
+		 * @brief Compressed sparse row (CSR) adjacency of a Gmod, built once at construction.
+		 * @details Nodes are numbered densely in node dictionary order. The children of node `i`
+		 *          are `children[childOffsets[i] .. childOffsets[i + 1])`, in GMOD order, and the
+		 *          same range of `childCodeIds` holds their code ids sorted for membership tests.
+		 *          Parents are stored the same way. Reachability labels let path resolution skip
+		 *          subtrees that cannot contain the node it searches. Every node owned by a Gmod
+		 *          knows its graph and index (`GmodNode::graph()`, `GmodNode::graphIndex()`).
+		 */
+		struct GmodGraph final
+		{
+			/** @brief Number of reachability labellings; more labellings reject more unreachable pairs. */
+			static constexpr size_t REACH_LABELLINGS{ 2 };
+
+			/** @brief Closed range of post-order numbers. */
+			struct ReachInterval
+			{
+				uint32_t low;
+				uint32_t high;
+			};
+
+			/** @brief Node of each index. */
+			std::vector<const GmodNode*> nodes;
+
+			/** @brief `GmodNodeFlags` bits of each node. */
+			std::vector<uint16_t> flags;
+
+			/** @brief Start of each node's range in `children` and `childCodeIds`; one entry per node plus one. */
+			std::vector<uint32_t> childOffsets;
+
+			/** @brief Child node indices, grouped by parent. */
+			std::vector<uint32_t> children;
+
+			/** @brief Child code ids, grouped by parent and sorted within each group. */
+			std::vector<uint32_t> childCodeIds;
+
+			/** @brief Start of each node's range in `parents`; one entry per node plus one. */
+			std::vector<uint32_t> parentOffsets;
+
+			/** @brief Parent node indices, grouped by child. */
+			std::vector<uint32_t> parents;
+
+			/** @brief Node index + 1 of each interned code id (0 if no node has the code). Sized to the largest code id + 1. */
+			std::vector<uint32_t> indicesByCodeId;
+
+			/**
+			 * @brief Reachability labels of each node, one interval per labelling.
+			 * @details Each labelling numbers the nodes in post-order of a depth-first search with a
+			 *          different child order; the interval of a node spans the numbers of every node
+			 *          reachable from it. A node can only reach nodes whose intervals it contains.
+			 */
+			std::vector<std::array<ReachInterval, REACH_LABELLINGS>> reach;
+
+			/**
+			 * @brief Gets the child indices of a node.
+			 * @param index The node index.
+			 * @return The child indices, in GMOD order.
+			 */
+			[[nodiscard]] inline std::span<const uint32_t> childrenOf( uint32_t index ) const noexcept;
+
+			/**
+			 * @brief Gets the parent indices of a node.
+			 * @param index The node index.
+			 * @return The parent indices.
+			 */
+			[[nodiscard]] inline std::span<const uint32_t> parentsOf( uint32_t index ) const noexcept;
+
+			/**
+			 * @brief Checks if a node has a direct child with a given code id.
+			 * @param index The node index.
+			 * @param codeId The interned code id of the potential child.
+			 * @return True if a direct child of node `index` has code id `codeId`, false otherwise.
+			 */
+			[[nodiscard]] inline bool isChild( uint32_t index, uint32_t codeId ) const noexcept;
+
+			/**
+			 * @brief Checks if a node may be reachable from another node through child relations.
+			 * @details Interval containment over every labelling in `reach`. A false answer is exact,
+			 *          a true answer may be a false positive, so this can only prune searches.
+			 * @param from The index of the starting node.
+			 * @param to The index of the node to reach.
+			 * @return False if `to` is certainly not `from` or reachable from it, true otherwise.
+			 */
+			[[nodiscard]] inline bool mayReach( uint32_t from, uint32_t to ) const noexcept;
+
+			/**
+			 * @brief Index-based equivalent of `Gmod::isProductSelectionAssignment()`.
+			 * @param parent The parent node index.
+			 * @param child The child node index.
+			 * @return True if it's a product selection assignment, false otherwise.
+			 */
+			[[nodiscard]] inline bool isProductSelectionAssignment( uint32_t parent, uint32_t child ) const noexcept;
+		};
+
+		//=====================================================================
+		// PathExistsIndex class
+		//=====================================================================
+
+		/**
+		 * @brief Memoized searches of `GmodTraversal::pathExistsBetween()` over a graph.
+		 * @details Keyed by (start node, target node) graph indices. Each entry lists the parent
+		 *          chains under which a traversal from the start node meets the target node, in
+		 *          traversal order, so a query only has to pick the first chain that extends its
+		 *          path. Entries are created on first request and never released before the index.
+		 *          Memory grows with the number of distinct pairs ever requested.
+		 */
+		class PathExistsIndex final
+		{
+		public:
+			//----------------------------------------------
+			// Constants
+			//----------------------------------------------
+
+			/** @brief Maximum number of parent chains kept per entry; later chains are searched again. */
+			static constexpr size_t MAX_CHAINS{ 64 };
+
+			//----------------------------------------------
+			// Entry struct
+			//----------------------------------------------
+
+			/** @brief Parent chains from a start node to a target node. */
+			struct Entry
+			{
+				/** @brief Ancestors of the start node, root first; empty if the start node is the root. */
+				std::vector<const GmodNode*> ancestors;
+
+				/** @brief Parents of each occurrence of the target node, start node first, concatenated. */
+				std::vector<const GmodNode*> chainNodes;
+
+				/** @brief Start of each chain in `chainNodes`; one entry per chain plus one. */
+				std::vector<uint32_t> chainOffsets{ 0 };
+
+				/** @brief Whether the traversal met the target node more than `MAX_CHAINS` times. */
+				bool truncated{ false };
+
+				/**
+				 * @brief Gets the number of chains.
+				 * @return The number of chains kept.
+				 */
+				[[nodiscard]] size_t chainCount() const noexcept { return chainOffsets.size() - 1; }
+
+				/**
+				 * @brief Gets a chain.
+				 * @param chain The chain number, less than `chainCount()`.
+				 * @return The parents of the target node, start node first.
+				 */
+				[[nodiscard]] std::span<const GmodNode* const> chain( size_t chain ) const noexcept
+				{
+					return std::span<const GmodNode* const>( chainNodes ).subspan( chainOffsets[chain], chainOffsets[chain + 1] - chainOffsets[chain] );
+				}
+			};
+
+			//----------------------------------------------
+			// Construction / destruction
+			//----------------------------------------------
+
+			/** @brief Default constructor. */
+			PathExistsIndex() = default;
+
+			/** @brief Copy constructor */
+			PathExistsIndex( const PathExistsIndex& ) = delete;
+
+			/** @brief Move constructor */
+			PathExistsIndex( PathExistsIndex&& ) noexcept = delete;
+
+			/** @brief Destructor */
+			~PathExistsIndex() = default;
+
+			//----------------------------------------------
+			// Assignment operators
+			//----------------------------------------------
+
+			/** @brief Copy assignment operator */
+			PathExistsIndex& operator=( const PathExistsIndex& ) = delete;
+
+			/** @brief Move assignment operator */
+			PathExistsIndex& operator=( PathExistsIndex&& ) noexcept = delete;
+
+			//----------------------------------------------
+			// Lookup
+			//----------------------------------------------
+
+			/**
+			 * @brief Gets the entry of a pair.
+			 * @param start The graph index of the start node.
+			 * @param target The graph index of the target node.
+			 * @return The entry, or `nullptr` if it has not been added yet.
+			 */
+			[[nodiscard]] const Entry* find( uint32_t start, uint32_t target ) const;
+
+			/**
+			 * @brief Adds the entry of a pair, unless another thread added it first.
+			 * @param start The graph index of the start node.
+			 * @param target The graph index of the target node.
+			 * @param entry The entry.
+			 * @return The entry held for the pair.
+			 */
+			const Entry& add( uint32_t start, uint32_t target, Entry&& entry );
+
+			/**
+			 * @brief Gets the number of entries held.
+			 * @return The number of distinct pairs added so far.
+			 */
+			[[nodiscard]] size_t size() const;
+
+		private:
+			//----------------------------------------------
+			// Private member variables
+			//----------------------------------------------
+
+			/** @brief Entries keyed by start index (high word) and target index (low word). */
+			std::unordered_map<uint64_t, std::unique_ptr<const Entry>> m_entries;
+
+			/** @brief Guards `m_entries`. */
+			mutable std::shared_mutex m_mutex;
+		};
+
+		//=====================================================================
+		// SubtreeStatistics class
+		//=====================================================================
+
+		/**
+		 * @brief Per-node sizes of the traversals of a graph, see `GmodTraversal::pathCount()`.
+		 * @details One table per maximum traversal occurrence, created on first request and never
+		 *          released before the statistics.
+		 */
+		class SubtreeStatistics final
+		{
+		public:
+			//----------------------------------------------
+			// Table struct
+			//----------------------------------------------
+
+			/** @brief Sizes of the traversal from each node, indexed by graph index. */
+			struct Table
+			{
+				/** @brief Number of nodes visited, the start node included. */
+				std::vector<uint64_t> pathCounts;
+
+				/** @brief Largest number of parents of a visited node. */
+				std::vector<uint32_t> maxDepths;
+			};
+
+			//----------------------------------------------
+			// Construction / destruction
+			//----------------------------------------------
+
+			/** @brief Default constructor. */
+			SubtreeStatistics() = default;
+
+			/** @brief Copy constructor */
+			SubtreeStatistics( const SubtreeStatistics& ) = delete;
+
+			/** @brief Move constructor */
+			SubtreeStatistics( SubtreeStatistics&& ) noexcept = delete;
+
+			/** @brief Destructor */
+			~SubtreeStatistics() = default;
+
+			//----------------------------------------------
+			// Assignment operators
+			//----------------------------------------------
+
+			/** @brief Copy assignment operator */
+			SubtreeStatistics& operator=( const SubtreeStatistics& ) = delete;
+
+			/** @brief Move assignment operator */
+			SubtreeStatistics& operator=( SubtreeStatistics&& ) noexcept = delete;
+
+			//----------------------------------------------
+			// Lookup
+			//----------------------------------------------
+
+			/**
+			 * @brief Gets the table of a maximum traversal occurrence.
+			 * @param maxTraversalOccurrence The maximum occurrences of a node in the parent chain.
+			 * @return The table, or `nullptr` if it has not been added yet.
+			 */
+			[[nodiscard]] const Table* find( size_t maxTraversalOccurrence ) const;
+
+			/**
+			 * @brief Adds the table of a maximum traversal occurrence, unless another thread added it first.
+			 * @param maxTraversalOccurrence The maximum occurrences of a node in the parent chain.
+			 * @param table The table.
+			 * @return The table held for `maxTraversalOccurrence`.
+			 */
+			const Table& add( size_t maxTraversalOccurrence, Table&& table );
+
+		private:
+			//----------------------------------------------
+			// Private member variables
+			//----------------------------------------------
+
+			/** @brief Tables keyed by maximum traversal occurrence. */
+			std::unordered_map<size_t, std::unique_ptr<const Table>> m_tables;
+
+			/** @brief Guards `m_tables`. */
+			mutable std::shared_mutex m_mutex;
+		};
+
+		//=====================================================================
+		// GmodInstanceId class
+		//=====================================================================
+
+		/**
+		 * @brief Identifier of a Gmod object that is never reused within the process.
+		 * @details Unlike the address of a Gmod, it cannot be taken over by a Gmod constructed
+		 *          after the first one is destroyed. Copies and moves draw a new id, since they
+		 *          are distinct objects that paths refer to by address.
+		 */
+		class GmodInstanceId final
+		{
+		public:
+			//----------------------------------------------
+			// Construction / destruction
+			//----------------------------------------------
+
+			/** @brief Default constructor. Draws a new id. */
+			GmodInstanceId() noexcept : m_value{ next() } {}
+
+			/** @brief Copy constructor. Draws a new id. */
+			GmodInstanceId( const GmodInstanceId& ) noexcept : m_value{ next() } {}
+
+			/** @brief Move constructor. Draws a new id. */
+			GmodInstanceId( GmodInstanceId&& ) noexcept : m_value{ next() } {}
+
+			/** @brief Destructor */
+			~GmodInstanceId() = default;
+
+			//----------------------------------------------
+			// Assignment operators
+			//----------------------------------------------
+
+			/** @brief Copy assignment operator. Draws a new id. */
+			GmodInstanceId& operator=( const GmodInstanceId& ) noexcept
+			{
+				m_value = next();
+
+				return *this;
+			}
+
+			/** @brief Move assignment operator. Draws a new id. */
+			GmodInstanceId& operator=( GmodInstanceId&& ) noexcept
+			{
+				m_value = next();
+
+				return *this;
+			}
+
+			//----------------------------------------------
+			// Accessors
+			//----------------------------------------------
+
+			/**
+			 * @brief Gets the id.
+			 * @return The id; never 0.
+			 */
+			[[nodiscard]] uint64_t value() const noexcept { return m_value; }
+
+		private:
+			//----------------------------------------------
+			// Private helper methods
+			//----------------------------------------------
+
+			[[nodiscard]] static uint64_t next() noexcept;
+
+			//----------------------------------------------
+			// Private member variables
+			//----------------------------------------------
+
+			uint64_t m_value;
+		};
+	}
 
 	//=====================================================================
 	// Gmod class
@@ -37,6 +418,8 @@ namespace dnv::vista::sdk
 	 */
 	class Gmod final
 	{
+		friend class GmodSnapshot;
+
 	public:
 		class Enumerator;
 
@@ -55,6 +438,17 @@ namespace dnv::vista::sdk
 		 */
 		Gmod( VisVersion version, const GmodDto& dto );
 
+		/**
+		 * @brief Constructs a Gmod instance from a GmodDto using a precomputed CHD seed table.
+		 * @details The node dictionary is laid out directly from `seeds` (see `ChdSeedTable`)
+		 *          instead of running the seed search. An empty span falls back to the search.
+		 * @param version The VIS version this GMOD corresponds to.
+		 * @param dto The data transfer object containing the GMOD structure and nodes.
+		 * @param seeds The precomputed CHD seed table for the DTO node codes.
+		 * @throws std::invalid_argument If the seed table does not map the node codes to distinct slots.
+		 */
+		Gmod( VisVersion version, const GmodDto& dto, std::span<const int> seeds );
+
 		/**
 		 * @brief Constructs a Gmod instance from an initial map of nodes.
 		 * @details This constructor is typically used for testing or specialized GMOD setup.
@@ -68,6 +462,19 @@ namespace dnv::vista::sdk
 		 */
 		Gmod( VisVersion version, const std::unordered_map<std::string, GmodNode>& initialNodeMap );
 
+		/**
+		 * @brief Constructs a fully linked Gmod instance from a binary GMOD cache (snapshot).
+		 * @details Nodes, relations and the CHD table layout are restored directly from the
+		 *          snapshot records; no JSON parsing, relation lookups or seed search take place.
+		 *          The nodes are still copied to the heap: GmodNode owns its strings and hands them
+		 *          out as `const std::string&`, so it cannot refer into the mapping, and the node
+		 *          pages are therefore not shared between processes. The snapshot can be released
+		 *          once construction has completed.
+		 * @param snapshot The opened snapshot.
+		 * @throws std::invalid_argument If the stored CHD layout is inconsistent.
+		 */
+		explicit Gmod( const GmodSnapshot& snapshot );
+
 		/** @brief Default constructor. */
 		Gmod() = delete;
 
@@ -112,6 +519,14 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] inline VisVersion visVersion() const;
 
+		/**
+		 * @brief Gets the identifier of this Gmod object.
+		 * @details Unique within the process and never reused, unlike the address of the object;
+		 *          copies and moves of a Gmod get a new one.
+		 * @return The instance id; never 0.
+		 */
+		[[nodiscard]] inline uint64_t instanceId() const noexcept;
+
 		/**
 		 * @brief Gets the root node of the GMOD hierarchy.
 		 * @details The root node (typically with code "VE") serves as the entry point
@@ -133,6 +548,41 @@ namespace dnv::vista::sdk
 		 */
 		bool tryGetNode( std::string_view code, const GmodNode*& node ) const;
 
+		/**
+		 * @brief Tries to get a GmodNode by its interned code id.
+		 * @details Resolves by array index, without hashing the code.
+		 * @param codeId The interned code id, e.g. `GmodNode::codeId()` of a node of any VIS version.
+		 * @param[out] node Output parameter; set to a pointer to the GmodNode if found, otherwise nullptr.
+		 * @return True if the node was found, false otherwise.
+		 */
+		bool tryGetNode( uint32_t codeId, const GmodNode*& node ) const;
+
+		/**
+		 * @brief Looks up several GmodNodes by code in one batch.
+		 * @details Hashing and memory accesses of consecutive codes are overlapped; prefer this over
+		 *          repeated `tryGetNode()` calls when resolving many codes at once.
+		 * @param codes The codes of the GmodNodes to find.
+		 * @param[out] nodes Receives, for each code, a pointer to the GmodNode or nullptr if not found.
+		 *                   Must have the same size as `codes`.
+		 * @return The number of codes found.
+		 * @throws std::invalid_argument If `nodes` and `codes` differ in size.
+		 */
+		size_t tryGetNodes( std::span<const std::string_view> codes, std::span<const GmodNode*> nodes ) const;
+
+		/**
+		 * @brief Gets the memoized searches of `GmodTraversal::pathExistsBetween()` on this GMOD.
+		 * @details Shared with copies of the Gmod, which share the graph as well.
+		 * @return The index; thread-safe.
+		 */
+		[[nodiscard]] internal::PathExistsIndex& pathExistsIndex() const noexcept;
+
+		/**
+		 * @brief Gets the traversal sizes computed on this GMOD, see `GmodTraversal::pathCount()`.
+		 * @details Shared with copies of the Gmod, which share the graph as well.
+		 * @return The statistics; thread-safe.
+		 */
+		[[nodiscard]] internal::SubtreeStatistics& subtreeStatistics() const noexcept;
+
 		//----------------------------------------------
 		// Path parsing & navigation
 		//----------------------------------------------
@@ -327,6 +777,28 @@ namespace dnv::vista::sdk
 		};
 
 	private:
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds `m_graph` from the linked nodes and attaches it to every node.
+		 * @details Called at the end of every constructor, once relations are final.
+		 */
+		void buildGraph();
+
+		/**
+		 * @brief Computes the reachability labels of a graph whose adjacency is complete.
+		 * @param graph The graph to label.
+		 */
+		static void buildReachLabels( internal::GmodGraph& graph );
+
+		/**
+		 * @brief Resolves the product type and product selection of a linked node.
+		 * @param node The node; its children must be final.
+		 */
+		static void resolveProductNodes( GmodNode& node );
+
 		//----------------------------------------------
 		// Private member variables
 		//----------------------------------------------
@@ -347,6 +819,21 @@ namespace dnv::vista::sdk
 		 *          It owns the GmodNode instances.
 		 */
 		ChdDictionary<GmodNode> m_nodeMap;
+
+		/**
+		 * @brief CSR adjacency of the nodes in `m_nodeMap`.
+		 * @details Heap-allocated so that its address, which the nodes keep, survives moves of the Gmod.
+		 */
+		std::shared_ptr<const internal::GmodGraph> m_graph;
+
+		/** @brief Memoized path searches over `m_graph`, see `pathExistsIndex()`. */
+		std::shared_ptr<internal::PathExistsIndex> m_pathExistsIndex;
+
+		/** @brief Traversal sizes over `m_graph`, see `subtreeStatistics()`. */
+		std::shared_ptr<internal::SubtreeStatistics> m_subtreeStatistics;
+
+		/** @brief See `instanceId()`. */
+		internal::GmodInstanceId m_instanceId;
 	};
 }
 
@@ -11,22 +11,53 @@ namespace dnv::vista::sdk
 		// Constants
 		//=====================================================================
 
-		static constexpr std::string_view NODE_CATEGORY_PRODUCT = "PRODUCT";
-		static constexpr std::string_view NODE_CATEGORY_ASSET = "ASSET";
-		static constexpr std::string_view NODE_CATEGORY_ASSET_FUNCTION = "ASSET FUNCTION";
-		static constexpr std::string_view NODE_CATEGORY_PRODUCT_FUNCTION = "PRODUCT FUNCTION";
-
 		static constexpr std::string_view NODE_TYPE_SELECTION = "SELECTION";
 		static constexpr std::string_view NODE_TYPE_GROUP = "GROUP";
 		static constexpr std::string_view NODE_TYPE_LEAF = "LEAF";
-		static constexpr std::string_view NODE_TYPE_TYPE = "TYPE";
-		static constexpr std::string_view NODE_TYPE_COMPOSITION = "COMPOSITION";
 
-		static constexpr std::string_view NODE_FULLTYPE_ASSET_FUNCTION_LEAF = "ASSET FUNCTION LEAF";
-		static constexpr std::string_view NODE_FULLTYPE_PRODUCT_FUNCTION_LEAF = "PRODUCT FUNCTION LEAF";
+		//=====================================================================
+		// GmodGraph struct
+		//=====================================================================
+
+		inline std::span<const uint32_t> GmodGraph::childrenOf( uint32_t index ) const noexcept
+		{
+			return { children.data() + childOffsets[index], children.data() + childOffsets[index + 1] };
+		}
+
+		inline std::span<const uint32_t> GmodGraph::parentsOf( uint32_t index ) const noexcept
+		{
+			return { parents.data() + parentOffsets[index], parents.data() + parentOffsets[index + 1] };
+		}
+
+		inline bool GmodGraph::isChild( uint32_t index, uint32_t codeId ) const noexcept
+		{
+			const auto first = childCodeIds.begin() + childOffsets[index];
+			const auto last = childCodeIds.begin() + childOffsets[index + 1];
+
+			return std::binary_search( first, last, codeId );
+		}
+
+		inline bool GmodGraph::mayReach( uint32_t from, uint32_t to ) const noexcept
+		{
+			for ( size_t labelling = 0; labelling < REACH_LABELLINGS; ++labelling )
+			{
+				const ReachInterval& outer = reach[from][labelling];
+				const ReachInterval& inner = reach[to][labelling];
+				if ( inner.low < outer.low || inner.high > outer.high )
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		inline bool GmodGraph::isProductSelectionAssignment( uint32_t parent, uint32_t child ) const noexcept
+		{
+			constexpr uint16_t childMask = GmodNodeFlags::CATEGORY_HAS_PRODUCT | GmodNodeFlags::TYPE_SELECTION;
 
-		static constexpr std::string_view KEYWORD_FUNCTION = "FUNCTION";
-		static constexpr std::string_view KEYWORD_PRODUCT = "PRODUCT";
+			return ( flags[parent] & GmodNodeFlags::CATEGORY_HAS_FUNCTION ) != 0 && ( flags[child] & childMask ) == childMask;
+		}
 	}
 
 	//=====================================================================
@@ -58,6 +89,11 @@ namespace dnv::vista::sdk
 		return m_visVersion;
 	}
 
+	inline uint64_t Gmod::instanceId() const noexcept
+	{
+		return m_instanceId.value();
+	}
+
 	inline const GmodNode& Gmod::rootNode() const
 	{
 		if ( !m_rootNode )
@@ -82,41 +118,32 @@ namespace dnv::vista::sdk
 
 	inline bool Gmod::isLeafNode( const GmodNodeMetadata& metadata )
 	{
-		const auto& fullType = metadata.fullType();
-
-		return fullType == internal::NODE_FULLTYPE_ASSET_FUNCTION_LEAF ||
-			   fullType == internal::NODE_FULLTYPE_PRODUCT_FUNCTION_LEAF;
+		return metadata.flags() & internal::GmodNodeFlags::LEAF_NODE;
 	}
 
 	inline bool Gmod::isFunctionNode( const GmodNodeMetadata& metadata )
 	{
-		const auto& category = metadata.category();
-
-		return category != internal::NODE_CATEGORY_PRODUCT &&
-			   category != internal::NODE_CATEGORY_ASSET;
+		return metadata.flags() & internal::GmodNodeFlags::FUNCTION_NODE;
 	}
 
 	inline bool Gmod::isProductSelection( const GmodNodeMetadata& metadata )
 	{
-		return metadata.category() == internal::NODE_CATEGORY_PRODUCT &&
-			   metadata.type() == internal::NODE_TYPE_SELECTION;
+		return metadata.flags() & internal::GmodNodeFlags::PRODUCT_SELECTION;
 	}
 
 	inline bool Gmod::isProductType( const GmodNodeMetadata& metadata )
 	{
-
-		return metadata.category() == internal::NODE_CATEGORY_PRODUCT &&
-			   metadata.type() == internal::NODE_TYPE_TYPE;
+		return metadata.flags() & internal::GmodNodeFlags::PRODUCT_TYPE;
 	}
 
 	inline bool Gmod::isAsset( const GmodNodeMetadata& metadata )
 	{
-		return metadata.category() == internal::NODE_CATEGORY_ASSET;
+		return metadata.flags() & internal::GmodNodeFlags::ASSET;
 	}
 
 	inline bool Gmod::isAssetFunctionNode( const GmodNodeMetadata& metadata )
 	{
-		return metadata.category() == internal::NODE_CATEGORY_ASSET_FUNCTION;
+		return metadata.flags() & internal::GmodNodeFlags::ASSET_FUNCTION_NODE;
 	}
 
 	inline bool Gmod::isProductTypeAssignment( const GmodNode* parent, const GmodNode* child ) noexcept
@@ -126,17 +153,8 @@ namespace dnv::vista::sdk
 			return false;
 		}
 
-		const auto& parentCategory = parent->metadata().category();
-		const auto& childCategory = child->metadata().category();
-		const auto& childType = child->metadata().type();
-
-		if ( parentCategory.find( internal::KEYWORD_FUNCTION ) == std::string_view::npos )
-		{
-			return false;
-		}
-
-		return childCategory == internal::NODE_CATEGORY_PRODUCT &&
-			   childType == internal::NODE_TYPE_TYPE;
+		return ( parent->flags() & internal::GmodNodeFlags::CATEGORY_HAS_FUNCTION ) &&
+			   ( child->flags() & internal::GmodNodeFlags::PRODUCT_TYPE );
 	}
 
 	inline bool Gmod::isProductSelectionAssignment( const GmodNode* parent, const GmodNode* child )
@@ -146,16 +164,9 @@ namespace dnv::vista::sdk
 			return false;
 		}
 
-		const auto& parentCategory = parent->metadata().category();
-		const auto& childCategory = child->metadata().category();
-		const auto& childType = child->metadata().type();
-
-		if ( parentCategory.find( internal::KEYWORD_FUNCTION ) == std::string_view::npos )
-		{
-			return false;
-		}
+		constexpr uint16_t childMask = internal::GmodNodeFlags::CATEGORY_HAS_PRODUCT | internal::GmodNodeFlags::TYPE_SELECTION;
 
-		return childCategory.find( internal::KEYWORD_PRODUCT ) != std::string_view::npos &&
-			   childType == internal::NODE_TYPE_SELECTION;
+		return ( parent->flags() & internal::GmodNodeFlags::CATEGORY_HAS_FUNCTION ) &&
+			   ( child->flags() & childMask ) == childMask;
 	}
 }
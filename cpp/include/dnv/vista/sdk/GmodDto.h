@@ -318,6 +318,15 @@ namespace dnv::vista::sdk
 		 */
 		static GmodDto fromJson( const nlohmann::json& json );
 
+		/**
+		 * @brief Try to parse a GmodDto directly from JSON text
+		 * @details Builds the nodes and relations from SAX events, without an intermediate
+		 *          nlohmann::json document. Malformed nodes and relations are skipped as in tryFromJson().
+		 * @param jsonText The JSON text to parse
+		 * @return Optional containing the parsed object if successful, empty optional otherwise
+		 */
+		static std::optional<GmodDto> tryParse( std::string_view jsonText );
+
 		/**
 		 * @brief Serialize this GmodDto to an nlohmann::json object
 		 * @return The serialized nlohmann::json object
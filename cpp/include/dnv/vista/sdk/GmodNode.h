@@ -21,7 +21,94 @@ namespace dnv::vista::sdk
 
 	enum class VisVersion;
 	class ParsingErrors;
+	class GmodNodeMetadata;
 	class Gmod;
+	class GmodLocatedNode;
+
+	namespace internal
+	{
+		struct GmodGraph;
+
+		//=====================================================================
+		// GmodNodeFlags struct
+		//=====================================================================
+
+		/**
+		 * @brief Classification bits of a GMOD node.
+		 * @details Each bit caches one of the string comparisons on the node metadata or code that
+		 *          traversal, path parsing and path validation would otherwise repeat for every visit.
+		 *          Metadata bits are computed once per distinct metadata (`GmodNodeMetadata::flags()`),
+		 *          code bits once per node (`GmodNode::flags()`).
+		 */
+		struct GmodNodeFlags final
+		{
+			/** @brief Category "PRODUCT" and type "SELECTION" (`Gmod::isProductSelection()`). */
+			static constexpr uint16_t PRODUCT_SELECTION{ 1 << 0 };
+
+			/** @brief Category "PRODUCT" and type "TYPE" (`Gmod::isProductType()`). */
+			static constexpr uint16_t PRODUCT_TYPE{ 1 << 1 };
+
+			/** @brief Category "ASSET" (`Gmod::isAsset()`). */
+			static constexpr uint16_t ASSET{ 1 << 2 };
+
+			/** @brief Neither "PRODUCT" nor "ASSET" category (`Gmod::isFunctionNode()`). */
+			static constexpr uint16_t FUNCTION_NODE{ 1 << 3 };
+
+			/** @brief Category "ASSET FUNCTION" (`Gmod::isAssetFunctionNode()`). */
+			static constexpr uint16_t ASSET_FUNCTION_NODE{ 1 << 4 };
+
+			/** @brief Asset or product function leaf (`Gmod::isLeafNode()`). */
+			static constexpr uint16_t LEAF_NODE{ 1 << 5 };
+
+			/** @brief Asset or product function composition (`GmodNode::isFunctionComposition()`). */
+			static constexpr uint16_t FUNCTION_COMPOSITION{ 1 << 6 };
+
+			/** @brief Category contains "FUNCTION". */
+			static constexpr uint16_t CATEGORY_HAS_FUNCTION{ 1 << 7 };
+
+			/** @brief Category contains "PRODUCT". */
+			static constexpr uint16_t CATEGORY_HAS_PRODUCT{ 1 << 8 };
+
+			/** @brief Type "SELECTION". */
+			static constexpr uint16_t TYPE_SELECTION{ 1 << 9 };
+
+			/** @brief Substructure explicitly not installed; traversal does not enter the node. */
+			static constexpr uint16_t SKIP_SUBSTRUCTURE{ 1 << 10 };
+
+			/** @brief Type "SELECTION", "GROUP" or "LEAF" (`Gmod::isPotentialParent()`). */
+			static constexpr uint16_t POTENTIAL_PARENT{ 1 << 11 };
+
+			/** @brief Group, selection, product type or asset type; never individualizable. */
+			static constexpr uint16_t NOT_INDIVIDUALIZABLE{ 1 << 12 };
+
+			/** @brief The root node "VE". Node bit. */
+			static constexpr uint16_t ROOT{ 1 << 13 };
+
+			/** @brief Function composition whose code ends with 'i'; individualizable on its own. Node bit. */
+			static constexpr uint16_t INDIVIDUALIZABLE_COMPOSITION{ 1 << 14 };
+
+			/**
+			 * @brief Mappable by metadata and code; the node is mappable unless it also has a
+			 *        product type or product selection (`GmodNode::isMappable()`). Node bit.
+			 */
+			static constexpr uint16_t MAPPABLE_KIND{ 1 << 15 };
+
+			/**
+			 * @brief Computes the metadata bits of a node.
+			 * @param metadata The metadata to classify.
+			 * @return The bits that apply to nodes with `metadata`.
+			 */
+			[[nodiscard]] static uint16_t of( const GmodNodeMetadata& metadata );
+
+			/**
+			 * @brief Computes all bits of a node.
+			 * @param metadataFlags The metadata bits of the node, see `of( const GmodNodeMetadata& )`.
+			 * @param code The node code.
+			 * @return The bits that apply to a node with `code` and metadata bits `metadataFlags`.
+			 */
+			[[nodiscard]] static uint16_t of( uint16_t metadataFlags, std::string_view code );
+		};
+	}
 
 	//=====================================================================
 	// GmodNodeMetadata class
@@ -31,7 +118,8 @@ namespace dnv::vista::sdk
 	 * @brief Metadata for a GMOD (Generic Product Model) node.
 	 * @details Contains descriptive information about a node including its category, type,
 	 *          name, and other optional properties as defined in ISO 19848.
-	 *          This class is designed to be immutable after construction.
+	 *          This class is designed to be immutable after construction. Nodes do not own their
+	 *          metadata: equal metadata objects are stored once per Gmod (see `GmodNode::metadata()`).
 	 */
 	class GmodNodeMetadata final
 	{
@@ -159,6 +247,12 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] const std::unordered_map<std::string, std::string>& normalAssignmentNames() const;
 
+		/**
+		 * @brief Get the classification bits of the metadata, computed at construction
+		 * @return The `internal::GmodNodeFlags` metadata bits
+		 */
+		[[nodiscard]] uint16_t flags() const noexcept;
+
 	private:
 		//----------------------------------------------
 		// Private member variables
@@ -190,6 +284,9 @@ namespace dnv::vista::sdk
 
 		/** @brief Combined category and type string, e.g., "PRODUCT TYPE", generated at construction. */
 		std::string m_fullType;
+
+		/** @brief `internal::GmodNodeFlags` metadata bits, computed at construction. */
+		uint16_t m_flags;
 	};
 
 	//=====================================================================
@@ -201,8 +298,10 @@ namespace dnv::vista::sdk
 	 * @details Represents a single node in the hierarchical structure of the Generic Product Model
 	 *          as defined by ISO 19848. Contains metadata, relationships to parent/child
 	 *          nodes, and optional location information.
-	 *          This class is designed to be non-copyable and movable. Its relationships
-	 *          (children, parents) are managed by the `Gmod` class.
+	 *          Metadata and relationships are shared: a copy (e.g. from `withLocation()`) copies the
+	 *          code, the location and two pointers. Relationships (children, parents) are managed
+	 *          by the `Gmod` class. For a located reference that does not copy the node at all,
+	 *          see `GmodLocatedNode`.
 	 */
 	class GmodNode final
 	{
@@ -224,7 +323,7 @@ namespace dnv::vista::sdk
 		GmodNode() = delete;
 
 		/** @brief Copy constructor */
-		GmodNode( const GmodNode& ); //= default;
+		GmodNode( const GmodNode& ) = default;
 
 		/** @brief Move constructor */
 		GmodNode( GmodNode&& ) noexcept = default;
@@ -237,7 +336,7 @@ namespace dnv::vista::sdk
 		//----------------------------------------------
 
 		/** @brief Copy assignment operator */
-		GmodNode& operator=( const GmodNode& );
+		GmodNode& operator=( const GmodNode& ) = default;
 
 		/** @brief Move assignment operator */
 		GmodNode& operator=( GmodNode&& ) noexcept = default;
@@ -280,6 +379,14 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] const std::string& code() const;
 
+		/**
+		 * @brief Get the interned id of the code
+		 * @details The id is assigned by `StringInterner::instance()` and is the same for equal codes
+		 *          in every VIS version.
+		 * @return The code id
+		 */
+		[[nodiscard]] uint32_t codeId() const noexcept;
+
 		/**
 		 * @brief Get the location information
 		 * @return Optional reference to the location
@@ -294,6 +401,8 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Get the node metadata
+		 * @details Metadata is shared: copies of a node, and nodes of the same Gmod with equal
+		 *          metadata, return the same object, which lives as long as any node referring to it.
 		 * @return Reference to the metadata
 		 */
 		[[nodiscard]] const GmodNodeMetadata& metadata() const;
@@ -306,6 +415,14 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] size_t hashCode() const noexcept;
 
+		/**
+		 * @brief Gets the classification bits of this node.
+		 * @details Computed once at construction from the metadata and the code; the node type
+		 *          checking methods below are tests on these bits.
+		 * @return The `internal::GmodNodeFlags` bits of this node.
+		 */
+		[[nodiscard]] uint16_t flags() const noexcept;
+
 		//----------------------------------------------
 		// Relationship accessors
 		//----------------------------------------------
@@ -325,6 +442,7 @@ namespace dnv::vista::sdk
 		/**
 		 * @brief Gets the product type node associated with this function node, if applicable.
 		 * @details For a function node, this typically refers to its single child node if that child is a product type.
+		 *          Resolved once when the owning Gmod is built.
 		 * @return A const non-owning pointer to the product type node, or `nullptr` if not applicable or not found.
 		 */
 		[[nodiscard]] const GmodNode* productType() const;
@@ -332,10 +450,27 @@ namespace dnv::vista::sdk
 		/**
 		 * @brief Gets the product selection node associated with this function node, if applicable.
 		 * @details For a function node, this typically refers to its single child node if that child is a product selection.
+		 *          Resolved once when the owning Gmod is built.
 		 * @return A const non-owning pointer to the product selection node, or `nullptr` if not applicable or not found.
 		 */
 		[[nodiscard]] const GmodNode* productSelection() const;
 
+		//----------------------------------------------
+		// Graph accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the CSR adjacency of the Gmod owning this node.
+		 * @return A pointer to the graph, or `nullptr` if the node is not owned by a Gmod.
+		 */
+		[[nodiscard]] const internal::GmodGraph* graph() const noexcept;
+
+		/**
+		 * @brief Gets the index of this node in `graph()`.
+		 * @return The node index; meaningless if `graph()` is `nullptr`.
+		 */
+		[[nodiscard]] uint32_t graphIndex() const noexcept;
+
 		//----------------------------------------------
 		// Node location methods
 		//----------------------------------------------
@@ -391,6 +526,15 @@ namespace dnv::vista::sdk
 		 */
 		[[nodiscard]] GmodNode tryWithLocation( const std::optional<Location>& location ) const;
 
+		/**
+		 * @brief Creates a located handle to this node without copying it.
+		 * @details The handle refers to this node, so it must not outlive it. Nodes owned by a `Gmod`
+		 *          live as long as the `Gmod`.
+		 * @param location The location of the handle, or `std::nullopt` for none.
+		 * @return A handle to this node with the given location.
+		 */
+		[[nodiscard]] GmodLocatedNode located( const std::optional<Location>& location ) const;
+
 		/**
 		 * @brief Checks if the node is individualizable.
 		 * @details A node is individualizable if it can be assigned a unique instance identifier
@@ -472,12 +616,21 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Checks if this node has a direct child with a specific code.
-		 * @details This check is efficient due to an internal set of child codes (`m_childrenSet`).
+		 * @details Nodes with many children resolve `code` to its interned id and search the sorted
+		 *          child code ids of the node in its graph.
 		 * @param code The code of the potential child node.
 		 * @return True if a direct child with the specified `code` exists, false otherwise.
 		 */
 		[[nodiscard]] bool isChild( const std::string& code ) const;
 
+		/**
+		 * @brief Checks if this node has a direct child with a specific interned code id.
+		 * @details Binary search over the sorted child code ids of the node in its graph.
+		 * @param codeId The interned id of the potential child's code (see `codeId()`).
+		 * @return True if a direct child with the specified code id exists, false otherwise.
+		 */
+		[[nodiscard]] bool isChild( uint32_t codeId ) const;
+
 		//----------------------------------------------
 		// Utility methods
 		//----------------------------------------------
@@ -497,6 +650,19 @@ namespace dnv::vista::sdk
 		void toString( std::stringstream& builder ) const;
 
 	private:
+		//----------------------------------------------
+		// Private construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an unlinked GmodNode from already materialized parts.
+		 * @details Used by `Gmod` when restoring nodes from a binary snapshot.
+		 * @param version The VIS version associated with this node.
+		 * @param code The node code.
+		 * @param metadata The node metadata.
+		 */
+		GmodNode( VisVersion version, std::string code, GmodNodeMetadata metadata );
+
 		//----------------------------------------------
 		// Relationship management methods
 		//----------------------------------------------
@@ -504,7 +670,7 @@ namespace dnv::vista::sdk
 		/**
 		 * @brief Adds a GmodNode instance as a child to this node.
 		 * @details This method is intended for use by the `Gmod` class during graph construction.
-		 *          It updates both the children list and the children set for quick lookups.
+		 *          A child with the same code as an existing child is ignored.
 		 * @param child A non-owning pointer to the GmodNode to add as a child. Must not be null.
 		 */
 		void addChild( GmodNode* child );
@@ -517,12 +683,41 @@ namespace dnv::vista::sdk
 		void addParent( GmodNode* parent );
 
 		/**
-		 * @brief Optimizes memory usage for child/parent vectors and rebuilds the child code set.
+		 * @brief Optimizes memory usage for child/parent vectors.
 		 * @details This method is intended for use by the `Gmod` class after the graph structure is finalized.
-		 *          It calls `shrink_to_fit()` on internal vectors and ensures `m_childrenSet` is consistent.
+		 *          It calls `shrink_to_fit()` on internal vectors.
 		 */
 		void trim();
 
+		//----------------------------------------------
+		// Private types
+		//----------------------------------------------
+
+		/** @brief Relationships of a node, shared by all copies of it. Managed by Gmod. */
+		struct Links
+		{
+			/** @brief Owner of the metadata of the node; shared with the nodes of the Gmod that have equal metadata. */
+			std::shared_ptr<const GmodNodeMetadata> metadata;
+
+			/** @brief Vector of non-owning pointers to direct child nodes. */
+			std::vector<GmodNode*> children;
+
+			/** @brief Vector of non-owning pointers to direct parent nodes. */
+			std::vector<GmodNode*> parents;
+
+			/** @brief CSR adjacency of the owning Gmod, or nullptr before the Gmod is built. */
+			const internal::GmodGraph* graph{ nullptr };
+
+			/** @brief Index of the node in `graph`. */
+			uint32_t graphIndex{ 0 };
+
+			/** @brief Product type child of a function node, resolved when the Gmod is built. */
+			const GmodNode* productType{ nullptr };
+
+			/** @brief Product selection child of a function node, resolved when the Gmod is built. */
+			const GmodNode* productSelection{ nullptr };
+		};
+
 		//----------------------------------------------
 		// Private member variables
 		//----------------------------------------------
@@ -530,25 +725,200 @@ namespace dnv::vista::sdk
 		/** @brief Unique identifier code of the node. */
 		std::string m_code;
 
+		/** @brief Interned id of `m_code`. */
+		uint32_t m_codeId;
+
 		/** @brief Optional location information for this specific node instance. */
 		std::optional<Location> m_location;
 
 		/** @brief VIS (Vessel Information Structure) version associated with this node. */
 		VisVersion m_visVersion;
 
-		/** @brief Metadata object containing descriptive information about this node. */
-		GmodNodeMetadata m_metadata;
+		/** @brief Metadata object containing descriptive information about this node, owned by `m_links`. Never null. */
+		const GmodNodeMetadata* m_metadata;
 
-		/** @brief Vector of non-owning pointers to direct child nodes. Managed by Gmod. */
-		std::vector<GmodNode*> m_children;
+		/** @brief `internal::GmodNodeFlags` bits of this node. */
+		uint16_t m_flags;
 
-		/** @brief Vector of non-owning pointers to direct parent nodes. Managed by Gmod. */
-		std::vector<GmodNode*> m_parents;
+		/** @brief Relationships shared with every copy of this node. Never null. */
+		std::shared_ptr<Links> m_links;
+	};
 
-		/** @brief Set of child codes for efficient `isChild(const std::string&)` lookups. Maintained by addChild/trim. */
-		std::unordered_set<std::string> m_childrenSet;
+	//=====================================================================
+	// GmodLocatedNode class
+	//=====================================================================
 
-		mutable std::optional<const GmodNode*> m_cachedProductType;
-		mutable std::optional<const GmodNode*> m_cachedProductSelection;
+	/**
+	 * @brief A lightweight reference to a GMOD node with an optional location.
+	 * @details Holds a pointer to the node and the location characters inline, so creating or
+	 *          copying one copies 16 bytes, whereas `GmodNode::withLocation()` copies a node.
+	 *          Locations longer than `INLINE_LOCATION_CAPACITY` characters are stored by id in a
+	 *          process-wide location table, separate from the code ids of `StringInterner::instance()`.
+	 *          Locations are short and drawn from a small vocabulary, so that table stays small.
+	 *          The referenced node must outlive the handle.
+	 */
+	class GmodLocatedNode final
+	{
+		friend class GmodPath;
+
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Maximum length of a location stored inline. */
+		static constexpr size_t INLINE_LOCATION_CAPACITY{ 7 };
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs a handle to a node.
+		 * @param node The node to refer to.
+		 * @param location The location of the handle, or `std::nullopt` for none.
+		 */
+		GmodLocatedNode( const GmodNode& node, const std::optional<Location>& location );
+
+		/** @brief Copy constructor */
+		GmodLocatedNode( const GmodLocatedNode& ) = default;
+
+		/** @brief Move constructor */
+		GmodLocatedNode( GmodLocatedNode&& ) noexcept = default;
+
+		/** @brief Destructor */
+		~GmodLocatedNode() = default;
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		GmodLocatedNode& operator=( const GmodLocatedNode& ) = default;
+
+		/** @brief Move assignment operator */
+		GmodLocatedNode& operator=( GmodLocatedNode&& ) noexcept = default;
+
+		//----------------------------------------------
+		// Operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Equality comparison operator.
+		 * @details Handles are equal if their nodes have the same code and they have the same location,
+		 *          matching `GmodNode::operator==`.
+		 * @param other The handle to compare with.
+		 * @return True if the handles are equal, false otherwise.
+		 */
+		bool operator==( const GmodLocatedNode& other ) const noexcept;
+
+		/**
+		 * @brief Inequality comparison operator.
+		 * @param other The handle to compare with.
+		 * @return True if the handles are not equal, false otherwise.
+		 */
+		bool operator!=( const GmodLocatedNode& other ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the referenced node
+		 * @return Reference to the node, whose own location is ignored
+		 */
+		[[nodiscard]] const GmodNode& node() const noexcept;
+
+		/**
+		 * @brief Get the code of the referenced node
+		 * @return Reference to the code string
+		 */
+		[[nodiscard]] const std::string& code() const noexcept;
+
+		/**
+		 * @brief Get the location information
+		 * @return The location, or `std::nullopt` if the handle has none
+		 */
+		[[nodiscard]] std::optional<Location> location() const;
+
+		/**
+		 * @brief Checks if the handle has a location.
+		 * @return True if the handle has a location, false otherwise.
+		 */
+		[[nodiscard]] bool hasLocation() const noexcept;
+
+		/**
+		 * @brief Checks if two handles have the same location, regardless of their nodes.
+		 * @param other The handle to compare with.
+		 * @return True if both have the same location or both have none, false otherwise.
+		 */
+		[[nodiscard]] bool hasSameLocation( const GmodLocatedNode& other ) const noexcept;
+
+		/**
+		 * @brief Computes a hash of the handle, consistent with `operator==`.
+		 * @return The hash value.
+		 */
+		[[nodiscard]] size_t hashCode() const noexcept;
+
+		//----------------------------------------------
+		// Conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Creates a handle to another node with the location of this one.
+		 * @param node The node to refer to.
+		 * @return The new handle.
+		 */
+		[[nodiscard]] GmodLocatedNode withNode( const GmodNode& node ) const noexcept;
+
+		/**
+		 * @brief Materializes the handle as a node.
+		 * @return A copy of the referenced node with the location of the handle.
+		 */
+		[[nodiscard]] GmodNode toNode() const;
+
+		/**
+		 * @brief Converts the handle to its string representation.
+		 * @details The format is "<code>" or "<code>-<location>", as for `GmodNode::toString()`.
+		 * @return A `std::string` representing the handle.
+		 */
+		[[nodiscard]] std::string toString() const;
+
+		/**
+		 * @brief Appends the string representation of the handle to a stringstream.
+		 * @param builder The stringstream to append to.
+		 */
+		void toString( std::stringstream& builder ) const;
+
+	private:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Constructs an empty slot of a `GmodPath` node buffer; its node is null. */
+		GmodLocatedNode() noexcept;
+
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the location characters.
+		 * @return The location string, empty if the handle has no location.
+		 */
+		[[nodiscard]] std::string_view locationView() const;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief The referenced node. Only null in unused `GmodPath` slots. */
+		const GmodNode* m_node;
+
+		/**
+		 * @brief The location: up to `INLINE_LOCATION_CAPACITY` zero-padded characters followed by
+		 *        their count (0 for no location), or an interned id followed by `INTERNED_LOCATION`.
+		 */
+		std::array<char, INLINE_LOCATION_CAPACITY + 1> m_location;
 	};
 }
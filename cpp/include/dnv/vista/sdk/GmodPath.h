@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "GmodNode.h"
+
 namespace dnv::vista::sdk
 {
 	//=====================================================================
@@ -14,9 +16,9 @@ namespace dnv::vista::sdk
 	//=====================================================================
 
 	class Gmod;
-	class GmodNode;
 	class GmodParsePathResult;
 	class GmodIndividualizableSet;
+	struct GmodPathParseOutcome;
 	class Location;
 	class Locations;
 
@@ -26,6 +28,7 @@ namespace dnv::vista::sdk
 	namespace internal
 	{
 		struct ParseContext;
+		struct PathNodes;
 
 		dnv::vista::sdk::TraversalHandlerResult parseInternalTraversalHandler(
 			ParseContext& context,
@@ -33,6 +36,36 @@ namespace dnv::vista::sdk
 			const GmodNode& currentNode );
 	}
 
+	//=====================================================================
+	// GmodPathParseOptions struct
+	//=====================================================================
+
+	/**
+	 * @brief Options of `GmodPath::tryParseMany()`.
+	 */
+	struct GmodPathParseOptions
+	{
+		/**
+		 * @brief Runs `task( worker )` for the workers `[0, workerCount)`, possibly concurrently, and
+		 *        returns once every call it made has finished.
+		 * @details Workers steal chunks from each other, so all items are parsed as long as at least
+		 *          one worker runs; the executor may run fewer, or run them one after the other.
+		 */
+		using Executor = std::function<void( size_t workerCount, const std::function<void( size_t worker )>& task )>;
+
+		/** @brief Parse the items as full paths (`GmodPath::parseFullPath()`) instead of short paths. */
+		bool fullPath{ false };
+
+		/** @brief Number of workers; 0 uses the hardware concurrency, 1 parses on the calling thread only. */
+		size_t threadCount{ 0 };
+
+		/**
+		 * @brief Runs the workers. When empty, worker 0 runs on the calling thread and the others on
+		 *        `std::async` threads.
+		 */
+		Executor executor{};
+	};
+
 	//=====================================================================
 	// GmodPath class
 	//=====================================================================
@@ -53,11 +86,32 @@ namespace dnv::vista::sdk
 	public:
 		class Enumerator;
 
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Number of parents stored inside the path; deeper paths keep their nodes on the heap. */
+		static constexpr size_t INLINE_PARENTS_CAPACITY{ 16 };
+
 		//----------------------------------------------
 		// Construction / destruction
 		//----------------------------------------------
 
-		GmodPath( const Gmod& gmod, GmodNode* node, std::vector<GmodNode*> parents = {} );
+		/**
+		 * @brief Constructs a path from a node and its parents.
+		 * @details Nodes are stored as handles (`GmodLocatedNode`) to the nodes of `gmod` they stand
+		 *          for, with their locations, so copying a path copies the handles only.
+		 * @throws std::invalid_argument If a node is null or not in `gmod`, or the nodes do not form a path from the root.
+		 */
+		GmodPath( const Gmod& gmod, GmodNode* node, const std::vector<GmodNode*>& parents = {} );
+
+		/**
+		 * @brief Constructs a path from the handles of its nodes.
+		 * @param gmod The GMOD of the path.
+		 * @param nodes The nodes of the path, from the root to the target node.
+		 * @throws std::invalid_argument If `nodes` is empty, a node is not in `gmod`, or the nodes do not form a path from the root.
+		 */
+		GmodPath( const Gmod& gmod, std::span<const GmodLocatedNode> nodes );
 
 		GmodPath();
 		GmodPath( const GmodPath& other );
@@ -83,8 +137,14 @@ namespace dnv::vista::sdk
 		// Lookup operators
 		//----------------------------------------------
 
+		/**
+		 * @brief Gets a node of the path.
+		 * @details A node without location is the GMOD's own node. A located node is a copy made on
+		 *          first access and owned by the path; it stays valid while the path is neither
+		 *          modified nor destroyed.
+		 * @throws std::out_of_range If `index` is not less than `length()`.
+		 */
 		[[nodiscard]] GmodNode* operator[]( size_t index ) const;
-		[[nodiscard]] GmodNode*& operator[]( size_t index );
 
 		//----------------------------------------------
 		// Accessors
@@ -94,8 +154,18 @@ namespace dnv::vista::sdk
 		[[nodiscard]] size_t hashCode() const noexcept;
 
 		[[nodiscard]] const Gmod* gmod() const noexcept;
-		[[nodiscard]] GmodNode* node() const noexcept;
-		[[nodiscard]] const std::vector<GmodNode*>& parents() const noexcept;
+
+		/** @brief Gets the target node; see `operator[]` for the lifetime of located nodes. */
+		[[nodiscard]] GmodNode* node() const;
+
+		/** @brief Gets the parents of the target node, from the root; see `operator[]` for the lifetime of located nodes. */
+		[[nodiscard]] const std::vector<GmodNode*>& parents() const;
+
+		/**
+		 * @brief Gets the handles of the nodes of the path, from the root to the target node.
+		 * @details Unlike `parents()` and `node()`, never copies nodes.
+		 */
+		[[nodiscard]] std::span<const GmodLocatedNode> locatedNodes() const noexcept;
 
 		[[nodiscard]] size_t length() const noexcept;
 		[[nodiscard]] std::vector<GmodIndividualizableSet> individualizableSets() const;
@@ -109,6 +179,14 @@ namespace dnv::vista::sdk
 
 		[[nodiscard]] static bool isValid( const std::vector<GmodNode*>& parents, const GmodNode& node );
 		[[nodiscard]] static bool isValid( const std::vector<GmodNode*>& parents, const GmodNode& node, int& missingLinkAt );
+
+		/**
+		 * @brief Checks if nodes form a path from the root.
+		 * @param nodes The nodes, from the root to the target node.
+		 * @param missingLinkAt Set to the index of the first node that is not a parent of the next one, or -1.
+		 * @return True if `nodes` has at least two nodes, starts with the root and every node is a parent of the next one.
+		 */
+		[[nodiscard]] static bool isValid( std::span<const GmodLocatedNode> nodes, int& missingLinkAt );
 		[[nodiscard]] bool isMappable() const;
 
 		[[nodiscard]] std::string toString() const;
@@ -135,6 +213,22 @@ namespace dnv::vista::sdk
 		[[nodiscard]] static bool tryParseFullPath( std::string_view item, VisVersion visVersion, std::optional<GmodPath>& outPath );
 		[[nodiscard]] static bool tryParseFullPath( std::string_view item, const Gmod& gmod, const Locations& locations, std::optional<GmodPath>& outPath );
 
+		/**
+		 * @brief Parses a batch of paths, by default on one worker per hardware thread.
+		 * @details Items are split into chunks that the workers claim and steal from each other.
+		 *          Each thread reuses its parse buffers across items. An item whose parse throws is
+		 *          reported as invalid with the exception message.
+		 * @param items The paths to parse.
+		 * @param gmod The GMOD to parse against.
+		 * @param locations The locations of the same VIS version.
+		 * @param options The path syntax and how to split the work.
+		 * @return One outcome per item, in input order.
+		 * @throws std::invalid_argument If `gmod` and `locations` have different VIS versions.
+		 */
+		[[nodiscard]] static std::vector<GmodPathParseOutcome> tryParseMany(
+			std::span<const std::string_view> items, const Gmod& gmod, const Locations& locations,
+			const GmodPathParseOptions& options = {} );
+
 		//----------------------------------------------
 		// Enumeration
 		//----------------------------------------------
@@ -148,9 +242,48 @@ namespace dnv::vista::sdk
 
 		VisVersion m_visVersion;
 		const Gmod* m_gmod;
-		GmodNode* m_node;
-		std::vector<GmodNode*> m_parents;
-		std::vector<GmodNode*> m_ownedNodes;
+
+		/** @brief Number of nodes, the target node included; 0 for an empty path. */
+		size_t m_length;
+
+		/** @brief Nodes of paths with at most `INLINE_PARENTS_CAPACITY` parents, from the root. */
+		std::array<GmodLocatedNode, INLINE_PARENTS_CAPACITY + 1> m_inlineNodes;
+
+		/** @brief Nodes of deeper paths; empty otherwise. */
+		std::vector<GmodLocatedNode> m_heapNodes;
+
+		/** @brief The nodes as `GmodNode` pointers, created on first use; null until then. */
+		mutable std::atomic<const internal::PathNodes*> m_pathNodes;
+
+	private:
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		[[nodiscard]] const GmodLocatedNode* nodesData() const noexcept;
+		[[nodiscard]] GmodLocatedNode* nodesData() noexcept;
+
+		/**
+		 * @brief Resizes the path, discarding its nodes.
+		 * @param length The new number of nodes.
+		 * @return The nodes, to be filled by the caller.
+		 */
+		GmodLocatedNode* resizeNodes( size_t length );
+
+		void setNodes( std::span<const GmodLocatedNode> nodes );
+
+		/** @brief Gets the nodes as `GmodNode` pointers, creating them on first use. */
+		[[nodiscard]] const internal::PathNodes& pathNodes() const;
+
+		/** @brief Discards the `GmodNode` pointers, before the nodes are modified. */
+		void resetPathNodes() noexcept;
+
+		/**
+		 * @brief Checks that the nodes form a path from the root, with consistent locations.
+		 * @throws std::invalid_argument If they do not form a path from the root.
+		 * @throws std::runtime_error If an individualizable set has different locations.
+		 */
+		void validate() const;
 
 	private:
 		//----------------------------------------------
@@ -305,6 +438,22 @@ namespace dnv::vista::sdk
 		bool m_isBuilt;
 	};
 
+	//=====================================================================
+	// GmodPathParseOutcome struct
+	//=====================================================================
+
+	/**
+	 * @brief Outcome of parsing one item with `GmodPath::tryParseMany()`.
+	 */
+	struct GmodPathParseOutcome
+	{
+		/** @brief The parsed path; empty if the item is invalid. */
+		std::optional<GmodPath> path;
+
+		/** @brief Why the item is invalid; empty if it parsed. */
+		std::string error;
+	};
+
 	//=====================================================================
 	// GmodParsePathResult class
 	//=====================================================================
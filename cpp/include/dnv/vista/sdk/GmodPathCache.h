@@ -0,0 +1,185 @@
+/**
+ * @file GmodPathCache.h
+ * @brief Bounded, thread-safe memo of short GMOD path parses.
+ * @details Defines `GmodPathCache`, an optional front for `GmodPath::tryParse()` and
+ *          `Gmod::tryParsePath()` for feeds in which the same paths recur: a repeated parse is
+ *          answered by a hash lookup and a shared pointer copy instead of a GMOD search.
+ */
+
+#pragma once
+
+#include "GmodPath.h"
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// Forward declarations
+	//=====================================================================
+
+	class Gmod;
+	class Locations;
+
+	enum class VisVersion;
+
+	//=====================================================================
+	// GmodPathCache class
+	//=====================================================================
+
+	/**
+	 * @brief Sharded cache of parsed short paths, keyed by VIS version and normalized path string.
+	 * @details Keys are trimmed of surrounding whitespace and of a leading '/', as `GmodPath::tryParse()`
+	 *          does, so equivalent spellings share an entry. Only successful parses are stored, as
+	 *          immutable `std::shared_ptr<const GmodPath>` that callers may keep after eviction.
+	 *
+	 *          Each shard holds a fixed number of slots and evicts with the CLOCK algorithm: a hit
+	 *          sets the slot's reference bit, and the eviction hand clears set bits until it finds a
+	 *          slot that was not used since its last pass. Hits take the shard lock shared and only
+	 *          touch atomics, so concurrent readers do not serialize.
+	 *
+	 *          Entries are tied to the `Gmod::instanceId()` of the `Gmod` they were parsed against, so
+	 *          a lookup with another `Gmod` of the same version is a miss, even one constructed at the
+	 *          address of a destroyed `Gmod`. Paths of a destroyed `Gmod` are never returned, but stay
+	 *          in the cache until evicted or `clear()` is called.
+	 */
+	class GmodPathCache final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Default total number of cached paths. */
+		static constexpr size_t DEFAULT_CAPACITY{ 16384 };
+
+		/** @brief Default number of independently locked shards. */
+		static constexpr size_t DEFAULT_SHARD_COUNT{ 16 };
+
+		//----------------------------------------------
+		// Types
+		//----------------------------------------------
+
+		/** @brief Counters of a cache, summed over its shards. */
+		struct Statistics
+		{
+			/** @brief Parses answered from the cache. */
+			uint64_t hits;
+
+			/** @brief Parses that had to search the GMOD, including failed ones. */
+			uint64_t misses;
+
+			/** @brief Entries dropped to make room for new ones. */
+			uint64_t evictions;
+
+			/** @brief Entries currently held. */
+			size_t size;
+		};
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		/**
+		 * @brief Constructs an empty cache.
+		 * @param capacity Total number of paths to hold; rounded up to a multiple of the shard count.
+		 * @param shardCount Number of shards; rounded up to a power of two.
+		 * @throws std::invalid_argument If `capacity` or `shardCount` is 0.
+		 */
+		explicit GmodPathCache( size_t capacity = DEFAULT_CAPACITY, size_t shardCount = DEFAULT_SHARD_COUNT );
+
+		/** @brief Copy constructor */
+		GmodPathCache( const GmodPathCache& ) = delete;
+
+		/** @brief Move constructor */
+		GmodPathCache( GmodPathCache&& ) noexcept = delete;
+
+		/** @brief Destructor */
+		~GmodPathCache();
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		GmodPathCache& operator=( const GmodPathCache& ) = delete;
+
+		/** @brief Move assignment operator */
+		GmodPathCache& operator=( GmodPathCache&& ) noexcept = delete;
+
+		//----------------------------------------------
+		// Parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parses a short path, answering from the cache when possible.
+		 * @param item The path string.
+		 * @param gmod The GMOD to parse against.
+		 * @param locations The locations of the same VIS version.
+		 * @param[out] outPath Receives the parsed path, or `nullptr` if `item` is invalid.
+		 * @return True if `item` is a valid path.
+		 */
+		[[nodiscard]] bool tryParse( std::string_view item, const Gmod& gmod, const Locations& locations, std::shared_ptr<const GmodPath>& outPath );
+
+		/**
+		 * @brief Parses a short path against the GMOD and locations of a VIS version.
+		 * @param item The path string.
+		 * @param visVersion The VIS version.
+		 * @param[out] outPath Receives the parsed path, or `nullptr` if `item` is invalid.
+		 * @return True if `item` is a valid path.
+		 */
+		[[nodiscard]] bool tryParse( std::string_view item, VisVersion visVersion, std::shared_ptr<const GmodPath>& outPath );
+
+		/**
+		 * @brief Parses a short path against a GMOD and the locations of its VIS version.
+		 * @param item The path string.
+		 * @param gmod The GMOD to parse against.
+		 * @param[out] outPath Receives the parsed path, or `nullptr` if `item` is invalid.
+		 * @return True if `item` is a valid path.
+		 */
+		[[nodiscard]] bool tryParse( std::string_view item, const Gmod& gmod, std::shared_ptr<const GmodPath>& outPath );
+
+		//----------------------------------------------
+		// Management
+		//----------------------------------------------
+
+		/** @brief Removes all entries; counters are kept. */
+		void clear();
+
+		/**
+		 * @brief Gets the counters.
+		 * @return The counters; each is read atomically, but not all at the same instant.
+		 */
+		[[nodiscard]] Statistics statistics() const;
+
+		/**
+		 * @brief Gets the maximum number of entries.
+		 * @return The capacity after rounding.
+		 */
+		[[nodiscard]] size_t capacity() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Shard
+		//----------------------------------------------
+
+		struct Shard;
+
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		[[nodiscard]] Shard& shardOf( size_t hash ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief The shards; their count is a power of two. */
+		std::unique_ptr<Shard[]> m_shards;
+
+		/** @brief Shard count minus one. */
+		size_t m_shardMask;
+
+		/** @brief Slots per shard. */
+		size_t m_shardCapacity;
+	};
+}
@@ -0,0 +1,396 @@
+/**
+ * @file GmodSnapshot.h
+ * @brief Binary GMOD cache file.
+ * @details This file defines the GmodSnapshot class and its on-disk record layout. A snapshot
+ *          is a binary cache of a fully linked Gmod: every node (code, metadata strings, normal
+ *          assignment names), the parent/child edges in their original order and the CHD seed
+ *          table of the node dictionary. Building a Gmod from it involves no decompression, no
+ *          JSON parsing and no perfect hash seed search, but the nodes are still copied into
+ *          the Gmod; the file is not used in place once the Gmod has been built. The header
+ *          records the CRC-32 of the GMOD resource the cache was built from, so a cache that
+ *          no longer matches its resource can be recognized and ignored.
+ */
+
+#pragma once
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// Forward declarations
+	//=====================================================================
+
+	enum class VisVersion;
+	class Gmod;
+
+	namespace internal
+	{
+		//=====================================================================
+		// Snapshot file layout
+		//=====================================================================
+
+		/*
+		 * File layout (little-endian, every section aligned to 8 bytes):
+		 *
+		 *   GmodSnapshotHeader
+		 *   GmodSnapshotNode       [nodeCount]        nodes in ascending table slot order
+		 *   int32_t                [tableSize]        CHD seed table
+		 *   uint32_t               [tableSize]        table slot -> node index (GMOD_SNAPSHOT_NPOS if empty)
+		 *   uint32_t               [edgeCount]        node indices referenced by children/parents ranges
+		 *   GmodSnapshotAssignment [assignmentCount]  normal assignment name pairs
+		 *   char                   [stringsSize]      de-duplicated string blob
+		 */
+
+		/** @brief Magic bytes identifying a GMOD snapshot file. */
+		static constexpr std::array<char, 8> GMOD_SNAPSHOT_MAGIC{ 'V', 'I', 'S', 'G', 'M', 'O', 'D', '\0' };
+
+		/** @brief Marker for an absent string, an empty slot or a failed lookup. */
+		static constexpr uint32_t GMOD_SNAPSHOT_NPOS{ std::numeric_limits<uint32_t>::max() };
+
+		/** @brief Reference to a string stored in the snapshot string blob. */
+		struct GmodSnapshotString
+		{
+			/** @brief Offset within the string blob, or GMOD_SNAPSHOT_NPOS for `std::nullopt`. */
+			uint32_t offset;
+
+			/** @brief Length of the string in bytes. */
+			uint32_t length;
+		};
+
+		/** @brief Fixed-size file header. */
+		struct GmodSnapshotHeader
+		{
+			std::array<char, 8> magic;
+			uint32_t formatVersion;
+			uint32_t visVersion;
+			uint32_t nodeCount;
+			uint32_t tableSize;
+			uint32_t edgeCount;
+			uint32_t assignmentCount;
+			uint64_t nodesOffset;
+			uint64_t seedsOffset;
+			uint64_t slotsOffset;
+			uint64_t edgesOffset;
+			uint64_t assignmentsOffset;
+			uint64_t stringsOffset;
+			uint64_t stringsSize;
+			uint64_t fileSize;
+
+			/** @brief CRC-32 of everything following the header. */
+			uint32_t checksum;
+
+			/** @brief CRC-32 of the GMOD resource file the snapshot was built from, or 0 if not recorded. */
+			uint32_t sourceChecksum;
+		};
+
+		/** @brief One GMOD node with references into the string blob and edge array. */
+		struct GmodSnapshotNode
+		{
+			uint32_t slot;
+			GmodSnapshotString code;
+			GmodSnapshotString category;
+			GmodSnapshotString type;
+			GmodSnapshotString name;
+			GmodSnapshotString commonName;
+			GmodSnapshotString definition;
+			GmodSnapshotString commonDefinition;
+			uint32_t childrenOffset;
+			uint32_t childrenCount;
+			uint32_t parentsOffset;
+			uint32_t parentsCount;
+			uint32_t assignmentsOffset;
+			uint32_t assignmentsCount;
+
+			/** @brief 0 = not set, 1 = false, 2 = true. */
+			uint8_t installSubstructure;
+			std::array<uint8_t, 3> reserved;
+		};
+
+		/** @brief One normal assignment name (key/value) pair. */
+		struct GmodSnapshotAssignment
+		{
+			GmodSnapshotString key;
+			GmodSnapshotString value;
+		};
+
+		static_assert( std::is_trivially_copyable_v<GmodSnapshotHeader> && sizeof( GmodSnapshotHeader ) == 104 );
+		static_assert( std::is_trivially_copyable_v<GmodSnapshotNode> && sizeof( GmodSnapshotNode ) == 88 );
+		static_assert( std::is_trivially_copyable_v<GmodSnapshotAssignment> && sizeof( GmodSnapshotAssignment ) == 16 );
+	}
+
+	//=====================================================================
+	// GmodSnapshotValidation enumeration
+	//=====================================================================
+
+	/**
+	 * @brief Selects how much of a snapshot file `GmodSnapshot::open()` checks.
+	 */
+	enum class GmodSnapshotValidation
+	{
+		/**
+		 * @brief Header, section bounds and every record reference; enough to read the file safely,
+		 *        but corrupted content such as a changed string goes unnoticed.
+		 */
+		Structure,
+
+		/** @brief Additionally the CRC-32 of the whole file. The default. */
+		Full
+	};
+
+	//=====================================================================
+	// GmodSnapshot class
+	//=====================================================================
+
+	/**
+	 * @brief Read-only view of a binary GMOD cache file.
+	 * @details Snapshots are produced once with `write()` (see the GmodSnapshotBuilder tool, which
+	 *          writes them next to the resources at build time) and then opened with `open()`.
+	 *          The file is memory-mapped while the view exists. The view can be queried directly
+	 *          (node lookup by code through the stored CHD seeds, metadata strings and edge
+	 *          ranges), or handed to `Gmod( const GmodSnapshot& )`, which copies it into a fully
+	 *          linked Gmod without any parsing; the view is not needed afterwards.
+	 *          Instances are movable but not copyable; the mapping is released on destruction.
+	 */
+	class GmodSnapshot final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Current snapshot format version. Files with a different version are rejected. */
+		static constexpr uint32_t FORMAT_VERSION{ 2 };
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		/** @brief Default constructor. */
+		GmodSnapshot() = delete;
+
+		/** @brief Copy constructor */
+		GmodSnapshot( const GmodSnapshot& ) = delete;
+
+		/** @brief Move constructor */
+		GmodSnapshot( GmodSnapshot&& other ) noexcept;
+
+		/** @brief Destructor. Unmaps the file. */
+		~GmodSnapshot();
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		GmodSnapshot& operator=( const GmodSnapshot& ) = delete;
+
+		/** @brief Move assignment operator */
+		GmodSnapshot& operator=( GmodSnapshot&& other ) noexcept;
+
+		//----------------------------------------------
+		// Static factory methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Memory-maps and validates a snapshot file.
+		 * @param path Path of the snapshot file.
+		 * @param validation What to check; the checksum is only verified with `GmodSnapshotValidation::Full`.
+		 * @return The mapped snapshot.
+		 * @throws std::runtime_error If the file cannot be mapped or is not a valid snapshot.
+		 */
+		[[nodiscard]] static GmodSnapshot open(
+			const std::filesystem::path& path, GmodSnapshotValidation validation = GmodSnapshotValidation::Full );
+
+		/**
+		 * @brief Memory-maps and validates a snapshot file without throwing.
+		 * @param path Path of the snapshot file.
+		 * @param[out] snapshot Set to the mapped snapshot on success.
+		 * @param validation What to check; the checksum is only verified with `GmodSnapshotValidation::Full`.
+		 * @return True if the snapshot was opened, false otherwise.
+		 */
+		static bool tryOpen( const std::filesystem::path& path, std::optional<GmodSnapshot>& snapshot,
+			GmodSnapshotValidation validation = GmodSnapshotValidation::Full ) noexcept;
+
+		/**
+		 * @brief Serializes a Gmod into a snapshot file.
+		 * @param gmod The GMOD to serialize.
+		 * @param path Destination path. An existing file is replaced.
+		 * @param resourceChecksum The `fileChecksum()` of the GMOD resource `gmod` was built from,
+		 *        or 0 if there is none.
+		 * @throws std::runtime_error If the file cannot be written.
+		 */
+		static void write( const Gmod& gmod, const std::filesystem::path& path, uint32_t resourceChecksum = 0 );
+
+		/**
+		 * @brief Computes the CRC-32 of a whole file, as stored in the snapshot header for the GMOD resource.
+		 * @param path Path of the file.
+		 * @return The CRC-32 of the file content.
+		 * @throws std::runtime_error If the file cannot be read.
+		 */
+		[[nodiscard]] static uint32_t fileChecksum( const std::filesystem::path& path );
+
+		/**
+		 * @brief Gets the conventional snapshot file name for a VIS version.
+		 * @param visVersion The VIS version.
+		 * @return The file name, e.g. "gmod-vis-3-4a.snapshot".
+		 */
+		[[nodiscard]] static std::string fileName( VisVersion visVersion );
+
+		/**
+		 * @brief Gets the name of the GMOD resource a snapshot of a VIS version is built from.
+		 * @param visVersion The VIS version.
+		 * @return The resource name, e.g. "gmod-vis-3-4a.json.gz".
+		 */
+		[[nodiscard]] static std::string sourceFileName( VisVersion visVersion );
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the VIS version of the snapshotted GMOD.
+		 * @return The VisVersion enum value.
+		 */
+		[[nodiscard]] inline VisVersion visVersion() const noexcept;
+
+		/**
+		 * @brief Gets the number of nodes in the snapshot.
+		 * @return The node count.
+		 */
+		[[nodiscard]] inline size_t nodeCount() const noexcept;
+
+		/**
+		 * @brief Gets the size of the CHD table (power of 2, at least twice the node count).
+		 * @return The table size.
+		 */
+		[[nodiscard]] inline size_t tableSize() const noexcept;
+
+		/**
+		 * @brief Gets the checksum of the GMOD resource the snapshot was built from.
+		 * @details Compare it with `fileChecksum()` of the resource to detect a stale snapshot.
+		 * @return The CRC-32 of the resource file, or 0 if it was not recorded.
+		 */
+		[[nodiscard]] inline uint32_t sourceChecksum() const noexcept;
+
+		/**
+		 * @brief Gets the node records, in ascending table slot order.
+		 * @return A span over the mapped node records.
+		 */
+		[[nodiscard]] inline std::span<const internal::GmodSnapshotNode> nodes() const noexcept;
+
+		/**
+		 * @brief Gets the CHD seed table.
+		 * @return A span over the mapped seeds, one per table slot.
+		 */
+		[[nodiscard]] inline std::span<const int32_t> seeds() const noexcept;
+
+		/**
+		 * @brief Gets the table slot to node index map.
+		 * @return A span with one node index per table slot, GMOD_SNAPSHOT_NPOS for empty slots.
+		 */
+		[[nodiscard]] inline std::span<const uint32_t> slots() const noexcept;
+
+		//----------------------------------------------
+		// In-place record access
+		//----------------------------------------------
+
+		/**
+		 * @brief Resolves a string reference against the mapped string blob.
+		 * @param ref The string reference.
+		 * @return A view into the mapped file; empty for absent strings.
+		 */
+		[[nodiscard]] inline std::string_view string( const internal::GmodSnapshotString& ref ) const noexcept;
+
+		/**
+		 * @brief Resolves an optional string reference against the mapped string blob.
+		 * @param ref The string reference.
+		 * @return A view into the mapped file, or std::nullopt for absent strings.
+		 */
+		[[nodiscard]] inline std::optional<std::string_view> optionalString( const internal::GmodSnapshotString& ref ) const noexcept;
+
+		/**
+		 * @brief Gets the child node indices of a node, in GMOD order.
+		 * @param node The node record.
+		 * @return A span of node indices.
+		 */
+		[[nodiscard]] inline std::span<const uint32_t> children( const internal::GmodSnapshotNode& node ) const noexcept;
+
+		/**
+		 * @brief Gets the parent node indices of a node, in GMOD order.
+		 * @param node The node record.
+		 * @return A span of node indices.
+		 */
+		[[nodiscard]] inline std::span<const uint32_t> parents( const internal::GmodSnapshotNode& node ) const noexcept;
+
+		/**
+		 * @brief Gets the normal assignment names of a node.
+		 * @param node The node record.
+		 * @return A span of key/value string reference pairs.
+		 */
+		[[nodiscard]] inline std::span<const internal::GmodSnapshotAssignment> assignments( const internal::GmodSnapshotNode& node ) const noexcept;
+
+		//----------------------------------------------
+		// Node query methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Looks up a node by code directly in the mapped CHD table.
+		 * @param code The node code.
+		 * @param[out] index Set to the node index if found, otherwise GMOD_SNAPSHOT_NPOS.
+		 * @return True if the node was found, false otherwise.
+		 */
+		[[nodiscard]] bool tryFindNode( std::string_view code, uint32_t& index ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Takes ownership of a mapped region and validates it.
+		 * @param data Start of the mapped region.
+		 * @param size Size of the mapped region in bytes.
+		 * @param validation What to check.
+		 * @throws std::runtime_error If the region is not a valid snapshot. The region is unmapped first.
+		 */
+		GmodSnapshot( const std::byte* data, size_t size, GmodSnapshotValidation validation );
+
+		/**
+		 * @brief Validates header, section bounds and every record reference, and with
+		 *        `GmodSnapshotValidation::Full` the checksum.
+		 * @param validation What to check.
+		 * @throws std::runtime_error On the first inconsistency found.
+		 */
+		void validate( GmodSnapshotValidation validation ) const;
+
+		/** @brief Releases the mapping, if any. */
+		void unmap() noexcept;
+
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Reinterprets a section of the mapped region.
+		 * @tparam T The record type.
+		 * @param offset Byte offset of the section.
+		 * @return A pointer to the first record.
+		 */
+		template <typename T>
+		[[nodiscard]] inline const T* section( uint64_t offset ) const noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Start of the read-only mapped region. */
+		const std::byte* m_data;
+
+		/** @brief Size of the mapped region in bytes. */
+		size_t m_size;
+
+		/** @brief Header at the start of the mapped region. */
+		const internal::GmodSnapshotHeader* m_header;
+	};
+}
+
+#include "GmodSnapshot.inl"
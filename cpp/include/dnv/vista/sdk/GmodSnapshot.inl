@@ -0,0 +1,99 @@
+/**
+ * @file GmodSnapshot.inl
+ * @brief Inline implementations for in-place GmodSnapshot record access
+ */
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// GmodSnapshot class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	inline VisVersion GmodSnapshot::visVersion() const noexcept
+	{
+		return static_cast<VisVersion>( m_header->visVersion );
+	}
+
+	inline size_t GmodSnapshot::nodeCount() const noexcept
+	{
+		return m_header->nodeCount;
+	}
+
+	inline size_t GmodSnapshot::tableSize() const noexcept
+	{
+		return m_header->tableSize;
+	}
+
+	inline uint32_t GmodSnapshot::sourceChecksum() const noexcept
+	{
+		return m_header->sourceChecksum;
+	}
+
+	inline std::span<const internal::GmodSnapshotNode> GmodSnapshot::nodes() const noexcept
+	{
+		return { section<internal::GmodSnapshotNode>( m_header->nodesOffset ), m_header->nodeCount };
+	}
+
+	inline std::span<const int32_t> GmodSnapshot::seeds() const noexcept
+	{
+		return { section<int32_t>( m_header->seedsOffset ), m_header->tableSize };
+	}
+
+	inline std::span<const uint32_t> GmodSnapshot::slots() const noexcept
+	{
+		return { section<uint32_t>( m_header->slotsOffset ), m_header->tableSize };
+	}
+
+	//----------------------------------------------
+	// In-place record access
+	//----------------------------------------------
+
+	inline std::string_view GmodSnapshot::string( const internal::GmodSnapshotString& ref ) const noexcept
+	{
+		if ( ref.offset == internal::GMOD_SNAPSHOT_NPOS )
+		{
+			return {};
+		}
+
+		return { section<char>( m_header->stringsOffset ) + ref.offset, ref.length };
+	}
+
+	inline std::optional<std::string_view> GmodSnapshot::optionalString( const internal::GmodSnapshotString& ref ) const noexcept
+	{
+		if ( ref.offset == internal::GMOD_SNAPSHOT_NPOS )
+		{
+			return std::nullopt;
+		}
+
+		return string( ref );
+	}
+
+	inline std::span<const uint32_t> GmodSnapshot::children( const internal::GmodSnapshotNode& node ) const noexcept
+	{
+		return { section<uint32_t>( m_header->edgesOffset ) + node.childrenOffset, node.childrenCount };
+	}
+
+	inline std::span<const uint32_t> GmodSnapshot::parents( const internal::GmodSnapshotNode& node ) const noexcept
+	{
+		return { section<uint32_t>( m_header->edgesOffset ) + node.parentsOffset, node.parentsCount };
+	}
+
+	inline std::span<const internal::GmodSnapshotAssignment> GmodSnapshot::assignments( const internal::GmodSnapshotNode& node ) const noexcept
+	{
+		return { section<internal::GmodSnapshotAssignment>( m_header->assignmentsOffset ) + node.assignmentsOffset, node.assignmentsCount };
+	}
+
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
+
+	template <typename T>
+	inline const T* GmodSnapshot::section( uint64_t offset ) const noexcept
+	{
+		return reinterpret_cast<const T*>( m_data + offset );
+	}
+}
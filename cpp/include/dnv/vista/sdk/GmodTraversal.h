@@ -41,6 +41,35 @@ namespace dnv::vista::sdk
 		size_t maxTraversalOccurrence = DEFAULT_MAX_TRAVERSAL_OCCURRENCE;
 	};
 
+	/**
+	 * @struct ParallelTraversalOptions
+	 * @brief Configuration of `GmodTraversal::traverseParallel()`
+	 */
+	struct ParallelTraversalOptions : TraversalOptions
+	{
+		/**
+		 * @brief Runs `task( worker )` for the workers `[0, workerCount)`, possibly concurrently, and
+		 *        returns once every call it made has finished.
+		 * @details Workers steal subtrees from each other, so all of them are traversed as long as at
+		 *          least one worker runs; the executor may run fewer, or run them one after the other.
+		 */
+		using Executor = std::function<void( size_t workerCount, const std::function<void( size_t worker )>& task )>;
+
+		static constexpr size_t DEFAULT_SPLIT_DEPTH = 4;
+
+		/** @brief Depth of the nodes whose subtrees are traversed as separate tasks; the root has depth 0. */
+		size_t splitDepth = DEFAULT_SPLIT_DEPTH;
+
+		/** @brief Number of workers; 0 uses the hardware concurrency. */
+		size_t threadCount = 0;
+
+		/**
+		 * @brief Runs the workers. When empty, worker 0 runs on the calling thread and the others on
+		 *        `std::async` threads.
+		 */
+		Executor executor{};
+	};
+
 	/**
 	 * @typedef TraverseHandler
 	 * @brief Function pointer for stateless traversal handlers
@@ -55,6 +84,15 @@ namespace dnv::vista::sdk
 	template <typename TState>
 	using TraverseHandlerWithState = TraversalHandlerResult ( * )( TState& state, const std::vector<const GmodNode*>& parents, const GmodNode& node );
 
+	/**
+	 * @concept TraverseCallable
+	 * @brief Handler type called directly by the traversal, so that it can be inlined
+	 * @details Satisfied by lambdas (capturing or not), function objects and function pointers
+	 *          with the signature of `TraverseHandler`.
+	 */
+	template <typename THandler>
+	concept TraverseCallable = std::is_invocable_r_v<TraversalHandlerResult, THandler&, const std::vector<const GmodNode*>&, const GmodNode&>;
+
 	//=====================================================================
 	// Traversal algorithms
 	//=====================================================================
@@ -80,7 +118,9 @@ namespace dnv::vista::sdk
 			/**
 			 * @class Parents
 			 * @brief Optimized parent stack with occurrence tracking
-			 * @details Pre-allocated for 64 parents and 4 occurrence entries.
+			 * @details Pre-allocated for 64 parents; occurrences are counted per graph node index.
+			 *          Each parent also holds the position of the next of its children to visit,
+			 *          which makes the stack the whole state of an iterative traversal.
 			 */
 			class Parents
 			{
@@ -89,27 +129,39 @@ namespace dnv::vista::sdk
 				// Construction / destruction
 				//----------------------------
 
-				/** @brief Default constructor. */
-				Parents();
+				/**
+				 * @brief Constructor.
+				 * @param nodeCount Number of nodes in the traversed graph.
+				 */
+				explicit Parents( size_t nodeCount );
 
 				//----------------------------
 				// Stack operations
 				//----------------------------
 
 				/** @brief Push parent and update occurrence count */
-				void push( const GmodNode* parent );
+				inline void push( const GmodNode* parent, uint32_t index );
 
 				/** @brief Pop parent and update occurrence count */
-				void pop();
+				inline void pop();
 
-				/** @brief Get occurrence count for node */
-				[[nodiscard]] size_t occurrences( const GmodNode& node ) const noexcept;
+				/** @brief Get occurrence count for node index */
+				[[nodiscard]] inline size_t occurrences( uint32_t index ) const noexcept;
 
-				/** @brief Get last parent or nullptr */
-				[[nodiscard]] const GmodNode* lastOrDefault() const noexcept;
+				/** @brief Check if the stack is empty */
+				[[nodiscard]] inline bool empty() const noexcept;
+
+				/** @brief Get number of parents */
+				[[nodiscard]] inline size_t size() const noexcept;
+
+				/** @brief Get graph index of last parent; the stack must not be empty */
+				[[nodiscard]] inline uint32_t lastIndex() const noexcept;
+
+				/** @brief Get position of the next child of last parent to visit; the stack must not be empty */
+				[[nodiscard]] inline uint32_t& nextChild() noexcept;
 
 				/** @brief Get complete parent chain */
-				[[nodiscard]] const std::vector<const GmodNode*>& asList() const noexcept;
+				[[nodiscard]] inline const std::vector<const GmodNode*>& asList() const noexcept;
 
 			private:
 				//----------------------------
@@ -119,106 +171,155 @@ namespace dnv::vista::sdk
 				/** @brief Parent chain from root to current */
 				std::vector<const GmodNode*> m_parents;
 
-				/** @brief Occurrence count per node code */
-				std::unordered_map<std::string_view, size_t> m_occurrences;
+				/** @brief Graph indices of `m_parents` */
+				std::vector<uint32_t> m_indices;
+
+				/** @brief Next child position of each of `m_parents` */
+				std::vector<uint32_t> m_nextChildren;
+
+				/** @brief Occurrence count per graph node index */
+				std::vector<uint32_t> m_occurrences;
 			};
 
 			//----------------------------------------------
-			// TraversalContext struct
+			// Core algorithm
 			//----------------------------------------------
 
 			/**
-			 * @struct TraversalContext
-			 * @brief Bundles traversal state for optimal performance
-			 * @tparam TState User-defined state type
+			 * @brief Core iterative traversal
+			 * @details Depth-first, in the order of the children of each node. The parent stack is the
+			 *          only traversal state, so no call is made per node other than to the handler, which
+			 *          is inlined when it is a lambda or function object. Children and node classification
+			 *          come from the CSR graph, so only visited nodes are dereferenced.
+			 * @tparam THandler Callable as `TraversalHandlerResult( const std::vector<const GmodNode*>&, const GmodNode& )`
+			 * @param graph Graph of the traversed GMOD
+			 * @param parents Parent stack sized for `graph`, holding the parents of the start node
+			 * @param index Graph index of the node to start from
+			 * @param handler Handler called for each visited node
+			 * @param maxTraversalOccurrence Maximum occurrences of a node in the parent chain
+			 * @return Traversal result of the start node
 			 */
-			template <typename TState>
-			struct TraversalContext
-			{
-				Parents& parents;
-				TraverseHandlerWithState<TState> handler;
-				TState& state;
-				size_t maxTraversalOccurrence;
-
-				explicit TraversalContext( Parents& p, TraverseHandlerWithState<TState> h, TState& s, size_t maxOcc )
-					: parents( p ), handler( h ), state( s ), maxTraversalOccurrence( maxOcc ) {}
-
-				TraversalContext() = delete;
-				TraversalContext( const TraversalContext& ) = delete;
-				TraversalContext( TraversalContext&& ) noexcept = delete;
-				~TraversalContext() = default;
-				TraversalContext& operator=( const TraversalContext& ) = delete;
-				TraversalContext& operator=( TraversalContext&& ) noexcept = delete;
-			};
+			template <typename THandler>
+			[[nodiscard]] inline TraversalHandlerResult traverseIterative(
+				const internal::GmodGraph& graph, Parents& parents, uint32_t index, THandler& handler, size_t maxTraversalOccurrence );
 
 			//----------------------------------------------
-			// Core algorithm
+			// GmodTraversal::Cursor class
 			//----------------------------------------------
 
 			/**
-			 * @brief Core recursive traversal with optimizations
-			 * @details Performance-critical hot path with branch prediction hints
-			 * @tparam TState User-defined state type
-			 * @param context Traversal context
-			 * @param node Current node to traverse
-			 * @return Traversal result
+			 * @class Cursor
+			 * @brief Resumable form of `traverseIterative()`
+			 * @details Stops at each node the traversal would pass to its handler, as if the handler
+			 *          returned `Continue`. The occurrence check and push of a node are deferred to the
+			 *          next step, so the parents of the current node are the top of the stack.
 			 */
-			template <typename TState>
-			[[nodiscard]] TraversalHandlerResult traverseNodeRecursive( TraversalContext<TState>& context, const GmodNode& node )
+			class Cursor
 			{
-				if ( node.metadata().installSubstructure().has_value() && !node.metadata().installSubstructure().value() )
-				{
-					return TraversalHandlerResult::Continue;
-				}
+			public:
+				//----------------------------
+				// Construction / destruction
+				//----------------------------
 
-				TraversalHandlerResult result = context.handler( context.state, context.parents.asList(), node );
-				if ( result == TraversalHandlerResult::Stop || result == TraversalHandlerResult::SkipSubtree )
-				{
-					return result;
-				}
+				/**
+				 * @brief Constructor.
+				 * @param rootNode Starting node
+				 * @param maxTraversalOccurrence Maximum occurrences of a node in the parent chain
+				 */
+				Cursor( const GmodNode& rootNode, size_t maxTraversalOccurrence );
 
-				bool skipOccurrenceCheck = Gmod::isProductSelectionAssignment( context.parents.lastOrDefault(), &node );
-				if ( !skipOccurrenceCheck )
-				{
-					size_t occ = context.parents.occurrences( node );
+				//----------------------------
+				// Iteration
+				//----------------------------
 
-					if ( occ == context.maxTraversalOccurrence )
-					{
-						return TraversalHandlerResult::SkipSubtree;
-					}
+				/**
+				 * @brief Move to the next visited node
+				 * @return false once the traversal is over
+				 */
+				inline bool next();
 
-					if ( occ > context.maxTraversalOccurrence )
-					{
-						throw std::runtime_error( "Invalid state - node occurred more than expected" );
-					}
-				}
+				/** @brief Get current node; only valid after `next()` returned true */
+				[[nodiscard]] inline const GmodNode& node() const noexcept;
 
-				context.parents.push( &node );
+				/** @brief Get parents of current node, root first */
+				[[nodiscard]] inline std::span<const GmodNode* const> parents() const noexcept;
 
-				const auto& children = node.children();
-				for ( const auto* child : children )
-				{
-					if ( !child )
-					{
-						continue;
-					}
-
-					result = traverseNodeRecursive( context, *child );
-					if ( result == TraversalHandlerResult::Stop )
-					{
-						context.parents.pop();
-						return TraversalHandlerResult::Stop;
-					}
-					else if ( result == TraversalHandlerResult::SkipSubtree )
-					{
-						continue;
-					}
-				}
+			private:
+				//----------------------------
+				// Private member variables
+				//----------------------------
 
-				context.parents.pop();
+				/** @brief Graph of the traversed GMOD, or `nullptr` for a node outside of a Gmod */
+				const internal::GmodGraph* m_graph;
 
-				return TraversalHandlerResult::Continue;
-			}
+				/** @brief Parent stack */
+				Parents m_parents;
+
+				/** @brief Current node */
+				const GmodNode* m_node;
+
+				/** @brief Graph index of current node */
+				uint32_t m_index;
+
+				/** @brief Maximum occurrences of a node in the parent chain */
+				size_t m_maxTraversalOccurrence;
+
+				/** @brief Whether `next()` has not been called yet */
+				bool m_atStart;
+
+				/** @brief Whether the children of current node are still to be visited */
+				bool m_pending;
+			};
+
+			//----------------------------------------------
+			// Parallel traversal
+			//----------------------------------------------
+
+			/**
+			 * @struct SubtreeTasks
+			 * @brief Subtrees of a parallel traversal, each with the parent chain leading to it
+			 */
+			struct SubtreeTasks
+			{
+				/** @brief Graph index of the start node of each task */
+				std::vector<uint32_t> nodes;
+
+				/** @brief Graph indices of the parents of each task, root first, concatenated */
+				std::vector<uint32_t> parents;
+
+				/** @brief Start of each task in `parents`; one entry per task plus one */
+				std::vector<uint32_t> parentOffsets{ 0 };
+
+				/** @brief Add a task */
+				void add( const std::vector<const GmodNode*>& taskParents, uint32_t node );
+			};
+
+			/**
+			 * @brief Get number of workers of a parallel traversal
+			 * @param options Traversal configuration
+			 * @param taskCount Number of tasks
+			 */
+			[[nodiscard]] size_t parallelWorkerCount( const ParallelTraversalOptions& options, size_t taskCount );
+
+			/**
+			 * @brief Run the tasks of a parallel traversal on a work-stealing pool
+			 * @details Each worker has its own parent stack, filled with the parents of a task before
+			 *          `runTask` is called. Workers stop claiming tasks once `stopped` is set. The first
+			 *          exception thrown by a task sets `stopped` and is rethrown once all workers returned.
+			 * @param graph Graph of the traversed GMOD
+			 * @param tasks Tasks to run
+			 * @param workerCount Number of workers, from `parallelWorkerCount()`
+			 * @param executor Runs the workers
+			 * @param stopped Cancellation flag shared with the handlers
+			 * @param runTask Traverses the subtree of a task
+			 */
+			void runSubtreeTasks(
+				const internal::GmodGraph& graph,
+				const SubtreeTasks& tasks,
+				size_t workerCount,
+				const ParallelTraversalOptions::Executor& executor,
+				std::atomic<bool>& stopped,
+				const std::function<void( size_t worker, Parents& parents, uint32_t node )>& runTask );
 		}
 
 		//=====================================================================
@@ -249,6 +350,9 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Check if path exists between nodes
+		 * @details The parent chains leading from the last asset function of `fromPath` (or the root)
+		 *          to `to` are collected once per pair and kept in `Gmod::pathExistsIndex()`, so
+		 *          repeated searches are lookups.
 		 * @param gmodInstance GMOD instance
 		 * @param fromPath Source path
 		 * @param to Target node
@@ -261,46 +365,264 @@ namespace dnv::vista::sdk
 			const GmodNode& to,
 			std::vector<const GmodNode*>& remainingParents );
 
+		/**
+		 * @brief Count the nodes a traversal from a node visits
+		 * @details Equal to the number of handler calls of `traverse( node, handler, options )` with a
+		 *          handler that always continues, so it gives the number of paths ending under `node`
+		 *          and can pre-size their buffers. The counts of every node of the GMOD are computed on
+		 *          the first call for a given `options.maxTraversalOccurrence`, and kept in
+		 *          `Gmod::subtreeStatistics()`; later calls are O(1). Nodes outside a cycle of the GMOD
+		 *          are counted from the counts of their children, nodes on a cycle by a traversal
+		 *          that stops at the first node off the cycle.
+		 * @param gmodInstance GMOD instance of the node
+		 * @param node Starting node
+		 * @param options Traversal configuration
+		 * @return Number of nodes visited, `node` included; 0 if its substructure is not installed
+		 * @throws std::invalid_argument If `node` does not belong to `gmodInstance`
+		 */
+		[[nodiscard]] uint64_t pathCount( const Gmod& gmodInstance, const GmodNode& node, const TraversalOptions& options = {} );
+
+		/**
+		 * @brief Get the depth of the subtree a traversal from a node visits
+		 * @details Computed and kept together with `pathCount()`; later calls are O(1).
+		 * @param gmodInstance GMOD instance of the node
+		 * @param node Starting node
+		 * @param options Traversal configuration
+		 * @return Largest number of parents a visited node has, 0 if only `node` is visited
+		 * @throws std::invalid_argument If `node` does not belong to `gmodInstance`
+		 */
+		[[nodiscard]] size_t maxDepth( const Gmod& gmodInstance, const GmodNode& node, const TraversalOptions& options = {} );
+
 		//----------------------------------------------
 		// Zero-overhead template functions
 		//----------------------------------------------
 
 		/**
-		 * @brief Traverse GMOD tree from root with stateful handler
+		 * @brief Traverse GMOD tree from specific node with an inlined handler
+		 * @details Zero-overhead template for maximum performance: the handler is a template
+		 *          parameter of the traversal instead of a function pointer.
+		 * @tparam THandler Lambda or function object type
+		 * @param rootNode Starting node
+		 * @param handler Handler called for each visited node
+		 * @param options Traversal configuration
+		 * @return true if completed, false if stopped early
+		 */
+		template <TraverseCallable THandler>
+		bool traverse( const GmodNode& rootNode, THandler&& handler, const TraversalOptions& options = {} );
+
+		/**
+		 * @brief Traverse GMOD tree from root with an inlined handler
+		 * @details Zero-overhead template for maximum performance: the handler is a template
+		 *          parameter of the traversal instead of a function pointer.
+		 * @tparam THandler Lambda or function object type
+		 * @param gmodInstance GMOD instance to traverse
+		 * @param handler Handler called for each visited node
+		 * @param options Traversal configuration
+		 * @return true if completed, false if stopped early
+		 */
+		template <TraverseCallable THandler>
+		bool traverse( const Gmod& gmodInstance, THandler&& handler, const TraversalOptions& options = {} );
+
+		/**
+		 * @brief Traverse GMOD tree from specific node with stateful handler
 		 * @details Zero-overhead template for maximum performance
 		 * @tparam TState User-defined state type
-		 * @param gmodInstance GMOD instance to traverse
 		 * @param state User state reference
+		 * @param rootNode Starting node
 		 * @param handler Function pointer to stateful handler
 		 * @param options Traversal configuration
 		 * @return true if completed, false if stopped early
 		 */
 		template <typename TState>
-		bool traverse( TState& state, const Gmod& gmodInstance, TraverseHandlerWithState<TState> handler, const TraversalOptions& options = {} )
-		{
-			detail::Parents parentsStack;
-			detail::TraversalContext<TState> context( parentsStack, handler, state, options.maxTraversalOccurrence );
-
-			return detail::traverseNodeRecursive( context, gmodInstance.rootNode() ) == TraversalHandlerResult::Continue;
-		}
+		bool traverse( TState& state, const GmodNode& rootNode, TraverseHandlerWithState<TState> handler, const TraversalOptions& options = {} );
 
 		/**
-		 * @brief Traverse GMOD tree from specific node with stateful handler
+		 * @brief Traverse GMOD tree from root with stateful handler
 		 * @details Zero-overhead template for maximum performance
 		 * @tparam TState User-defined state type
+		 * @param gmodInstance GMOD instance to traverse
 		 * @param state User state reference
-		 * @param rootNode Starting node
 		 * @param handler Function pointer to stateful handler
 		 * @param options Traversal configuration
 		 * @return true if completed, false if stopped early
 		 */
 		template <typename TState>
-		bool traverse( TState& state, const GmodNode& rootNode, TraverseHandlerWithState<TState> handler, const TraversalOptions& options = {} )
+		bool traverse( TState& state, const Gmod& gmodInstance, TraverseHandlerWithState<TState> handler, const TraversalOptions& options = {} );
+
+		//----------------------------------------------
+		// Lazy enumeration
+		//----------------------------------------------
+
+		/**
+		 * @struct TraversalPath
+		 * @brief Path visited by a traversal, borrowed from the traversal state
+		 * @details Valid until the iterator that produced it is incremented.
+		 */
+		struct TraversalPath
 		{
-			detail::Parents parentsStack;
-			detail::TraversalContext<TState> context( parentsStack, handler, state, options.maxTraversalOccurrence );
+			/** @brief Parents of `node`, root first */
+			std::span<const GmodNode* const> parents;
 
-			return detail::traverseNodeRecursive( context, rootNode ) == TraversalHandlerResult::Continue;
-		}
+			/** @brief Visited node */
+			const GmodNode* node;
+		};
+
+		/**
+		 * @class PathView
+		 * @brief Single-pass `std::ranges` view over the paths of a traversal
+		 * @details Yields the nodes `traverse()` passes to its handler, in the same order and with the
+		 *          same parents, as `TraversalPath` values. The traversal advances one node per increment
+		 *          and allocates nothing per path, so views such as `std::views::filter` and
+		 *          `std::views::take` run lazily and can stop early.
+		 */
+		class PathView : public std::ranges::view_interface<PathView>
+		{
+		public:
+			//----------------------------------------------
+			// Iterator class
+			//----------------------------------------------
+
+			/** @brief Input iterator over the paths */
+			class Iterator
+			{
+			public:
+				using iterator_concept = std::input_iterator_tag;
+				using value_type = TraversalPath;
+				using difference_type = std::ptrdiff_t;
+
+				/** @brief Default constructor. */
+				Iterator() = default;
+
+				/** @brief Constructor. */
+				explicit Iterator( detail::Cursor* cursor ) noexcept;
+
+				/** @brief Get current path */
+				[[nodiscard]] inline TraversalPath operator*() const noexcept;
+
+				/** @brief Move to next path */
+				inline Iterator& operator++();
+
+				/** @brief Move to next path */
+				inline void operator++( int );
+
+				/** @brief Check whether the traversal is over */
+				[[nodiscard]] inline friend bool operator==( const Iterator& it, std::default_sentinel_t ) noexcept
+				{
+					return it.m_cursor == nullptr;
+				}
+
+			private:
+				/** @brief Traversal state, `nullptr` once the traversal is over */
+				detail::Cursor* m_cursor{ nullptr };
+			};
+
+			//----------------------------------------------
+			// Construction / destruction
+			//----------------------------------------------
+
+			/** @brief Default constructor: an empty view. */
+			PathView() = default;
+
+			/**
+			 * @brief Constructor.
+			 * @param rootNode Starting node
+			 * @param options Traversal configuration
+			 */
+			PathView( const GmodNode& rootNode, const TraversalOptions& options );
+
+			/** @brief Copy constructor */
+			PathView( const PathView& ) = delete;
+
+			/** @brief Move constructor */
+			PathView( PathView&& ) noexcept = default;
+
+			/** @brief Destructor */
+			~PathView() = default;
+
+			//----------------------------------------------
+			// Assignment operators
+			//----------------------------------------------
+
+			/** @brief Copy assignment operator */
+			PathView& operator=( const PathView& ) = delete;
+
+			/** @brief Move assignment operator */
+			PathView& operator=( PathView&& ) noexcept = default;
+
+			//----------------------------------------------
+			// Range interface
+			//----------------------------------------------
+
+			/** @brief Start the traversal; may be called once */
+			[[nodiscard]] Iterator begin();
+
+			/** @brief Get the end of the traversal */
+			[[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+		private:
+			/** @brief Traversal state; `nullptr` for an empty view */
+			std::unique_ptr<detail::Cursor> m_cursor;
+		};
+
+		/**
+		 * @brief Lazily enumerate the paths under a specific node
+		 * @param rootNode Starting node
+		 * @param options Traversal configuration
+		 * @return Single-pass view over the paths, in traversal order
+		 */
+		[[nodiscard]] PathView paths( const GmodNode& rootNode, const TraversalOptions& options = {} );
+
+		/**
+		 * @brief Lazily enumerate the paths of a GMOD
+		 * @param gmodInstance GMOD instance to enumerate
+		 * @param options Traversal configuration
+		 * @return Single-pass view over the paths, in traversal order
+		 */
+		[[nodiscard]] PathView paths( const Gmod& gmodInstance, const TraversalOptions& options = {} );
+
+		//----------------------------------------------
+		// Parallel traversal
+		//----------------------------------------------
+
+		/**
+		 * @brief Traverse GMOD tree from specific node on several threads
+		 * @details The nodes above `options.splitDepth` are visited on the calling thread with `state`.
+		 *          The subtrees of the nodes at that depth are then traversed as tasks on a work-stealing
+		 *          pool; each worker visits them with its own value-initialized `TState`, which is merged
+		 *          into `state` once all workers returned. Nodes are visited as by `traverse()`, with the
+		 *          same parents, but subtrees are visited concurrently and in no particular order.
+		 *          A handler returning `Stop` cancels all tasks cooperatively.
+		 * @tparam TState User-defined state type, default constructible
+		 * @tparam THandler Callable as `TraversalHandlerResult( TState&, const std::vector<const GmodNode*>&, const GmodNode& )`,
+		 *         concurrently from several threads
+		 * @tparam TMerge Callable as `void( TState& state, TState&& workerState )`, from the calling thread
+		 * @param state User state reference
+		 * @param rootNode Starting node
+		 * @param handler Handler called for each visited node
+		 * @param merge Merges the state of a worker into `state`
+		 * @param options Traversal configuration
+		 * @return true if completed, false if stopped early
+		 */
+		template <typename TState, typename THandler, typename TMerge>
+		bool traverseParallel( TState& state, const GmodNode& rootNode, THandler&& handler, TMerge&& merge, const ParallelTraversalOptions& options = {} );
+
+		/**
+		 * @brief Traverse GMOD tree from root on several threads
+		 * @details See `traverseParallel( TState&, const GmodNode&, THandler&&, TMerge&&, const ParallelTraversalOptions& )`.
+		 * @tparam TState User-defined state type, default constructible
+		 * @tparam THandler Callable as `TraversalHandlerResult( TState&, const std::vector<const GmodNode*>&, const GmodNode& )`,
+		 *         concurrently from several threads
+		 * @tparam TMerge Callable as `void( TState& state, TState&& workerState )`, from the calling thread
+		 * @param state User state reference
+		 * @param gmodInstance GMOD instance to traverse
+		 * @param handler Handler called for each visited node
+		 * @param merge Merges the state of a worker into `state`
+		 * @param options Traversal configuration
+		 * @return true if completed, false if stopped early
+		 */
+		template <typename TState, typename THandler, typename TMerge>
+		bool traverseParallel( TState& state, const Gmod& gmodInstance, THandler&& handler, TMerge&& merge, const ParallelTraversalOptions& options = {} );
 	}
 }
+
+#include "GmodTraversal.inl"
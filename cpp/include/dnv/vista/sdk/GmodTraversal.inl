@@ -0,0 +1,377 @@
+/**
+ * @file GmodTraversal.inl
+ * @brief Inline implementations for the GMOD traversal engine
+ */
+
+namespace dnv::vista::sdk
+{
+	namespace GmodTraversal
+	{
+		namespace detail
+		{
+			//=====================================================================
+			// GmodTraversal::Parents class
+			//=====================================================================
+
+			//----------------------------------------------
+			// Stack operations
+			//----------------------------------------------
+
+			inline void Parents::push( const GmodNode* parent, uint32_t index )
+			{
+				m_parents.push_back( parent );
+				m_indices.push_back( index );
+				m_nextChildren.push_back( 0 );
+				++m_occurrences[index];
+			}
+
+			inline void Parents::pop()
+			{
+				if ( m_parents.empty() )
+				{
+					return;
+				}
+
+				--m_occurrences[m_indices.back()];
+				m_parents.pop_back();
+				m_indices.pop_back();
+				m_nextChildren.pop_back();
+			}
+
+			inline size_t Parents::occurrences( uint32_t index ) const noexcept
+			{
+				return m_occurrences[index];
+			}
+
+			inline bool Parents::empty() const noexcept
+			{
+				return m_parents.empty();
+			}
+
+			inline size_t Parents::size() const noexcept
+			{
+				return m_parents.size();
+			}
+
+			inline uint32_t Parents::lastIndex() const noexcept
+			{
+				return m_indices.back();
+			}
+
+			inline uint32_t& Parents::nextChild() noexcept
+			{
+				return m_nextChildren.back();
+			}
+
+			inline const std::vector<const GmodNode*>& Parents::asList() const noexcept
+			{
+				return m_parents;
+			}
+
+			//=====================================================================
+			// Core algorithm
+			//=====================================================================
+
+			template <typename THandler>
+			inline TraversalHandlerResult traverseIterative(
+				const internal::GmodGraph& graph, Parents& parents, uint32_t index, THandler& handler, size_t maxTraversalOccurrence )
+			{
+				/* Visits a node, and pushes it when its children are to be visited */
+				auto enter = [&]( uint32_t nodeIndex ) -> TraversalHandlerResult {
+					if ( graph.flags[nodeIndex] & internal::GmodNodeFlags::SKIP_SUBSTRUCTURE )
+					{
+						return TraversalHandlerResult::Continue;
+					}
+
+					const GmodNode& node = *graph.nodes[nodeIndex];
+					const TraversalHandlerResult result = handler( parents.asList(), node );
+					if ( result != TraversalHandlerResult::Continue )
+					{
+						return result;
+					}
+
+					const bool skipOccurrenceCheck = !parents.empty() && graph.isProductSelectionAssignment( parents.lastIndex(), nodeIndex );
+					if ( !skipOccurrenceCheck )
+					{
+						const size_t occ = parents.occurrences( nodeIndex );
+
+						if ( occ == maxTraversalOccurrence )
+						{
+							return TraversalHandlerResult::SkipSubtree;
+						}
+
+						if ( occ > maxTraversalOccurrence ) [[unlikely]]
+						{
+							throw std::runtime_error( "Invalid state - node occurred more than expected" );
+						}
+					}
+
+					parents.push( &node, nodeIndex );
+
+					return TraversalHandlerResult::Continue;
+				};
+
+				/* The parents of the start node are left on the stack */
+				const size_t depth = parents.size();
+
+				const TraversalHandlerResult result = enter( index );
+				if ( result != TraversalHandlerResult::Continue )
+				{
+					return result;
+				}
+
+				while ( parents.size() > depth )
+				{
+					const std::span<const uint32_t> children = graph.childrenOf( parents.lastIndex() );
+					uint32_t& next = parents.nextChild();
+					if ( next == children.size() )
+					{
+						parents.pop();
+
+						continue;
+					}
+
+					/* Advance before entering, which may push */
+					const uint32_t child = children[next++];
+					if ( enter( child ) == TraversalHandlerResult::Stop )
+					{
+						return TraversalHandlerResult::Stop;
+					}
+				}
+
+				return TraversalHandlerResult::Continue;
+			}
+
+			//=====================================================================
+			// GmodTraversal::Cursor class
+			//=====================================================================
+
+			//----------------------------------------------
+			// Iteration
+			//----------------------------------------------
+
+			inline bool Cursor::next()
+			{
+				if ( m_atStart )
+				{
+					m_atStart = false;
+					if ( m_graph == nullptr )
+					{
+						/* A node outside of a Gmod has no relations: visit it alone */
+						return !( m_node->metadata().installSubstructure().has_value() && !m_node->metadata().installSubstructure().value() );
+					}
+
+					m_pending = !( m_graph->flags[m_index] & internal::GmodNodeFlags::SKIP_SUBSTRUCTURE );
+
+					return m_pending;
+				}
+
+				if ( m_graph == nullptr )
+				{
+					return false;
+				}
+
+				const internal::GmodGraph& graph = *m_graph;
+				if ( m_pending )
+				{
+					m_pending = false;
+
+					bool enter = true;
+					const bool skipOccurrenceCheck = !m_parents.empty() && graph.isProductSelectionAssignment( m_parents.lastIndex(), m_index );
+					if ( !skipOccurrenceCheck )
+					{
+						const size_t occ = m_parents.occurrences( m_index );
+						if ( occ > m_maxTraversalOccurrence ) [[unlikely]]
+						{
+							throw std::runtime_error( "Invalid state - node occurred more than expected" );
+						}
+						enter = occ != m_maxTraversalOccurrence;
+					}
+
+					if ( enter )
+					{
+						m_parents.push( m_node, m_index );
+					}
+				}
+
+				while ( !m_parents.empty() )
+				{
+					const std::span<const uint32_t> children = graph.childrenOf( m_parents.lastIndex() );
+					uint32_t& next = m_parents.nextChild();
+					if ( next == children.size() )
+					{
+						m_parents.pop();
+
+						continue;
+					}
+
+					const uint32_t child = children[next++];
+					if ( graph.flags[child] & internal::GmodNodeFlags::SKIP_SUBSTRUCTURE )
+					{
+						continue;
+					}
+
+					m_index = child;
+					m_node = graph.nodes[child];
+					m_pending = true;
+
+					return true;
+				}
+
+				return false;
+			}
+
+			inline const GmodNode& Cursor::node() const noexcept
+			{
+				return *m_node;
+			}
+
+			inline std::span<const GmodNode* const> Cursor::parents() const noexcept
+			{
+				return m_parents.asList();
+			}
+		}
+
+		//=====================================================================
+		// PathView class
+		//=====================================================================
+
+		//----------------------------------------------
+		// Iterator class
+		//----------------------------------------------
+
+		inline TraversalPath PathView::Iterator::operator*() const noexcept
+		{
+			return { m_cursor->parents(), &m_cursor->node() };
+		}
+
+		inline PathView::Iterator& PathView::Iterator::operator++()
+		{
+			if ( !m_cursor->next() )
+			{
+				m_cursor = nullptr;
+			}
+
+			return *this;
+		}
+
+		inline void PathView::Iterator::operator++( int )
+		{
+			++*this;
+		}
+
+		//=====================================================================
+		// Public API
+		//=====================================================================
+
+		template <TraverseCallable THandler>
+		inline bool traverse( const GmodNode& rootNode, THandler&& handler, const TraversalOptions& options )
+		{
+			const internal::GmodGraph* graph = rootNode.graph();
+			if ( graph == nullptr ) [[unlikely]]
+			{
+				/* A node outside of a Gmod has no relations: visit it alone */
+				if ( rootNode.metadata().installSubstructure().has_value() && !rootNode.metadata().installSubstructure().value() )
+				{
+					return true;
+				}
+
+				const std::vector<const GmodNode*> noParents;
+
+				return handler( noParents, rootNode ) == TraversalHandlerResult::Continue;
+			}
+
+			detail::Parents parentsStack( graph->nodes.size() );
+
+			return detail::traverseIterative( *graph, parentsStack, rootNode.graphIndex(), handler, options.maxTraversalOccurrence ) ==
+				   TraversalHandlerResult::Continue;
+		}
+
+		template <TraverseCallable THandler>
+		inline bool traverse( const Gmod& gmodInstance, THandler&& handler, const TraversalOptions& options )
+		{
+			return traverse( gmodInstance.rootNode(), std::forward<THandler>( handler ), options );
+		}
+
+		template <typename TState>
+		inline bool traverse( TState& state, const GmodNode& rootNode, TraverseHandlerWithState<TState> handler, const TraversalOptions& options )
+		{
+			return traverse(
+				rootNode,
+				[&state, handler]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) { return handler( state, parents, node ); },
+				options );
+		}
+
+		template <typename TState>
+		inline bool traverse( TState& state, const Gmod& gmodInstance, TraverseHandlerWithState<TState> handler, const TraversalOptions& options )
+		{
+			return traverse( state, gmodInstance.rootNode(), handler, options );
+		}
+
+		template <typename TState, typename THandler, typename TMerge>
+		inline bool traverseParallel( TState& state, const GmodNode& rootNode, THandler&& handler, TMerge&& merge, const ParallelTraversalOptions& options )
+		{
+			const internal::GmodGraph* graph = rootNode.graph();
+			const size_t splitDepth = std::max<size_t>( 1, options.splitDepth );
+
+			/* Top levels: visited here, collecting the nodes at the split depth as tasks */
+			detail::SubtreeTasks tasks;
+			auto split = [&]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+				if ( parents.size() == splitDepth )
+				{
+					tasks.add( parents, node.graphIndex() );
+
+					return TraversalHandlerResult::SkipSubtree;
+				}
+
+				return handler( state, parents, node );
+			};
+
+			const bool completed = traverse( rootNode, split, options );
+			if ( !completed || tasks.nodes.empty() || graph == nullptr )
+			{
+				return completed;
+			}
+
+			const size_t workerCount = detail::parallelWorkerCount( options, tasks.nodes.size() );
+			std::vector<TState> workerStates( workerCount );
+			std::atomic<bool> stopped{ false };
+
+			detail::runSubtreeTasks(
+				*graph, tasks, workerCount, options.executor, stopped,
+				[&]( size_t worker, detail::Parents& parents, uint32_t node ) {
+					TState& workerState = workerStates[worker];
+					auto visit = [&]( const std::vector<const GmodNode*>& nodeParents, const GmodNode& visited ) -> TraversalHandlerResult {
+						if ( stopped.load( std::memory_order_relaxed ) ) [[unlikely]]
+						{
+							return TraversalHandlerResult::Stop;
+						}
+
+						const TraversalHandlerResult result = handler( workerState, nodeParents, visited );
+						if ( result == TraversalHandlerResult::Stop ) [[unlikely]]
+						{
+							stopped.store( true, std::memory_order_relaxed );
+						}
+
+						return result;
+					};
+
+					[[maybe_unused]] const TraversalHandlerResult result =
+						detail::traverseIterative( *graph, parents, node, visit, options.maxTraversalOccurrence );
+				} );
+
+			for ( TState& workerState : workerStates )
+			{
+				merge( state, std::move( workerState ) );
+			}
+
+			return !stopped.load( std::memory_order_acquire );
+		}
+
+		template <typename TState, typename THandler, typename TMerge>
+		inline bool traverseParallel( TState& state, const Gmod& gmodInstance, THandler&& handler, TMerge&& merge, const ParallelTraversalOptions& options )
+		{
+			return traverseParallel( state, gmodInstance.rootNode(), std::forward<THandler>( handler ), std::forward<TMerge>( merge ), options );
+		}
+	}
+}
@@ -49,10 +49,10 @@ namespace dnv::vista::sdk
 		GmodVersioning() = delete;
 
 		/** @brief Copy constructor */
-		GmodVersioning( const GmodVersioning& ) = default;
+		GmodVersioning( const GmodVersioning& ) = delete;
 
 		/** @brief Move constructor */
-		GmodVersioning( GmodVersioning&& ) noexcept = default;
+		GmodVersioning( GmodVersioning&& ) noexcept = delete;
 
 		/** @brief Destructor */
 		~GmodVersioning() = default;
@@ -73,6 +73,8 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Convert a GmodNode from one version to a higher version
+		 * @details Nodes of the source GMOD are resolved through a conversion plan of the version pair,
+		 *          built on first use, instead of being converted once per intermediate version.
 		 * @throws std::invalid_argument If targetVersion is not higher than sourceVersion
 		 */
 		[[nodiscard]] std::optional<GmodNode> convertNode(
@@ -80,6 +82,8 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Converts a GmodPath from a source VIS version to a target VIS version.
+		 * @details Paths whose nodes map one-to-one onto a valid target path are converted by lookup;
+		 *          the others are reconstructed, and reused when they carry no locations.
 		 * @param sourceVersion The VIS version of the sourcePath.
 		 * @param sourcePath The GmodPath to convert (passed by const reference).
 		 * @param targetVersion The target VIS version.
@@ -184,13 +188,81 @@ namespace dnv::vista::sdk
 			 */
 			bool tryGetCodeChanges( const std::string& code, GmodNodeConversion& nodeChanges ) const;
 
+			/**
+			 * @brief Try to get code changes for a specific interned node code id
+			 */
+			bool tryGetCodeChanges( uint32_t codeId, GmodNodeConversion& nodeChanges ) const;
+
 		private:
 			//----------------------------------------------
 			// Private member variables
 			//----------------------------------------------
 
 			VisVersion m_visVersion;
-			std::unordered_map<std::string, GmodNodeConversion> m_versioningNodeChanges;
+			/** @brief Node changes keyed by interned source code id (see `StringInterner`). */
+			std::unordered_map<uint32_t, GmodNodeConversion> m_versioningNodeChanges;
+		};
+
+		//----------------------------------------------
+		// ConversionPlan struct
+		//----------------------------------------------
+
+		/**
+		 * @brief Precomputed conversion from one VIS version to a later one.
+		 * @details Entries are indexed by interned source code id (see `StringInterner`) and chain the
+		 *          code changes of every intermediate version. Path conversion maps each node through
+		 *          its entry, and only reconstructs paths whose mapped nodes do not form a valid path.
+		 *          Reconstructed paths without locations are kept as templates, keyed by the code ids
+		 *          of the source path.
+		 */
+		struct ConversionPlan final
+		{
+			/** @brief Maximum number of path templates kept per plan. */
+			static constexpr size_t MAX_PATH_TEMPLATES{ 4096 };
+
+			/** @brief `Entry::flags` bits. */
+			enum EntryFlags : uint8_t
+			{
+				/** @brief The source GMOD has a node with the code. */
+				KNOWN = 1 << 0,
+				/** @brief The node has a different code in the target GMOD. */
+				CODE_CHANGED = 1 << 1,
+				/** @brief The normal assignment (product type) of the node differs in the target GMOD. */
+				ASSIGNMENT_CHANGED = 1 << 2,
+				/** @brief The node has a normal assignment in the source GMOD but none in the target GMOD. */
+				ASSIGNMENT_DELETED = 1 << 3
+			};
+
+			/** @brief Conversion of one source code. */
+			struct Entry
+			{
+				/** @brief Node of the target GMOD, or `nullptr` if the code does not survive. */
+				const GmodNode* target{ nullptr };
+
+				/** @brief `EntryFlags` bits. */
+				uint8_t flags{ 0 };
+			};
+
+			/** @brief Target GMOD of the plan. */
+			const Gmod* targetGmod{ nullptr };
+
+			/** @brief Entry per source code id. */
+			std::vector<Entry> entries;
+
+			/** @brief Guards `pathTemplates`. */
+			mutable std::shared_mutex pathTemplatesMutex;
+
+			/**
+			 * @brief Reconstructed target paths, root first, keyed by the code ids of the source path.
+			 * @details Only paths without locations are kept, as their reconstruction depends on codes alone.
+			 */
+			mutable std::unordered_map<std::u32string, std::vector<GmodLocatedNode>> pathTemplates;
+
+			/**
+			 * @brief Gets the entry of a node.
+			 * @return The entry, or `nullptr` if the node is not a node of the source GMOD.
+			 */
+			[[nodiscard]] const Entry* find( const GmodNode& node, VisVersion sourceVersion ) const noexcept;
 		};
 
 		//----------------------------------------------
@@ -199,6 +271,12 @@ namespace dnv::vista::sdk
 
 		std::unordered_map<VisVersion, GmodVersioningNode> m_versioningsMap;
 
+		/** @brief Guards `m_conversionPlans`. */
+		mutable std::shared_mutex m_conversionPlansMutex;
+
+		/** @brief Conversion plans built so far, keyed by source version (high word) and target version (low word). */
+		mutable std::unordered_map<uint64_t, std::unique_ptr<const ConversionPlan>> m_conversionPlans;
+
 		//----------------------------------------------
 		// Private helper methods
 		//----------------------------------------------
@@ -209,6 +287,31 @@ namespace dnv::vista::sdk
 		[[nodiscard]] std::optional<GmodNode> convertNodeInternal(
 			VisVersion sourceVersion, const GmodNode& sourceNode, VisVersion targetVersion ) const;
 
+		/**
+		 * @brief Finds the node of the next VIS version that a node's code changes to
+		 * @return The node of the `targetVersion` GMOD, or `nullptr` if the code does not exist there
+		 */
+		[[nodiscard]] const GmodNode* nextVersionNode( const GmodNode& sourceNode, VisVersion targetVersion ) const;
+
+		/**
+		 * @brief Gets the conversion plan of a version pair, building it on first use
+		 * @details Thread-safe; plans live as long as this object.
+		 */
+		[[nodiscard]] const ConversionPlan& conversionPlan( VisVersion sourceVersion, VisVersion targetVersion ) const;
+
+		/**
+		 * @brief Chains the code changes of every intermediate version for each node of the source GMOD
+		 */
+		[[nodiscard]] std::unique_ptr<const ConversionPlan> buildConversionPlan( VisVersion sourceVersion, VisVersion targetVersion ) const;
+
+		/**
+		 * @brief Converts a path by mapping each of its nodes through a plan
+		 * @return The converted path, or `std::nullopt` if a node does not map or the mapped nodes
+		 *         do not form a valid path
+		 */
+		[[nodiscard]] static std::optional<GmodPath> tryConvertPathDirect(
+			const ConversionPlan& plan, VisVersion sourceVersion, const GmodPath& sourcePath );
+
 		/**
 		 * @brief Try to get a versioning node for a specific VIS version
 		 */
@@ -236,5 +339,10 @@ namespace dnv::vista::sdk
 		 * @brief Parse a conversion type from a string
 		 */
 		static ConversionType parseConversionType( const std::string& type );
+
+		/**
+		 * @brief Computes the `ConversionPlan::EntryFlags` changes between a node and its converted node
+		 */
+		[[nodiscard]] static uint8_t planEntryFlags( const GmodNode& sourceNode, const GmodNode& targetNode );
 	};
 }
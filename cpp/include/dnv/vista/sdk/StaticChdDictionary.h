@@ -0,0 +1,173 @@
+/**
+ * @file StaticChdDictionary.h
+ * @brief Compile-time CHD perfect hash dictionary for small fixed key sets.
+ * @details This file defines the StaticChdDictionary class, a `constexpr` counterpart of
+ *          ChdDictionary for key sets known at compile time (codebook prefixes, VIS version
+ *          strings, metadata prefixes). The seed search runs during constant evaluation, so the
+ *          table lives in read-only data with no static initialization and no heap allocation.
+ */
+
+#pragma once
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// StaticChdDictionary class
+	//=====================================================================
+
+	/**
+	 * @class StaticChdDictionary
+	 * @brief A fixed-capacity, compile-time built CHD dictionary keyed by string literals.
+	 *
+	 * @details Uses the same compress-hash-displace scheme as ChdDictionary (bucket seeds,
+	 * negative seeds for single-item buckets) over `std::array` storage sized to the next power
+	 * of two of at least twice the key count. Keys are hashed with FNV-1a over their bytes, which
+	 * is `constexpr` and cheap for the short keys this class is meant for. A lookup is one hash,
+	 * one seed load, one slot load and one key comparison.
+	 *
+	 * Invalid input (duplicate or empty keys) is rejected during constant evaluation, i.e. it
+	 * fails to compile.
+	 *
+	 * @tparam TValue The value type. Must be default constructible and trivially copyable.
+	 * @tparam N The number of keys.
+	 */
+	template <typename TValue, size_t N>
+	class StaticChdDictionary final
+	{
+		static_assert( N > 0, "StaticChdDictionary requires at least one key" );
+		static_assert( std::is_default_constructible_v<TValue> && std::is_trivially_copyable_v<TValue>,
+			"StaticChdDictionary values must be default constructible and trivially copyable" );
+
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Table size: the smallest power of 2 that is at least twice the key count. */
+		static constexpr size_t TABLE_SIZE{ []() {
+			size_t size{ 1 };
+			while ( size < N )
+			{
+				size *= 2;
+			}
+
+			return size * 2;
+		}() };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Builds the perfect hash table at compile time.
+		 * @param[in] items The key-value pairs. Keys must be unique and non-empty, and must refer
+		 *            to storage with static duration (typically string literals).
+		 */
+		consteval explicit StaticChdDictionary( const std::array<std::pair<std::string_view, TValue>, N>& items );
+
+		/** @brief Default constructor */
+		StaticChdDictionary() = delete;
+
+		/** @brief Copy constructor */
+		constexpr StaticChdDictionary( const StaticChdDictionary& ) = default;
+
+		/** @brief Move constructor */
+		constexpr StaticChdDictionary( StaticChdDictionary&& ) noexcept = default;
+
+		/** @brief Destructor */
+		constexpr ~StaticChdDictionary() = default;
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		StaticChdDictionary& operator=( const StaticChdDictionary& ) = delete;
+
+		/** @brief Move assignment operator */
+		StaticChdDictionary& operator=( StaticChdDictionary&& ) noexcept = delete;
+
+		//----------------------------------------------
+		// Lookup methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Finds the value associated with a key.
+		 * @param[in] key The key to look up.
+		 * @return A pointer to the value, or `nullptr` if the key is not present.
+		 */
+		[[nodiscard]] inline constexpr const TValue* find( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Attempts to retrieve the value associated with a key.
+		 * @param[in] key The key to look up.
+		 * @param[out] outValue Set to the value if found; unchanged otherwise.
+		 * @return `true` if the key was found, `false` otherwise.
+		 */
+		[[nodiscard]] inline constexpr bool tryGetValue( std::string_view key, TValue& outValue ) const noexcept;
+
+		/**
+		 * @brief Checks whether a key is present.
+		 * @param[in] key The key to look up.
+		 * @return `true` if the key is present, `false` otherwise.
+		 */
+		[[nodiscard]] inline constexpr bool contains( std::string_view key ) const noexcept;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the number of keys in the dictionary.
+		 * @return The key count `N`.
+		 */
+		[[nodiscard]] static inline constexpr size_t size() noexcept;
+
+		//----------------------------------------------
+		// Static helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Computes the primary hash of a key (32-bit FNV-1a over its bytes).
+		 * @param[in] key The key to hash.
+		 * @return The hash value.
+		 */
+		[[nodiscard]] static inline constexpr uint32_t hash( std::string_view key ) noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private types
+		//----------------------------------------------
+
+		/** @brief One table slot. Empty slots have an empty key. */
+		struct Entry
+		{
+			std::string_view key;
+			TValue value;
+		};
+
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Mixes the primary hash with a bucket seed to find the final table slot.
+		 * @param[in] seed The bucket seed.
+		 * @param[in] hash The primary hash.
+		 * @return The table slot.
+		 */
+		[[nodiscard]] static inline constexpr size_t slot( uint32_t seed, uint32_t hash ) noexcept;
+
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Table slots. */
+		std::array<Entry, TABLE_SIZE> m_entries;
+
+		/** @brief Bucket seeds; negative values encode the slot of single-item buckets directly. */
+		std::array<int32_t, TABLE_SIZE> m_seeds;
+	};
+}
+
+#include "StaticChdDictionary.inl"
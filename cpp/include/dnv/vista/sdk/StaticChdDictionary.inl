@@ -0,0 +1,204 @@
+/**
+ * @file StaticChdDictionary.inl
+ * @brief Inline implementations for the compile-time CHD dictionary
+ */
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// StaticChdDictionary class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, size_t N>
+	consteval StaticChdDictionary<TValue, N>::StaticChdDictionary( const std::array<std::pair<std::string_view, TValue>, N>& items )
+		: m_entries{},
+		  m_seeds{}
+	{
+		constexpr size_t mask{ TABLE_SIZE - 1 };
+
+		std::array<uint32_t, N> hashes{};
+		for ( size_t i{ 0 }; i < N; ++i )
+		{
+			if ( items[i].first.empty() )
+			{
+				throw std::invalid_argument( "StaticChdDictionary keys must not be empty" );
+			}
+
+			for ( size_t j{ 0 }; j < i; ++j )
+			{
+				if ( items[i].first == items[j].first )
+				{
+					throw std::invalid_argument( "StaticChdDictionary keys must be unique" );
+				}
+			}
+
+			hashes[i] = hash( items[i].first );
+		}
+
+		std::array<size_t, TABLE_SIZE> bucketSizes{};
+		for ( size_t i{ 0 }; i < N; ++i )
+		{
+			++bucketSizes[hashes[i] & mask];
+		}
+
+		/* Order items by bucket, largest buckets first (insertion sort, N is small) */
+		std::array<size_t, N> order{};
+		for ( size_t i{ 0 }; i < N; ++i )
+		{
+			order[i] = i;
+		}
+
+		auto before = [&]( size_t a, size_t b ) {
+			const size_t bucketA{ hashes[a] & mask };
+			const size_t bucketB{ hashes[b] & mask };
+
+			return bucketSizes[bucketA] != bucketSizes[bucketB] ? bucketSizes[bucketA] > bucketSizes[bucketB] : bucketA < bucketB;
+		};
+
+		for ( size_t i{ 1 }; i < N; ++i )
+		{
+			const size_t current{ order[i] };
+			size_t j{ i };
+			for ( ; j > 0 && before( current, order[j - 1] ); --j )
+			{
+				order[j] = order[j - 1];
+			}
+			order[j] = current;
+		}
+
+		std::array<bool, TABLE_SIZE> occupied{};
+		std::array<size_t, N> slots{};
+
+		/* Multi-item buckets: search a seed that places every item of the bucket in a free slot */
+		size_t i{ 0 };
+		while ( i < N && bucketSizes[hashes[order[i]] & mask] > 1 )
+		{
+			const size_t bucket{ hashes[order[i]] & mask };
+			const size_t count{ bucketSizes[bucket] };
+
+			uint32_t seed{ 0 };
+			bool seedValid{ false };
+			while ( !seedValid )
+			{
+				if ( ++seed > TABLE_SIZE * 100 )
+				{
+					throw std::runtime_error( "StaticChdDictionary seed search exceeded threshold" );
+				}
+
+				seedValid = true;
+				for ( size_t k{ 0 }; k < count && seedValid; ++k )
+				{
+					slots[k] = slot( seed, hashes[order[i + k]] );
+					seedValid = !occupied[slots[k]];
+					for ( size_t l{ 0 }; l < k && seedValid; ++l )
+					{
+						seedValid = slots[l] != slots[k];
+					}
+				}
+			}
+
+			for ( size_t k{ 0 }; k < count; ++k )
+			{
+				const auto& item{ items[order[i + k]] };
+				occupied[slots[k]] = true;
+				m_entries[slots[k]] = Entry{ item.first, item.second };
+			}
+
+			m_seeds[bucket] = static_cast<int32_t>( seed );
+			i += count;
+		}
+
+		/* Single-item buckets: take the next free slot and encode it as a negative seed */
+		size_t freeSlot{ 0 };
+		for ( ; i < N; ++i )
+		{
+			while ( occupied[freeSlot] )
+			{
+				++freeSlot;
+			}
+
+			const auto& item{ items[order[i]] };
+			occupied[freeSlot] = true;
+			m_entries[freeSlot] = Entry{ item.first, item.second };
+			m_seeds[hashes[order[i]] & mask] = -static_cast<int32_t>( freeSlot + 1 );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup methods
+	//----------------------------------------------
+
+	template <typename TValue, size_t N>
+	inline constexpr const TValue* StaticChdDictionary<TValue, N>::find( std::string_view key ) const noexcept
+	{
+		const uint32_t hashValue{ hash( key ) };
+		const int32_t seed{ m_seeds[hashValue & ( TABLE_SIZE - 1 )] };
+		const size_t index{ seed < 0 ? static_cast<size_t>( -seed - 1 ) : slot( static_cast<uint32_t>( seed ), hashValue ) };
+
+		const Entry& entry{ m_entries[index] };
+
+		/* Empty slots have an empty key, and empty keys are never stored */
+		return ( !key.empty() && entry.key == key ) ? &entry.value : nullptr;
+	}
+
+	template <typename TValue, size_t N>
+	inline constexpr bool StaticChdDictionary<TValue, N>::tryGetValue( std::string_view key, TValue& outValue ) const noexcept
+	{
+		if ( const TValue* value{ find( key ) } )
+		{
+			outValue = *value;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename TValue, size_t N>
+	inline constexpr bool StaticChdDictionary<TValue, N>::contains( std::string_view key ) const noexcept
+	{
+		return find( key ) != nullptr;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	template <typename TValue, size_t N>
+	inline constexpr size_t StaticChdDictionary<TValue, N>::size() noexcept
+	{
+		return N;
+	}
+
+	//----------------------------------------------
+	// Static helper methods
+	//----------------------------------------------
+
+	template <typename TValue, size_t N>
+	inline constexpr uint32_t StaticChdDictionary<TValue, N>::hash( std::string_view key ) noexcept
+	{
+		uint32_t hashValue{ 0x811C9DC5 };
+		for ( const char ch : key )
+		{
+			hashValue = ( static_cast<uint8_t>( ch ) ^ hashValue ) * 0x01000193;
+		}
+
+		return hashValue;
+	}
+
+	template <typename TValue, size_t N>
+	inline constexpr size_t StaticChdDictionary<TValue, N>::slot( uint32_t seed, uint32_t hash ) noexcept
+	{
+		/* Same xorshift-multiply mixer as internal::Hashing::seed */
+		uint32_t x{ seed + hash };
+		x ^= x >> 12;
+		x ^= x << 25;
+		x ^= x >> 27;
+
+		return static_cast<size_t>( ( x * 0x2545F4914F6CDD1DULL ) & ( TABLE_SIZE - 1 ) );
+	}
+}
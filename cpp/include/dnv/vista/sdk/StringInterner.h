@@ -0,0 +1,126 @@
+/**
+ * @file StringInterner.h
+ * @brief Global interning table for GMOD codes.
+ * @details This file defines the StringInterner class, which maps each distinct GMOD code to a
+ *          stable 32-bit id shared by every VIS version. Structures keyed by code (the GMOD node
+ *          index, child sets, versioning tables) also accept the id, so a code that has been
+ *          interned once is resolved by array index instead of being hashed again. Located node
+ *          handles (`GmodLocatedNode`) store long location strings by id in a table of their own.
+ */
+
+#pragma once
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// StringInterner class
+	//=====================================================================
+
+	/**
+	 * @brief Thread-safe, append-only table assigning stable 32-bit ids to strings.
+	 * @details Ids are dense and assigned in interning order starting at 0; an id and the string
+	 *          view returned for it stay valid for the lifetime of the process. Interning is
+	 *          serialized by a lock, lookups take a shared lock.
+	 */
+	class StringInterner final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Id value that never refers to an interned string. */
+		static constexpr uint32_t NPOS{ std::numeric_limits<uint32_t>::max() };
+
+		//----------------------------------------------
+		// Singleton access
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the process-wide table used for GMOD codes.
+		 * @return A reference to the table.
+		 */
+		[[nodiscard]] static StringInterner& instance();
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		/** @brief Default constructor. */
+		StringInterner() = default;
+
+		/** @brief Copy constructor */
+		StringInterner( const StringInterner& ) = delete;
+
+		/** @brief Move constructor */
+		StringInterner( StringInterner&& ) noexcept = delete;
+
+		/** @brief Destructor */
+		~StringInterner() = default;
+
+		//----------------------------------------------
+		// Assignment operators
+		//----------------------------------------------
+
+		/** @brief Copy assignment operator */
+		StringInterner& operator=( const StringInterner& ) = delete;
+
+		/** @brief Move assignment operator */
+		StringInterner& operator=( StringInterner&& ) noexcept = delete;
+
+		//----------------------------------------------
+		// Interning
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the id of a string, interning it first if needed.
+		 * @param str The string to intern.
+		 * @return The id of `str`.
+		 * @throws std::length_error If the table already holds `NPOS` strings.
+		 */
+		[[nodiscard]] uint32_t intern( std::string_view str );
+
+		/**
+		 * @brief Gets the id of a string without interning it.
+		 * @param str The string to look up.
+		 * @param[out] id Receives the id of `str`, or `NPOS` if it has never been interned.
+		 * @return True if `str` has been interned, false otherwise.
+		 */
+		[[nodiscard]] bool tryGetId( std::string_view str, uint32_t& id ) const;
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Gets the string of an id.
+		 * @param id An id returned by `intern()`.
+		 * @return The interned string.
+		 * @throws std::out_of_range If `id` has not been assigned.
+		 */
+		[[nodiscard]] std::string_view string( uint32_t id ) const;
+
+		/**
+		 * @brief Gets the number of interned strings, i.e. one past the largest assigned id.
+		 * @return The number of interned strings.
+		 */
+		[[nodiscard]] size_t size() const;
+
+	private:
+		//----------------------------------------------
+		// Private member variables
+		//----------------------------------------------
+
+		/** @brief Owned string storage; list nodes never move, so views into them stay valid. */
+		std::list<std::string> m_storage;
+
+		/** @brief Interned strings indexed by id. */
+		std::vector<std::string_view> m_strings;
+
+		/** @brief Ids of the interned strings. */
+		std::unordered_map<std::string_view, uint32_t> m_ids;
+
+		/** @brief Guards all members. */
+		mutable std::shared_mutex m_mutex;
+	};
+}
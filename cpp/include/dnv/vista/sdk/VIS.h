@@ -224,10 +224,10 @@ namespace dnv::vista::sdk
 		/**
 		 * @brief Retrieves the GMOD versioning information processed into a GmodVersioning object.
 		 * This object provides higher-level access to version conversion logic.
-		 * @return The GmodVersioning object.
+		 * @return A constant reference to the GmodVersioning object, created on first use.
 		 * @throws std::runtime_error If the GMOD versioning data cannot be loaded or processed.
 		 */
-		[[nodiscard]] GmodVersioning gmodVersioning();
+		[[nodiscard]] const GmodVersioning& gmodVersioning();
 
 		/**
 		 * @brief Get the GMOD (Generic Product Model) for a specific VIS version.
@@ -41,11 +41,11 @@ namespace dnv::vista::sdk
 
 		/**
 		 * @brief Try to parse a string to a VisVersion
-		 * @param versionString The string to parse
+		 * @param versionString The string to parse, e.g. "3-4a", "3.4a" or "vis-3-4a"
 		 * @param version Output parameter for the parsed version
 		 * @return true if parsing succeeded, false otherwise
 		 */
-		static bool tryParse( const std::string& versionString, VisVersion& version );
+		static bool tryParse( std::string_view versionString, VisVersion& version );
 
 		/**
 		 * @brief Parse a string to a VisVersion
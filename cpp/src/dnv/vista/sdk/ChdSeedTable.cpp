@@ -0,0 +1,134 @@
+/**
+ * @file ChdSeedTable.cpp
+ * @brief Implementation of the precomputed CHD seed table reader and writer
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/ChdSeedTable.h"
+
+namespace dnv::vista::sdk
+{
+	namespace
+	{
+		//=====================================================================
+		// Constants
+		//=====================================================================
+
+		static constexpr std::array<char, 8> CHD_SEED_TABLE_MAGIC{ 'V', 'I', 'S', 'C', 'H', 'D', '\0', '\0' };
+
+		//=====================================================================
+		// File header
+		//=====================================================================
+
+		struct ChdSeedTableHeader
+		{
+			std::array<char, 8> magic;
+			uint32_t formatVersion;
+			uint32_t itemCount;
+			uint32_t tableSize;
+			uint32_t checksum;
+		};
+
+		static_assert( std::is_trivially_copyable_v<ChdSeedTableHeader> && sizeof( ChdSeedTableHeader ) == 24 );
+
+		//=====================================================================
+		// Helper functions
+		//=====================================================================
+
+		inline uint32_t checksum( std::span<const int> seeds ) noexcept
+		{
+			return static_cast<uint32_t>( ::crc32( 0L, reinterpret_cast<const Bytef*>( seeds.data() ), static_cast<uInt>( seeds.size_bytes() ) ) );
+		}
+	}
+
+	//=====================================================================
+	// ChdSeedTable class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Static methods
+	//----------------------------------------------
+
+	void ChdSeedTable::write( const std::filesystem::path& path, std::span<const int> seeds, size_t itemCount )
+	{
+		static_assert( std::endian::native == std::endian::little, "Seed table files are little-endian" );
+
+		ChdSeedTableHeader header{};
+		header.magic = CHD_SEED_TABLE_MAGIC;
+		header.formatVersion = FORMAT_VERSION;
+		header.itemCount = static_cast<uint32_t>( itemCount );
+		header.tableSize = static_cast<uint32_t>( seeds.size() );
+		header.checksum = checksum( seeds );
+
+		/* Write to a temporary file first so that concurrent readers never see a partial table */
+		auto tempPath = path;
+		tempPath += ".tmp";
+
+		{
+			std::ofstream file( tempPath, std::ios::binary | std::ios::trunc );
+			if ( !file )
+			{
+				throw std::runtime_error( "Failed to create CHD seed table file: " + tempPath.string() );
+			}
+
+			file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+			file.write( reinterpret_cast<const char*>( seeds.data() ), static_cast<std::streamsize>( seeds.size_bytes() ) );
+
+			if ( !file )
+			{
+				throw std::runtime_error( "Failed to write CHD seed table file: " + tempPath.string() );
+			}
+		}
+
+		std::filesystem::rename( tempPath, path );
+	}
+
+	bool ChdSeedTable::tryRead( const std::filesystem::path& path, size_t expectedItemCount, std::vector<int>& seeds ) noexcept
+	{
+		seeds.clear();
+
+		try
+		{
+			std::ifstream file( path, std::ios::binary );
+			if ( !file )
+			{
+				return false;
+			}
+
+			ChdSeedTableHeader header{};
+			if ( !file.read( reinterpret_cast<char*>( &header ), sizeof( header ) ) ||
+				 header.magic != CHD_SEED_TABLE_MAGIC ||
+				 header.formatVersion != FORMAT_VERSION ||
+				 header.itemCount != expectedItemCount ||
+				 header.tableSize == 0 ||
+				 ( header.tableSize & ( header.tableSize - 1 ) ) != 0 ||
+				 header.tableSize < header.itemCount )
+			{
+				return false;
+			}
+
+			std::vector<int> result( header.tableSize );
+			if ( !file.read( reinterpret_cast<char*>( result.data() ), static_cast<std::streamsize>( result.size() * sizeof( int ) ) ) ||
+				 checksum( result ) != header.checksum )
+			{
+				return false;
+			}
+
+			seeds = std::move( result );
+
+			return true;
+		}
+		catch ( [[maybe_unused]] const std::exception& ex )
+		{
+			SPDLOG_WARN( "Failed to read CHD seed table '{}': {}", path.string(), ex.what() );
+
+			return false;
+		}
+	}
+
+	std::string ChdSeedTable::fileName( std::string_view baseName )
+	{
+		return fmt::format( "{}.chd", baseName );
+	}
+}
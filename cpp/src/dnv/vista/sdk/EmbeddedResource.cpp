@@ -42,8 +42,8 @@ namespace dnv::vista::sdk
 			{
 				try
 				{
-					auto stream = decompressedStream( resourceName );
-					nlohmann::json gmodJson = nlohmann::json::parse( *stream );
+					const std::string jsonText = decompressed( resourceName );
+					nlohmann::json gmodJson = nlohmann::json::parse( jsonText );
 
 					if ( gmodJson.contains( VIS_RELEASE_KEY ) && gmodJson.at( VIS_RELEASE_KEY ).is_string() )
 					{
@@ -136,17 +136,20 @@ namespace dnv::vista::sdk
 		{
 			auto startTime = std::chrono::high_resolution_clock::now();
 
-			auto stream = decompressedStream( *it );
-			nlohmann::json gmodJson = nlohmann::json::parse( *stream );
-
-			GmodDto loadedDto = GmodDto::fromJson( gmodJson );
+			/* Parse straight into the DTO: the document is never materialized as an nlohmann::json tree */
+			const std::string jsonText = decompressed( *it );
+			auto loadedDto = GmodDto::tryParse( jsonText );
+			if ( !loadedDto.has_value() )
+			{
+				throw std::invalid_argument( "Failed to parse GMOD DTO for version " + visVersion );
+			}
 
 			auto endTime = std::chrono::high_resolution_clock::now();
 			auto duration = std::chrono::duration_cast<std::chrono::milliseconds>( endTime - startTime );
 
 			SPDLOG_DEBUG( "Successfully loaded GMOD DTO for version {} in {} ms", visVersion, duration.count() );
 
-			resultForCache.emplace( std::move( loadedDto ) );
+			resultForCache.emplace( std::move( *loadedDto ) );
 		}
 		catch ( [[maybe_unused]] const nlohmann::json::parse_error& ex )
 		{
@@ -205,8 +208,8 @@ namespace dnv::vista::sdk
 			{
 				auto processStartTime = std::chrono::high_resolution_clock::now();
 
-				auto stream = decompressedStream( resourceName );
-				nlohmann::json versioningJson = nlohmann::json::parse( *stream );
+				const std::string jsonText = decompressed( resourceName );
+				nlohmann::json versioningJson = nlohmann::json::parse( jsonText );
 
 				if ( versioningJson.contains( VIS_RELEASE_KEY ) && versioningJson.at( VIS_RELEASE_KEY ).is_string() )
 				{
@@ -297,8 +300,8 @@ namespace dnv::vista::sdk
 		std::optional<CodebooksDto> resultForCache = std::nullopt;
 		try
 		{
-			auto stream = decompressedStream( *it );
-			nlohmann::json codebooksJson = nlohmann::json::parse( *stream );
+			const std::string jsonText = decompressed( *it );
+			nlohmann::json codebooksJson = nlohmann::json::parse( jsonText );
 
 			CodebooksDto loadedDto = CodebooksDto::fromJson( codebooksJson );
 
@@ -362,8 +365,8 @@ namespace dnv::vista::sdk
 		std::optional<LocationsDto> resultForCache = std::nullopt;
 		try
 		{
-			auto stream = decompressedStream( *it );
-			nlohmann::json locationsJson = nlohmann::json::parse( *stream );
+			const std::string jsonText = decompressed( *it );
+			nlohmann::json locationsJson = nlohmann::json::parse( jsonText );
 
 			LocationsDto loadedDto = LocationsDto::fromJson( locationsJson );
 
@@ -429,8 +432,8 @@ namespace dnv::vista::sdk
 		std::optional<DataChannelTypeNamesDto> resultForCache = std::nullopt;
 		try
 		{
-			auto stream = decompressedStream( *it );
-			nlohmann::json dtNamesJson = nlohmann::json::parse( *stream );
+			const std::string jsonText = decompressed( *it );
+			nlohmann::json dtNamesJson = nlohmann::json::parse( jsonText );
 
 			DataChannelTypeNamesDto loadedDto = DataChannelTypeNamesDto::fromJson( dtNamesJson );
 
@@ -496,8 +499,8 @@ namespace dnv::vista::sdk
 		std::optional<FormatDataTypesDto> resultForCache = std::nullopt;
 		try
 		{
-			auto stream = decompressedStream( *it );
-			nlohmann::json fdTypesJson = nlohmann::json::parse( *stream );
+			const std::string jsonText = decompressed( *it );
+			nlohmann::json fdTypesJson = nlohmann::json::parse( jsonText );
 
 			FormatDataTypesDto loadedDto = FormatDataTypesDto::fromJson( fdTypesJson );
 
@@ -614,12 +617,36 @@ namespace dnv::vista::sdk
 		}
 	}
 
-	std::shared_ptr<std::istream> EmbeddedResource::decompressedStream( const std::string& resourceName )
+	std::string EmbeddedResource::decompressed( const std::string& resourceName )
 	{
 		auto startTime = std::chrono::high_resolution_clock::now();
 		auto compressedStream = stream( resourceName );
 
-		auto decompressedBuffer = std::make_shared<std::stringstream>();
+		compressedStream->seekg( 0, std::ios::end );
+		const std::streamoff compressedSize = compressedStream->tellg();
+		compressedStream->seekg( 0, std::ios::beg );
+		if ( compressedSize < 0 )
+		{
+			throw std::runtime_error( "Error reading compressed stream for " + resourceName );
+		}
+
+		std::vector<char> compressed( static_cast<size_t>( compressedSize ) );
+		if ( !compressedStream->read( compressed.data(), compressedSize ) )
+		{
+			throw std::runtime_error( "Error reading compressed stream for " + resourceName );
+		}
+
+		/* The gzip trailer ends with ISIZE, the uncompressed size modulo 2^32, in little-endian order */
+		constexpr size_t GZIP_MIN_SIZE = 18;
+		size_t expectedSize = 0;
+		if ( compressed.size() >= GZIP_MIN_SIZE )
+		{
+			const auto* trailer = reinterpret_cast<const unsigned char*>( compressed.data() + compressed.size() - 4 );
+			expectedSize = static_cast<size_t>( trailer[0] ) |
+						   ( static_cast<size_t>( trailer[1] ) << 8 ) |
+						   ( static_cast<size_t>( trailer[2] ) << 16 ) |
+						   ( static_cast<size_t>( trailer[3] ) << 24 );
+		}
 
 		::z_stream zs = {};
 		zs.zalloc = Z_NULL;
@@ -631,53 +658,44 @@ namespace dnv::vista::sdk
 			throw std::runtime_error( "Failed to initialize zlib for decompression for " + resourceName );
 		}
 
-		const size_t CHUNK_IN_SIZE = 16384;
-		std::vector<char> inBuffer( CHUNK_IN_SIZE );
-		const size_t CHUNK_OUT_SIZE = 32768;
-		std::vector<char> outBuffer( CHUNK_OUT_SIZE );
+		zs.next_in = reinterpret_cast<Bytef*>( compressed.data() );
+		zs.avail_in = static_cast<uInt>( compressed.size() );
+
+		/*
+		 * Inflate in one pass into the buffer sized from ISIZE, growing it only if the trailer understated the size.
+		 * The spare byte lets zlib reach the end of the stream without reporting a full output buffer.
+		 */
+		std::string decompressedBuffer( expectedSize + 1, '\0' );
 		int ret = Z_OK;
-		size_t totalCompressedRead = 0;
-		size_t totalDecompressedWritten = 0;
 
 		do
 		{
-			compressedStream->read( inBuffer.data(), CHUNK_IN_SIZE );
-			zs.avail_in = static_cast<uInt>( compressedStream->gcount() );
-			totalCompressedRead += zs.avail_in;
-
-			if ( zs.avail_in == 0 && !compressedStream->eof() )
+			if ( zs.total_out == decompressedBuffer.size() )
 			{
-				::inflateEnd( &zs );
-				throw std::runtime_error( "Error reading compressed stream for " + resourceName );
+				decompressedBuffer.resize( std::max<size_t>( decompressedBuffer.size() * 2, 32768 ) );
 			}
 
-			zs.next_in = reinterpret_cast<Bytef*>( inBuffer.data() );
-
-			do
-			{
-				zs.avail_out = CHUNK_OUT_SIZE;
-				zs.next_out = reinterpret_cast<Bytef*>( outBuffer.data() );
+			zs.next_out = reinterpret_cast<Bytef*>( decompressedBuffer.data() + zs.total_out );
+			zs.avail_out = static_cast<uInt>( decompressedBuffer.size() - zs.total_out );
 
-				ret = ::inflate( &zs, Z_NO_FLUSH );
+			ret = ::inflate( &zs, Z_NO_FLUSH );
 
-				if ( ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR /* Z_BUF_ERROR is ok if avail_out is 0 */ )
-				{
-					std::string errorMsg = ( zs.msg ) ? zs.msg : "Unknown zlib error";
-					::inflateEnd( &zs );
-
-					throw std::runtime_error( "Zlib decompression failed for resource '" + resourceName +
-											  "' with error code " + std::to_string( ret ) + ": " + errorMsg );
-				}
+			const bool truncated = ret == Z_BUF_ERROR && zs.avail_in == 0 && zs.avail_out != 0;
+			if ( ( ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR /* Z_BUF_ERROR is ok if avail_out is 0 */ ) || truncated )
+			{
+				std::string errorMsg = truncated ? "Unexpected end of compressed data" : ( ( zs.msg ) ? zs.msg : "Unknown zlib error" );
+				::inflateEnd( &zs );
 
-				size_t have = CHUNK_OUT_SIZE - zs.avail_out;
-				decompressedBuffer->write( outBuffer.data(), static_cast<std::streamsize>( have ) );
-				totalDecompressedWritten += have;
-			} while ( zs.avail_out == 0 );
+				throw std::runtime_error( "Zlib decompression failed for resource '" + resourceName +
+										  "' with error code " + std::to_string( ret ) + ": " + errorMsg );
+			}
 		} while ( ret != Z_STREAM_END );
 
+		const size_t totalCompressedRead = static_cast<size_t>( zs.total_in );
+		const size_t totalDecompressedWritten = static_cast<size_t>( zs.total_out );
 		::inflateEnd( &zs );
 
-		decompressedBuffer->seekg( 0 );
+		decompressedBuffer.resize( totalDecompressedWritten );
 
 		auto endTime = std::chrono::high_resolution_clock::now();
 		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>( endTime - startTime );
@@ -789,4 +807,24 @@ namespace dnv::vista::sdk
 
 		throw std::runtime_error( "Failed to find or open resource file: " + resourceName + ". Attempted paths: [" + attemptedPathsStr + "]" );
 	}
+
+	std::optional<std::filesystem::path> EmbeddedResource::resourcePath( const std::string& resourceName )
+	{
+		const std::filesystem::path possiblePaths[]{
+			std::filesystem::current_path() / "resources" / resourceName,
+			std::filesystem::current_path() / "../resources" / resourceName,
+			std::filesystem::current_path() / "../../resources" / resourceName,
+			std::filesystem::current_path() / resourceName };
+
+		for ( const auto& path : possiblePaths )
+		{
+			std::error_code ec;
+			if ( std::filesystem::is_regular_file( path, ec ) )
+			{
+				return path;
+			}
+		}
+
+		return std::nullopt;
+	}
 }
@@ -8,10 +8,118 @@
 #include "dnv/vista/sdk/Gmod.h"
 
 #include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/GmodSnapshot.h"
 #include "dnv/vista/sdk/VISVersion.h"
 
 namespace dnv::vista::sdk
 {
+	namespace internal
+	{
+		//=====================================================================
+		// PathExistsIndex class
+		//=====================================================================
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		const PathExistsIndex::Entry* PathExistsIndex::find( uint32_t start, uint32_t target ) const
+		{
+			const uint64_t key = ( static_cast<uint64_t>( start ) << 32 ) | target;
+
+			std::shared_lock lock( m_mutex );
+
+			auto it = m_entries.find( key );
+
+			return it != m_entries.end() ? it->second.get() : nullptr;
+		}
+
+		const PathExistsIndex::Entry& PathExistsIndex::add( uint32_t start, uint32_t target, Entry&& entry )
+		{
+			const uint64_t key = ( static_cast<uint64_t>( start ) << 32 ) | target;
+
+			std::unique_lock lock( m_mutex );
+
+			/* Another thread may have added the pair since the caller's lookup */
+			auto it = m_entries.try_emplace( key, nullptr ).first;
+			if ( it->second == nullptr )
+			{
+				it->second = std::make_unique<const Entry>( std::move( entry ) );
+			}
+
+			return *it->second;
+		}
+
+		size_t PathExistsIndex::size() const
+		{
+			std::shared_lock lock( m_mutex );
+
+			return m_entries.size();
+		}
+
+		//=====================================================================
+		// SubtreeStatistics class
+		//=====================================================================
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		const SubtreeStatistics::Table* SubtreeStatistics::find( size_t maxTraversalOccurrence ) const
+		{
+			std::shared_lock lock( m_mutex );
+
+			auto it = m_tables.find( maxTraversalOccurrence );
+
+			return it != m_tables.end() ? it->second.get() : nullptr;
+		}
+
+		const SubtreeStatistics::Table& SubtreeStatistics::add( size_t maxTraversalOccurrence, Table&& table )
+		{
+			std::unique_lock lock( m_mutex );
+
+			/* Another thread may have added the table since the caller's lookup */
+			auto it = m_tables.try_emplace( maxTraversalOccurrence, nullptr ).first;
+			if ( it->second == nullptr )
+			{
+				it->second = std::make_unique<const Table>( std::move( table ) );
+			}
+
+			return *it->second;
+		}
+
+		//=====================================================================
+		// GmodInstanceId class
+		//=====================================================================
+
+		uint64_t GmodInstanceId::next() noexcept
+		{
+			static std::atomic<uint64_t> nextId{ 1 };
+
+			return nextId.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		//=====================================================================
+		// Helper functions
+		//=====================================================================
+
+		/**
+		 * @brief Hashes the fields that usually tell metadata apart.
+		 * @param metadata The metadata.
+		 * @return A hash that is equal for equal metadata.
+		 */
+		static size_t metadataHash( const GmodNodeMetadata& metadata ) noexcept
+		{
+			size_t hash = std::hash<std::string>{}( metadata.name() );
+			auto combine = [&hash]( size_t value ) { hash ^= value + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 ); };
+
+			combine( std::hash<std::string>{}( metadata.fullType() ) );
+			combine( metadata.definition().has_value() ? std::hash<std::string>{}( *metadata.definition() ) : 0 );
+
+			return hash;
+		}
+	}
+
 	//=====================================================================
 	// Gmod class
 	//=====================================================================
@@ -21,9 +129,14 @@ namespace dnv::vista::sdk
 	//----------------------------------------------
 
 	Gmod::Gmod( VisVersion version, const GmodDto& dto )
+		: Gmod{ version, dto, std::span<const int>{} }
+	{
+	}
+
+	Gmod::Gmod( VisVersion version, const GmodDto& dto, std::span<const int> seeds )
 		: m_visVersion{ version },
 		  m_rootNode{ nullptr },
-		  m_nodeMap{ [&dto, version]() {
+		  m_nodeMap{ [&dto, version, seeds]() {
 			  std::vector<std::pair<std::string, GmodNode>> nodePairs;
 			  nodePairs.reserve( dto.items().size() );
 			  for ( const auto& nodeDto : dto.items() )
@@ -31,6 +144,11 @@ namespace dnv::vista::sdk
 				  nodePairs.emplace_back( nodeDto.code(), GmodNode( version, nodeDto ) );
 			  }
 
+			  if ( !seeds.empty() )
+			  {
+				  return ChdDictionary<GmodNode>( std::move( nodePairs ), seeds );
+			  }
+
 			  return ChdDictionary<GmodNode>( std::move( nodePairs ) );
 		  }() }
 	{
@@ -110,6 +228,8 @@ namespace dnv::vista::sdk
 				VisVersionExtensions::toVersionString( version ) );
 			m_rootNode = nullptr;
 		}
+
+		buildGraph();
 	}
 
 	Gmod::Gmod( VisVersion version, const std::unordered_map<std::string, GmodNode>& nodeMap )
@@ -121,10 +241,37 @@ namespace dnv::vista::sdk
 			  for ( const auto& [code, node] : nodeMap )
 			  {
 				  pairs.emplace_back( code, node );
+
+				  /* Copies share relationships; detach them so that this Gmod's graph stays its own */
+				  auto& copy = pairs.back().second;
+				  copy.m_links = std::make_shared<GmodNode::Links>( *copy.m_links );
 			  }
 			  return ChdDictionary<GmodNode>( std::move( pairs ) );
 		  }() }
 	{
+		/* The copied relationships still point at the input map's nodes; relink them by code to this Gmod's nodes */
+		auto relink = [this]( std::vector<GmodNode*>& related, [[maybe_unused]] const std::string& code ) {
+			size_t kept = 0;
+			for ( GmodNode* node : related )
+			{
+				const GmodNode* ownNode = nullptr;
+				if ( !m_nodeMap.tryGetValue( node->code(), ownNode ) || !ownNode )
+				{
+					SPDLOG_WARN( "Gmod constructor from map: Node '{}' related to '{}' is not in the map. Relation skipped.", node->code(), code );
+					continue;
+				}
+				related[kept++] = const_cast<GmodNode*>( ownNode );
+			}
+			related.resize( kept );
+		};
+
+		for ( auto& [key, node] : m_nodeMap )
+		{
+			GmodNode::Links& links = *const_cast<GmodNode&>( node ).m_links;
+			relink( links.children, key );
+			relink( links.parents, key );
+		}
+
 		const GmodNode* rootNodePtr = nullptr;
 		bool rootFound = m_nodeMap.tryGetValue( "VE", rootNodePtr );
 		if ( rootFound && rootNodePtr )
@@ -155,6 +302,104 @@ namespace dnv::vista::sdk
 		{
 			SPDLOG_WARN( "Gmod constructor from map: m_nodeMap size ({}) does not match input nodeMap size ({}).", m_nodeMap.size(), nodeMap.size() );
 		}
+
+		buildGraph();
+	}
+
+	Gmod::Gmod( const GmodSnapshot& snapshot )
+		: m_visVersion{ snapshot.visVersion() },
+		  m_rootNode{ nullptr },
+		  m_nodeMap{ [&snapshot]() {
+			  const auto records = snapshot.nodes();
+			  const auto slots = snapshot.slots();
+			  const VisVersion version = snapshot.visVersion();
+
+			  auto makeNode = [&snapshot, version]( const internal::GmodSnapshotNode& record ) {
+				  std::unordered_map<std::string, std::string> normalAssignmentNames;
+				  normalAssignmentNames.reserve( record.assignmentsCount );
+				  for ( const auto& assignment : snapshot.assignments( record ) )
+				  {
+					  normalAssignmentNames.emplace( snapshot.string( assignment.key ), snapshot.string( assignment.value ) );
+				  }
+
+				  auto toOptional = []( std::optional<std::string_view> value ) -> std::optional<std::string> {
+					  return value.has_value() ? std::optional<std::string>{ std::string{ *value } } : std::nullopt;
+				  };
+
+				  std::optional<bool> installSubstructure;
+				  if ( record.installSubstructure != 0 )
+				  {
+					  installSubstructure = record.installSubstructure == 2;
+				  }
+
+				  return GmodNode{
+					  version,
+					  std::string{ snapshot.string( record.code ) },
+					  GmodNodeMetadata{
+						  std::string{ snapshot.string( record.category ) },
+						  std::string{ snapshot.string( record.type ) },
+						  std::string{ snapshot.string( record.name ) },
+						  toOptional( snapshot.optionalString( record.commonName ) ),
+						  toOptional( snapshot.optionalString( record.definition ) ),
+						  toOptional( snapshot.optionalString( record.commonDefinition ) ),
+						  installSubstructure,
+						  normalAssignmentNames } };
+			  };
+
+			  /* Empty slots hold a copy of the first node with an empty key, as in regular construction */
+			  const GmodNode filler = makeNode( records[0] );
+
+			  std::vector<std::pair<std::string, GmodNode>> table;
+			  table.reserve( slots.size() );
+			  for ( const uint32_t index : slots )
+			  {
+				  if ( index == internal::GMOD_SNAPSHOT_NPOS )
+				  {
+					  table.emplace_back( std::string{}, filler );
+				  }
+				  else
+				  {
+					  table.emplace_back( std::string{ snapshot.string( records[index].code ) }, makeNode( records[index] ) );
+				  }
+			  }
+
+			  /* Link in place: moving the table into the dictionary keeps element addresses stable */
+			  for ( const auto& record : records )
+			  {
+				  GmodNode& node = table[record.slot].second;
+
+				  for ( const uint32_t child : snapshot.children( record ) )
+				  {
+					  node.addChild( &table[records[child].slot].second );
+				  }
+
+				  for ( const uint32_t parent : snapshot.parents( record ) )
+				  {
+					  node.addParent( &table[records[parent].slot].second );
+				  }
+
+				  node.trim();
+			  }
+
+			  const auto seeds = snapshot.seeds();
+
+			  return ChdDictionary<GmodNode>( std::move( table ), std::vector<int>( seeds.begin(), seeds.end() ) );
+		  }() }
+	{
+		const GmodNode* rootNodePtr = nullptr;
+		bool rootFound = m_nodeMap.tryGetValue( "VE", rootNodePtr );
+		if ( rootFound && rootNodePtr )
+		{
+			m_rootNode = const_cast<GmodNode*>( rootNodePtr );
+		}
+		else
+		{
+			SPDLOG_ERROR( "Gmod constructor: Root node 'VE' not found in snapshot for VIS version {}. GMOD is likely invalid.",
+				VisVersionExtensions::toVersionString( m_visVersion ) );
+			m_rootNode = nullptr;
+		}
+
+		buildGraph();
 	}
 
 	//----------------------------------------------
@@ -166,6 +411,36 @@ namespace dnv::vista::sdk
 		return m_nodeMap.tryGetValue( code, node );
 	}
 
+	bool Gmod::tryGetNode( uint32_t codeId, const GmodNode*& node ) const
+	{
+		const std::vector<uint32_t>& indices = m_graph->indicesByCodeId;
+		if ( codeId >= indices.size() || indices[codeId] == 0 )
+		{
+			node = nullptr;
+
+			return false;
+		}
+
+		node = m_graph->nodes[indices[codeId] - 1];
+
+		return true;
+	}
+
+	size_t Gmod::tryGetNodes( std::span<const std::string_view> codes, std::span<const GmodNode*> nodes ) const
+	{
+		return m_nodeMap.tryGetValues( codes, nodes );
+	}
+
+	internal::PathExistsIndex& Gmod::pathExistsIndex() const noexcept
+	{
+		return *m_pathExistsIndex;
+	}
+
+	internal::SubtreeStatistics& Gmod::subtreeStatistics() const noexcept
+	{
+		return *m_subtreeStatistics;
+	}
+
 	//----------------------------------------------
 	// Path parsing & navigation
 	//----------------------------------------------
@@ -199,6 +474,201 @@ namespace dnv::vista::sdk
 		return Enumerator( &m_nodeMap );
 	}
 
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
+
+	void Gmod::buildGraph()
+	{
+		auto graph = std::make_shared<internal::GmodGraph>();
+
+		/* Nodes with equal metadata share one object; it lives as long as a node, or a copy of one, refers to it */
+		std::unordered_multimap<size_t, std::shared_ptr<const GmodNodeMetadata>> sharedMetadata;
+		sharedMetadata.reserve( m_nodeMap.size() );
+
+		graph->nodes.reserve( m_nodeMap.size() );
+		graph->flags.reserve( m_nodeMap.size() );
+		for ( const auto& [key, node] : m_nodeMap )
+		{
+			GmodNode& mutableNode = const_cast<GmodNode&>( node );
+			mutableNode.m_links->graph = graph.get();
+			mutableNode.m_links->graphIndex = static_cast<uint32_t>( graph->nodes.size() );
+
+			std::shared_ptr<const GmodNodeMetadata>& metadata = mutableNode.m_links->metadata;
+			const size_t hash = internal::metadataHash( *metadata );
+			auto [first, last] = sharedMetadata.equal_range( hash );
+			auto equal = std::find_if( first, last, [&metadata]( const auto& entry ) { return *entry.second == *metadata; } );
+			if ( equal != last )
+			{
+				metadata = equal->second;
+				mutableNode.m_metadata = metadata.get();
+			}
+			else
+			{
+				sharedMetadata.emplace( hash, metadata );
+			}
+
+			graph->nodes.push_back( &node );
+			graph->flags.push_back( node.flags() );
+
+			if ( node.codeId() >= graph->indicesByCodeId.size() )
+			{
+				graph->indicesByCodeId.resize( node.codeId() + 1, 0 );
+			}
+			graph->indicesByCodeId[node.codeId()] = static_cast<uint32_t>( graph->nodes.size() );
+		}
+
+		const size_t nodeCount = graph->nodes.size();
+		graph->childOffsets.reserve( nodeCount + 1 );
+		graph->parentOffsets.reserve( nodeCount + 1 );
+
+		for ( const GmodNode* node : graph->nodes )
+		{
+			resolveProductNodes( const_cast<GmodNode&>( *node ) );
+
+			graph->childOffsets.push_back( static_cast<uint32_t>( graph->children.size() ) );
+			for ( const GmodNode* child : node->children() )
+			{
+				graph->children.push_back( child->graphIndex() );
+				graph->childCodeIds.push_back( child->codeId() );
+			}
+			std::sort( graph->childCodeIds.begin() + graph->childOffsets.back(), graph->childCodeIds.end() );
+
+			graph->parentOffsets.push_back( static_cast<uint32_t>( graph->parents.size() ) );
+			for ( const GmodNode* parent : node->parents() )
+			{
+				graph->parents.push_back( parent->graphIndex() );
+			}
+		}
+		graph->childOffsets.push_back( static_cast<uint32_t>( graph->children.size() ) );
+		graph->parentOffsets.push_back( static_cast<uint32_t>( graph->parents.size() ) );
+
+		buildReachLabels( *graph );
+
+		m_graph = std::move( graph );
+		m_pathExistsIndex = std::make_shared<internal::PathExistsIndex>();
+		m_subtreeStatistics = std::make_shared<internal::SubtreeStatistics>();
+	}
+
+	void Gmod::buildReachLabels( internal::GmodGraph& graph )
+	{
+		const size_t nodeCount = graph.nodes.size();
+		graph.reach.resize( nodeCount );
+
+		std::vector<uint32_t> postOrder;
+		std::vector<uint32_t> rank( nodeCount );
+		std::vector<bool> visited;
+		std::vector<std::pair<uint32_t, uint32_t>> stack;
+		postOrder.reserve( nodeCount );
+
+		for ( size_t labelling = 0; labelling < internal::GmodGraph::REACH_LABELLINGS; ++labelling )
+		{
+			/* Odd labellings visit roots and children in reverse order */
+			const bool reverse = ( labelling % 2 ) != 0;
+			auto childAt = [&graph, reverse]( uint32_t index, uint32_t position ) {
+				const auto children = graph.childrenOf( index );
+				return reverse ? children[children.size() - 1 - position] : children[position];
+			};
+
+			postOrder.clear();
+			visited.assign( nodeCount, false );
+			for ( size_t i = 0; i < nodeCount; ++i )
+			{
+				const uint32_t start = static_cast<uint32_t>( reverse ? nodeCount - 1 - i : i );
+				if ( visited[start] || !graph.parentsOf( start ).empty() )
+				{
+					continue;
+				}
+
+				visited[start] = true;
+				stack.emplace_back( start, 0 );
+				while ( !stack.empty() )
+				{
+					auto& [index, position] = stack.back();
+					if ( position < graph.childrenOf( index ).size() )
+					{
+						const uint32_t child = childAt( index, position++ );
+						if ( !visited[child] )
+						{
+							visited[child] = true;
+							stack.emplace_back( child, 0 );
+						}
+						continue;
+					}
+
+					rank[index] = static_cast<uint32_t>( postOrder.size() );
+					postOrder.push_back( index );
+					stack.pop_back();
+				}
+			}
+
+			/* Nodes only reachable through a cycle have no parentless ancestor */
+			for ( uint32_t index = 0; index < nodeCount; ++index )
+			{
+				if ( !visited[index] )
+				{
+					visited[index] = true;
+					rank[index] = static_cast<uint32_t>( postOrder.size() );
+					postOrder.push_back( index );
+				}
+			}
+
+			for ( uint32_t index = 0; index < nodeCount; ++index )
+			{
+				graph.reach[index][labelling] = { rank[index], rank[index] };
+			}
+
+			/* Children come first in post-order, so one pass is exact for a DAG; cycles need more */
+			bool changed = true;
+			while ( changed )
+			{
+				changed = false;
+				for ( const uint32_t index : postOrder )
+				{
+					auto& interval = graph.reach[index][labelling];
+					for ( const uint32_t child : graph.childrenOf( index ) )
+					{
+						const auto& inner = graph.reach[child][labelling];
+						if ( inner.low < interval.low )
+						{
+							interval.low = inner.low;
+							changed = true;
+						}
+						if ( inner.high > interval.high )
+						{
+							interval.high = inner.high;
+							changed = true;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void Gmod::resolveProductNodes( GmodNode& node )
+	{
+		node.m_links->productType = nullptr;
+		node.m_links->productSelection = nullptr;
+
+		const auto& children = node.m_links->children;
+		if ( children.size() != 1 || !( node.m_flags & internal::GmodNodeFlags::CATEGORY_HAS_FUNCTION ) )
+		{
+			return;
+		}
+
+		const GmodNode* child = children[0];
+		constexpr uint16_t selectionMask = internal::GmodNodeFlags::CATEGORY_HAS_PRODUCT | internal::GmodNodeFlags::TYPE_SELECTION;
+
+		if ( child->m_flags & internal::GmodNodeFlags::PRODUCT_TYPE )
+		{
+			node.m_links->productType = child;
+		}
+		if ( ( child->m_flags & selectionMask ) == selectionMask )
+		{
+			node.m_links->productSelection = child;
+		}
+	}
+
 	//----------------------------------------------
 	// Gmod::Enumerator class
 	//----------------------------------------------
@@ -54,6 +54,706 @@ namespace dnv::vista::sdk
 
 			return cache.emplace( value, value ).first->first;
 		}
+
+		//=====================================================================
+		// SAX parsing
+		//=====================================================================
+
+		/**
+		 * @brief Builds a GmodDto from nlohmann::json SAX events
+		 * @details Applies the same validation as GmodDto::tryFromJson and GmodNodeDto::tryFromJson,
+		 *          but moves each token into its node or relation as it arrives instead of building a DOM.
+		 *          Unknown keys and malformed values are skipped without being materialized.
+		 */
+		class GmodDtoSaxHandler final
+		{
+		public:
+			//----------------------------------------------
+			// SAX interface
+			//----------------------------------------------
+
+			bool null()
+			{
+				return skipping( 0 ) || scalar( true );
+			}
+
+			bool boolean( bool value )
+			{
+				if ( skipping( 0 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Item && m_field == Field::InstallSubstructure )
+				{
+					m_node.installSubstructure = value;
+
+					return true;
+				}
+
+				return scalar( false );
+			}
+
+			bool number_integer( nlohmann::json::number_integer_t )
+			{
+				return skipping( 0 ) || scalar( false );
+			}
+
+			bool number_unsigned( nlohmann::json::number_unsigned_t )
+			{
+				return skipping( 0 ) || scalar( false );
+			}
+
+			bool number_float( nlohmann::json::number_float_t, const nlohmann::json::string_t& )
+			{
+				return skipping( 0 ) || scalar( false );
+			}
+
+			bool binary( nlohmann::json::binary_t& )
+			{
+				return skipping( 0 ) || scalar( false );
+			}
+
+			bool string( nlohmann::json::string_t& value )
+			{
+				if ( skipping( 0 ) )
+				{
+					return true;
+				}
+
+				switch ( m_scope )
+				{
+					case Scope::Root:
+					{
+						if ( m_field == Field::VisRelease )
+						{
+							m_visVersion = std::move( value );
+
+							return true;
+						}
+
+						break;
+					}
+					case Scope::Item:
+					{
+						std::optional<std::string>* target = nodeString( m_field );
+						if ( target != nullptr )
+						{
+							*target = std::move( value );
+
+							return true;
+						}
+
+						break;
+					}
+					case Scope::Assignments:
+					{
+						m_node.normalAssignmentNames.insert_or_assign( std::move( m_assignmentKey ), std::move( value ) );
+
+						return true;
+					}
+					case Scope::Relation:
+					{
+						m_relation.emplace_back( std::move( value ) );
+
+						return true;
+					}
+					case Scope::Document:
+					case Scope::Items:
+					case Scope::Relations:
+					{
+						break;
+					}
+				}
+
+				return scalar( false );
+			}
+
+			bool key( nlohmann::json::string_t& key )
+			{
+				if ( skipping( 0 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Assignments )
+				{
+					m_assignmentKey = std::move( key );
+
+					return true;
+				}
+
+				m_field = m_scope == Scope::Root ? rootField( key ) : itemField( key );
+				if ( m_field == Field::Unknown )
+				{
+					m_skipNext = true;
+				}
+
+				return true;
+			}
+
+			bool start_object( std::size_t )
+			{
+				if ( skipping( 1 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Document )
+				{
+					m_scope = Scope::Root;
+
+					return true;
+				}
+				if ( m_scope == Scope::Items )
+				{
+					m_node = {};
+					m_scope = Scope::Item;
+
+					return true;
+				}
+				if ( m_scope == Scope::Item && m_field == Field::NormalAssignmentNames )
+				{
+					m_node.hasAssignments = true;
+					m_node.assignmentsValid = true;
+					m_node.normalAssignmentNames.clear();
+					m_scope = Scope::Assignments;
+
+					return true;
+				}
+
+				return container();
+			}
+
+			bool end_object()
+			{
+				if ( skipping( -1 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Root )
+				{
+					m_scope = Scope::Document;
+				}
+				else if ( m_scope == Scope::Item )
+				{
+					finishNode();
+					m_scope = Scope::Items;
+				}
+				else if ( m_scope == Scope::Assignments )
+				{
+					m_scope = Scope::Item;
+				}
+
+				return true;
+			}
+
+			bool start_array( std::size_t )
+			{
+				if ( skipping( 1 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Root && m_field == Field::Items )
+				{
+					m_hasItems = true;
+					m_scope = Scope::Items;
+
+					return true;
+				}
+				if ( m_scope == Scope::Root && m_field == Field::Relations )
+				{
+					m_scope = Scope::Relations;
+
+					return true;
+				}
+				if ( m_scope == Scope::Relations )
+				{
+					++m_relationCount;
+					m_relation.clear();
+					m_relationValid = true;
+					m_scope = Scope::Relation;
+
+					return true;
+				}
+
+				return container();
+			}
+
+			bool end_array()
+			{
+				if ( skipping( -1 ) )
+				{
+					return true;
+				}
+
+				if ( m_scope == Scope::Items || m_scope == Scope::Relations )
+				{
+					m_scope = Scope::Root;
+				}
+				else if ( m_scope == Scope::Relation )
+				{
+					if ( m_relationValid && !m_relation.empty() )
+					{
+						m_relations.emplace_back( std::move( m_relation ) );
+					}
+					m_scope = Scope::Relations;
+				}
+
+				return true;
+			}
+
+			bool parse_error( std::size_t, const std::string&, const nlohmann::json::exception& ex )
+			{
+				m_error = ex.what();
+
+				return false;
+			}
+
+			//----------------------------------------------
+			// Result
+			//----------------------------------------------
+
+			[[nodiscard]] const std::string& error() const noexcept
+			{
+				return m_error;
+			}
+
+			std::optional<GmodDto> result()
+			{
+				if ( !m_visVersion.has_value() )
+				{
+					SPDLOG_ERROR( "GMOD JSON missing required '{}' field or not a string", VIS_RELEASE_KEY );
+
+					return std::nullopt;
+				}
+				if ( !m_hasItems )
+				{
+					SPDLOG_WARN( "GMOD missing 'items' array for VIS version {}", *m_visVersion );
+				}
+
+				SPDLOG_DEBUG( "Successfully parsed {}/{} GMOD nodes", m_items.size(), m_itemCount );
+				SPDLOG_DEBUG( "Successfully parsed {}/{} GMOD relations", m_relations.size(), m_relationCount );
+
+				return GmodDto{ std::move( *m_visVersion ), std::move( m_items ), std::move( m_relations ) };
+			}
+
+		private:
+			//----------------------------------------------
+			// Parser state
+			//----------------------------------------------
+
+			/** @brief The container the parser is currently in */
+			enum class Scope : std::uint8_t
+			{
+				Document,
+				Root,
+				Items,
+				Item,
+				Assignments,
+				Relations,
+				Relation
+			};
+
+			/** @brief The known key whose value is expected next */
+			enum class Field : std::uint8_t
+			{
+				Unknown,
+				VisRelease,
+				Items,
+				Relations,
+				Category,
+				Type,
+				Code,
+				Name,
+				CommonName,
+				Definition,
+				CommonDefinition,
+				InstallSubstructure,
+				NormalAssignmentNames
+			};
+
+			/** @brief The fields of the node being parsed */
+			struct NodeFields
+			{
+				std::optional<std::string> category;
+				std::optional<std::string> type;
+				std::optional<std::string> code;
+				std::optional<std::string> name;
+				std::optional<std::string> commonName;
+				std::optional<std::string> definition;
+				std::optional<std::string> commonDefinition;
+				std::optional<bool> installSubstructure;
+				GmodNodeDto::NormalAssignmentNamesMap normalAssignmentNames;
+				bool nameInvalid = false;
+				bool hasAssignments = false;
+				bool assignmentsValid = false;
+			};
+
+			//----------------------------------------------
+			// Helpers
+			//----------------------------------------------
+
+			/**
+			 * @brief Consumes the events of a skipped value
+			 * @param nesting 1 for an opening event, -1 for a closing one, 0 for a scalar or key
+			 * @return True if the event belongs to a skipped value
+			 */
+			bool skipping( int nesting ) noexcept
+			{
+				if ( m_skipDepth > 0 )
+				{
+					m_skipDepth += nesting;
+
+					return true;
+				}
+				if ( m_skipNext )
+				{
+					m_skipNext = false;
+					m_skipDepth = nesting > 0 ? 1 : 0;
+
+					return true;
+				}
+
+				return false;
+			}
+
+			/** @brief Skips a container of an unexpected type, after recording it as a scalar */
+			bool container()
+			{
+				scalar( false );
+				m_skipDepth = 1;
+
+				return true;
+			}
+
+			/**
+			 * @brief Records a value of an unexpected type in the current scope
+			 * @param isNull True if the value is a JSON null, which optional node fields accept
+			 */
+			bool scalar( bool isNull )
+			{
+				switch ( m_scope )
+				{
+					case Scope::Root:
+					{
+						if ( m_field == Field::Items )
+						{
+							m_hasItems = true;
+							SPDLOG_WARN( "GMOD 'items' field is not an array for VIS version {}", m_visVersion.value_or( "" ) );
+						}
+						else if ( m_field == Field::Relations )
+						{
+							SPDLOG_WARN( "GMOD 'relations' field is not an array for VIS version {}", m_visVersion.value_or( "" ) );
+						}
+						else if ( m_field == Field::VisRelease )
+						{
+							m_visVersion = std::nullopt;
+						}
+
+						break;
+					}
+					case Scope::Items:
+					{
+						++m_itemCount;
+						SPDLOG_WARN( "Skipping malformed GMOD node at index {} during GmodDto parsing for VIS version {}", m_itemCount - 1, m_visVersion.value_or( "" ) );
+
+						break;
+					}
+					case Scope::Item:
+					{
+						invalidField( isNull );
+
+						break;
+					}
+					case Scope::Assignments:
+					{
+						m_node.assignmentsValid = false;
+
+						break;
+					}
+					case Scope::Relations:
+					{
+						++m_relationCount;
+						SPDLOG_WARN( "Non-array entry found in 'relations' array for VIS version {}", m_visVersion.value_or( "" ) );
+
+						break;
+					}
+					case Scope::Relation:
+					{
+						if ( m_relationValid )
+						{
+							SPDLOG_WARN( "Non-string value found in relation entry for VIS version {}", m_visVersion.value_or( "" ) );
+						}
+						m_relationValid = false;
+
+						break;
+					}
+					case Scope::Document:
+					{
+						break;
+					}
+				}
+
+				return true;
+			}
+
+			/**
+			 * @brief Records a node field holding a value of the wrong type
+			 * @param isNull True if the value is a JSON null
+			 */
+			void invalidField( bool isNull )
+			{
+				switch ( m_field )
+				{
+					case Field::Category:
+					{
+						m_node.category = std::nullopt;
+
+						break;
+					}
+					case Field::Type:
+					{
+						m_node.type = std::nullopt;
+
+						break;
+					}
+					case Field::Code:
+					{
+						m_node.code = std::nullopt;
+
+						break;
+					}
+					case Field::Name:
+					{
+						m_node.nameInvalid = true;
+
+						break;
+					}
+					case Field::CommonName:
+					case Field::Definition:
+					case Field::CommonDefinition:
+					{
+						if ( !isNull )
+						{
+							SPDLOG_WARN( "GMOD Node code='{}' has non-string '{}'", m_node.code.value_or( "" ), fieldKey( m_field ) );
+						}
+
+						break;
+					}
+					case Field::InstallSubstructure:
+					{
+						if ( !isNull )
+						{
+							SPDLOG_WARN( "GMOD Node code='{}' has non-bool '{}'", m_node.code.value_or( "" ), INSTALL_SUBSTRUCTURE_KEY );
+						}
+
+						break;
+					}
+					case Field::NormalAssignmentNames:
+					{
+						if ( !isNull )
+						{
+							SPDLOG_WARN( "GMOD Node code='{}' has non-object '{}'", m_node.code.value_or( "" ), NORMAL_ASSIGNMENT_NAMES_KEY );
+						}
+
+						break;
+					}
+					case Field::Unknown:
+					case Field::VisRelease:
+					case Field::Items:
+					case Field::Relations:
+					{
+						break;
+					}
+				}
+			}
+
+			/** @brief Validates the node being parsed, and moves it into the items */
+			void finishNode()
+			{
+				[[maybe_unused]] const size_t index = m_itemCount++;
+
+				NodeFields& node = m_node;
+				const bool valid = [&] {
+					if ( !node.code.has_value() )
+					{
+						SPDLOG_ERROR( "GMOD Node JSON missing required '{}' field or not a string", CODE_KEY );
+
+						return false;
+					}
+					if ( node.code->empty() )
+					{
+						SPDLOG_WARN( "Empty code field found in GMOD node" );
+					}
+					if ( !node.category.has_value() )
+					{
+						SPDLOG_ERROR( "GMOD Node JSON (code='{}') missing required '{}' field or not a string", *node.code, CATEGORY_KEY );
+
+						return false;
+					}
+					if ( !node.type.has_value() )
+					{
+						SPDLOG_ERROR( "GMOD Node JSON (code='{}') missing required '{}' field or not a string", *node.code, TYPE_KEY );
+
+						return false;
+					}
+					if ( node.nameInvalid )
+					{
+						SPDLOG_ERROR( "GMOD Node JSON (code='{}') field '{}' is present but not a string", *node.code, NAME_KEY );
+
+						return false;
+					}
+
+					return true;
+				}();
+
+				if ( !valid )
+				{
+					SPDLOG_WARN( "Skipping malformed GMOD node at index {} during GmodDto parsing for VIS version {}", index, m_visVersion.value_or( "" ) );
+
+					return;
+				}
+
+				if ( !node.name.has_value() )
+				{
+					SPDLOG_WARN( "GMOD Node JSON (code='{}') missing '{}' field. Defaulting name to empty string.", *node.code, NAME_KEY );
+				}
+				if ( node.category->empty() )
+				{
+					SPDLOG_WARN( "Empty category field found in GMOD node code='{}'", *node.code );
+				}
+				if ( node.type->empty() )
+				{
+					SPDLOG_WARN( "Empty type field found in GMOD node code='{}'", *node.code );
+				}
+				if ( !node.name.has_value() || node.name->empty() )
+				{
+					SPDLOG_WARN( "Empty name field used for GMOD node code='{}'", *node.code );
+				}
+				if ( node.hasAssignments && !node.assignmentsValid )
+				{
+					SPDLOG_WARN( "GMOD Node code='{}' failed to parse '{}' object", *node.code, NORMAL_ASSIGNMENT_NAMES_KEY );
+				}
+
+				std::optional<GmodNodeDto::NormalAssignmentNamesMap> normalAssignmentNames = std::nullopt;
+				if ( node.hasAssignments && node.assignmentsValid && !node.normalAssignmentNames.empty() )
+				{
+					normalAssignmentNames = std::move( node.normalAssignmentNames );
+				}
+
+				m_items.emplace_back(
+					internString( *node.category ),
+					internString( *node.type ),
+					std::move( *node.code ),
+					std::move( node.name ).value_or( std::string{} ),
+					std::move( node.commonName ),
+					std::move( node.definition ),
+					std::move( node.commonDefinition ),
+					node.installSubstructure,
+					std::move( normalAssignmentNames ) );
+			}
+
+			/** @brief Returns the storage of a string node field, or nullptr for other fields */
+			std::optional<std::string>* nodeString( Field field ) noexcept
+			{
+				switch ( field )
+				{
+					case Field::Category:
+						return &m_node.category;
+					case Field::Type:
+						return &m_node.type;
+					case Field::Code:
+						return &m_node.code;
+					case Field::Name:
+						m_node.nameInvalid = false;
+						return &m_node.name;
+					case Field::CommonName:
+						return &m_node.commonName;
+					case Field::Definition:
+						return &m_node.definition;
+					case Field::CommonDefinition:
+						return &m_node.commonDefinition;
+					default:
+						return nullptr;
+				}
+			}
+
+			static Field rootField( const std::string& key ) noexcept
+			{
+				if ( key == VIS_RELEASE_KEY )
+					return Field::VisRelease;
+				if ( key == ITEMS_KEY )
+					return Field::Items;
+				if ( key == RELATIONS_KEY )
+					return Field::Relations;
+
+				return Field::Unknown;
+			}
+
+			static Field itemField( const std::string& key ) noexcept
+			{
+				static constexpr std::pair<const char*, Field> fields[]{
+					{ CATEGORY_KEY, Field::Category },
+					{ TYPE_KEY, Field::Type },
+					{ CODE_KEY, Field::Code },
+					{ NAME_KEY, Field::Name },
+					{ COMMON_NAME_KEY, Field::CommonName },
+					{ DEFINITION_KEY, Field::Definition },
+					{ COMMON_DEFINITION_KEY, Field::CommonDefinition },
+					{ INSTALL_SUBSTRUCTURE_KEY, Field::InstallSubstructure },
+					{ NORMAL_ASSIGNMENT_NAMES_KEY, Field::NormalAssignmentNames } };
+
+				for ( const auto& [name, field] : fields )
+				{
+					if ( key == name )
+					{
+						return field;
+					}
+				}
+
+				return Field::Unknown;
+			}
+
+			static const char* fieldKey( Field field ) noexcept
+			{
+				switch ( field )
+				{
+					case Field::CommonName:
+						return COMMON_NAME_KEY;
+					case Field::Definition:
+						return DEFINITION_KEY;
+					case Field::CommonDefinition:
+						return COMMON_DEFINITION_KEY;
+					default:
+						return "";
+				}
+			}
+
+			//----------------------------------------------
+			// Member variables
+			//----------------------------------------------
+
+			Scope m_scope = Scope::Document;
+			Field m_field = Field::Unknown;
+			bool m_skipNext = false;
+			int m_skipDepth = 0;
+
+			NodeFields m_node;
+			std::string m_assignmentKey;
+			GmodDto::Relation m_relation;
+			bool m_relationValid = true;
+
+			std::optional<std::string> m_visVersion;
+			bool m_hasItems = false;
+			size_t m_itemCount = 0;
+			size_t m_relationCount = 0;
+			GmodDto::Items m_items;
+			GmodDto::Relations m_relations;
+			std::string m_error;
+		};
 	}
 
 	//=====================================================================
@@ -681,6 +1381,38 @@ namespace dnv::vista::sdk
 		return std::move( dtoOpt.value() );
 	}
 
+	std::optional<GmodDto> GmodDto::tryParse( std::string_view jsonText )
+	{
+		auto startTime = std::chrono::steady_clock::now();
+
+		try
+		{
+			GmodDtoSaxHandler handler;
+			if ( !nlohmann::json::sax_parse( jsonText.data(), jsonText.data() + jsonText.size(), &handler ) )
+			{
+				SPDLOG_ERROR( "JSON parse error during GmodDto parsing: {}", handler.error() );
+
+				return std::nullopt;
+			}
+
+			auto resultDto = handler.result();
+			if ( resultDto.has_value() )
+			{
+				auto duration = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - startTime );
+				SPDLOG_DEBUG( "Parsed GmodDto with {} nodes, {} relations and VIS version {} in {} ms",
+					resultDto->items().size(), resultDto->relations().size(), resultDto->visVersion(), duration.count() );
+			}
+
+			return resultDto;
+		}
+		catch ( [[maybe_unused]] const std::exception& ex )
+		{
+			SPDLOG_ERROR( "Standard exception during GmodDto parsing: {}", ex.what() );
+
+			return std::nullopt;
+		}
+	}
+
 	nlohmann::json GmodDto::toJson() const
 	{
 		auto startTime = std::chrono::steady_clock::now();
@@ -9,6 +9,7 @@
 
 #include "dnv/vista/sdk/Gmod.h"
 #include "dnv/vista/sdk/ParsingErrors.h"
+#include "dnv/vista/sdk/StringInterner.h"
 #include "dnv/vista/sdk/VIS.h"
 #include "dnv/vista/sdk/VISVersion.h"
 
@@ -31,6 +32,75 @@ namespace dnv::vista::sdk
 
 		static constexpr std::string_view NODE_TYPE_VALUE_TYPE = "TYPE";
 		static constexpr std::string_view NODE_TYPE_VALUE_SELECTION = "SELECTION";
+		static constexpr std::string_view NODE_TYPE_VALUE_LEAF = "LEAF";
+
+		static constexpr std::string_view NODE_FULLTYPE_ASSET_FUNCTION_LEAF = "ASSET FUNCTION LEAF";
+		static constexpr std::string_view NODE_FULLTYPE_PRODUCT_FUNCTION_LEAF = "PRODUCT FUNCTION LEAF";
+
+		static constexpr std::string_view NODE_CODE_ROOT = "VE";
+	}
+
+	//=====================================================================
+	// GmodNodeFlags struct
+	//=====================================================================
+
+	uint16_t internal::GmodNodeFlags::of( const GmodNodeMetadata& metadata )
+	{
+		const std::string& category = metadata.category();
+		const std::string& type = metadata.type();
+
+		const bool isProduct = category == NODE_CATEGORY_PRODUCT;
+		const bool isAsset = category == NODE_CATEGORY_ASSET;
+		const bool isAssetFunction = category == NODE_CATEGORY_ASSET_FUNCTION;
+		const bool isProductFunction = category == NODE_CATEGORY_PRODUCT_FUNCTION;
+		const bool isSelection = type == NODE_TYPE_VALUE_SELECTION;
+		const bool isGroup = type == NODE_TYPE_GROUP;
+		const bool isLeaf = type == NODE_TYPE_VALUE_LEAF;
+		const bool isType = type == NODE_TYPE_VALUE_TYPE;
+
+		uint16_t flags = 0;
+		flags |= isProduct && isSelection ? PRODUCT_SELECTION : 0;
+		flags |= isProduct && isType ? PRODUCT_TYPE : 0;
+		flags |= isAsset ? ASSET : 0;
+		flags |= !isProduct && !isAsset ? FUNCTION_NODE : 0;
+		flags |= isAssetFunction ? ASSET_FUNCTION_NODE : 0;
+		flags |= metadata.fullType() == NODE_FULLTYPE_ASSET_FUNCTION_LEAF || metadata.fullType() == NODE_FULLTYPE_PRODUCT_FUNCTION_LEAF ? LEAF_NODE : 0;
+		flags |= ( isAssetFunction || isProductFunction ) && type == NODE_TYPE_COMPOSITION ? FUNCTION_COMPOSITION : 0;
+		flags |= category.find( NODE_CATEGORY_VALUE_FUNCTION ) != std::string::npos ? CATEGORY_HAS_FUNCTION : 0;
+		flags |= category.find( NODE_CATEGORY_PRODUCT ) != std::string::npos ? CATEGORY_HAS_PRODUCT : 0;
+		flags |= isSelection ? TYPE_SELECTION : 0;
+		flags |= metadata.installSubstructure().has_value() && !*metadata.installSubstructure() ? SKIP_SUBSTRUCTURE : 0;
+		flags |= isSelection || isGroup || isLeaf ? POTENTIAL_PARENT : 0;
+		flags |= isGroup || isSelection || ( isProduct && isType ) || ( isAsset && isType ) ? NOT_INDIVIDUALIZABLE : 0;
+
+		return flags;
+	}
+
+	uint16_t internal::GmodNodeFlags::of( uint16_t metadataFlags, std::string_view code )
+	{
+		uint16_t flags = metadataFlags;
+		flags |= code == NODE_CODE_ROOT ? ROOT : 0;
+
+		if ( flags & FUNCTION_COMPOSITION )
+		{
+			/* A composition without a code cannot be individualized, not even in a set */
+			if ( code.empty() )
+			{
+				flags |= NOT_INDIVIDUALIZABLE;
+			}
+			else if ( code.back() == 'i' )
+			{
+				flags |= INDIVIDUALIZABLE_COMPOSITION;
+			}
+		}
+
+		const bool isProductSelectionKind = ( flags & CATEGORY_HAS_PRODUCT ) && ( flags & TYPE_SELECTION );
+		if ( !isProductSelectionKind && !( flags & ASSET ) && !code.empty() && code.back() != 'a' && code.back() != 's' )
+		{
+			flags |= MAPPABLE_KIND;
+		}
+
+		return flags;
 	}
 
 	//=====================================================================
@@ -58,8 +128,10 @@ namespace dnv::vista::sdk
 		  m_commonDefinition{ commonDefinition },
 		  m_installSubstructure{ installSubstructure },
 		  m_normalAssignmentNames{ normalAssignmentNames },
-		  m_fullType{ category + " " + type }
+		  m_fullType{ category + " " + type },
+		  m_flags{ 0 }
 	{
+		m_flags = internal::GmodNodeFlags::of( *this );
 	}
 
 	GmodNodeMetadata::GmodNodeMetadata( const GmodNodeMetadata& other )
@@ -71,7 +143,8 @@ namespace dnv::vista::sdk
 		  m_commonDefinition{ other.m_commonDefinition },
 		  m_installSubstructure{ other.m_installSubstructure },
 		  m_normalAssignmentNames{ other.m_normalAssignmentNames },
-		  m_fullType{ other.m_fullType }
+		  m_fullType{ other.m_fullType },
+		  m_flags{ other.m_flags }
 	{
 	}
 
@@ -91,6 +164,7 @@ namespace dnv::vista::sdk
 		m_installSubstructure = other.m_installSubstructure;
 		m_normalAssignmentNames = other.m_normalAssignmentNames;
 		m_fullType = other.m_fullType;
+		m_flags = other.m_flags;
 
 		return *this;
 	}
@@ -165,6 +239,11 @@ namespace dnv::vista::sdk
 		return m_normalAssignmentNames;
 	}
 
+	uint16_t GmodNodeMetadata::flags() const noexcept
+	{
+		return m_flags;
+	}
+
 	//=====================================================================
 	// GmodNode class
 	//=====================================================================
@@ -174,62 +253,34 @@ namespace dnv::vista::sdk
 	//----------------------------------------------
 
 	GmodNode::GmodNode( VisVersion version, const GmodNodeDto& dto )
-		: m_code{ dto.code() },
+		: GmodNode{ version,
+			  dto.code(),
+			  GmodNodeMetadata{
+				  dto.category(),
+				  dto.type(),
+				  dto.name(),
+				  dto.commonName(),
+				  dto.definition(),
+				  dto.commonDefinition(),
+				  dto.installSubstructure(),
+				  dto.normalAssignmentNames().has_value() ? *dto.normalAssignmentNames() : std::unordered_map<std::string, std::string>() } }
+	{
+		m_links->children.reserve( 8 );
+		m_links->parents.reserve( 4 );
+	}
+
+	GmodNode::GmodNode( VisVersion version, std::string code, GmodNodeMetadata metadata )
+		: m_code{ std::move( code ) },
+		  m_codeId{ StringInterner::instance().intern( m_code ) },
 		  m_location{ std::nullopt },
 		  m_visVersion{ version },
-		  m_metadata{
-			  dto.category(),
-			  dto.type(),
-			  dto.name(),
-			  dto.commonName(),
-			  dto.definition(),
-			  dto.commonDefinition(),
-			  dto.installSubstructure(),
-			  dto.normalAssignmentNames().has_value() ? *dto.normalAssignmentNames() : std::unordered_map<std::string, std::string>() },
-		  m_children{},
-		  m_parents{},
-		  m_childrenSet{}
-	{
-		m_children.reserve( 8 );
-		m_parents.reserve( 4 );
-		m_childrenSet.reserve( 8 );
-	}
-
-	GmodNode::GmodNode( const GmodNode& other )
-		: m_code{ other.m_code },
-		  m_location{ other.m_location },
-		  m_visVersion{ other.m_visVersion },
-		  m_metadata{ other.m_metadata },
-		  m_children{ other.m_children },
-		  m_parents{ other.m_parents },
-		  m_childrenSet{ other.m_childrenSet },
-		  m_cachedProductType{ other.m_cachedProductType },
-		  m_cachedProductSelection{ other.m_cachedProductSelection }
+		  m_metadata{ nullptr },
+		  m_flags{ 0 },
+		  m_links{ std::make_shared<Links>() }
 	{
-	}
-
-	//----------------------------------------------
-	// Assignment operators
-	//----------------------------------------------
-
-	GmodNode& GmodNode::operator=( const GmodNode& other )
-	{
-		if ( this == &other )
-		{
-			return *this;
-		}
-
-		m_code = other.m_code;
-		m_location = other.m_location;
-		m_visVersion = other.m_visVersion;
-		m_metadata = other.m_metadata;
-		m_children = other.m_children;
-		m_parents = other.m_parents;
-		m_childrenSet = other.m_childrenSet;
-		m_cachedProductType = other.m_cachedProductType;
-		m_cachedProductSelection = other.m_cachedProductSelection;
-
-		return *this;
+		m_links->metadata = std::make_shared<const GmodNodeMetadata>( std::move( metadata ) );
+		m_metadata = m_links->metadata.get();
+		m_flags = internal::GmodNodeFlags::of( m_metadata->flags(), m_code );
 	}
 
 	//----------------------------------------------
@@ -238,7 +289,7 @@ namespace dnv::vista::sdk
 
 	bool GmodNode::operator==( const GmodNode& other ) const
 	{
-		if ( m_code != other.m_code )
+		if ( m_codeId != other.m_codeId )
 		{
 			return false;
 		}
@@ -284,6 +335,11 @@ namespace dnv::vista::sdk
 		return m_code;
 	}
 
+	uint32_t GmodNode::codeId() const noexcept
+	{
+		return m_codeId;
+	}
+
 	const std::optional<Location>& GmodNode::location() const
 	{
 		return m_location;
@@ -296,7 +352,7 @@ namespace dnv::vista::sdk
 
 	const GmodNodeMetadata& GmodNode::metadata() const
 	{
-		return m_metadata;
+		return *m_metadata;
 	}
 
 	size_t GmodNode::hashCode() const noexcept
@@ -311,89 +367,47 @@ namespace dnv::vista::sdk
 		return hash;
 	}
 
+	uint16_t GmodNode::flags() const noexcept
+	{
+		return m_flags;
+	}
+
 	//----------------------------------------------
 	// Relationship accessors
 	//----------------------------------------------
 
 	const std::vector<GmodNode*>& GmodNode::children() const
 	{
-		return m_children;
+		return m_links->children;
 	}
 
 	const std::vector<GmodNode*>& GmodNode::parents() const
 	{
-		return m_parents;
+		return m_links->parents;
 	}
 
 	const GmodNode* GmodNode::productType() const
 	{
-		if ( m_children.size() != 1 )
-		{
-			return nullptr;
-		}
-
-		if ( m_metadata.category().find( NODE_CATEGORY_VALUE_FUNCTION ) == std::string::npos )
-		{
-			SPDLOG_WARN( "Product type check failed: expected FUNCTION category, found {}", m_metadata.category() );
-			return nullptr;
-		}
-
-		const GmodNode* child = m_children[0];
-		if ( !child )
-		{
-			SPDLOG_WARN( "Product type check failed: child is null" );
-			return nullptr;
-		}
-
-		if ( child->m_metadata.category() != NODE_CATEGORY_PRODUCT )
-		{
-			SPDLOG_WARN( "Product type check failed: expected PRODUCT category, found {}", child->m_metadata.category() );
-			return nullptr;
-		}
-
-		if ( child->m_metadata.type() != NODE_TYPE_VALUE_TYPE )
-		{
-			SPDLOG_WARN( "Product type check failed: expected TYPE type, found {}", child->m_metadata.type() );
-			return nullptr;
-		}
-
-		return child;
+		return m_links->productType;
 	}
 
 	const GmodNode* GmodNode::productSelection() const
 	{
-		if ( m_children.size() != 1 )
-		{
-			SPDLOG_WARN( "Product selection check failed: expected 1 child, found {}", m_children.size() );
-			return nullptr;
-		}
-
-		if ( m_metadata.category().find( NODE_CATEGORY_VALUE_FUNCTION ) == std::string::npos )
-		{
-			SPDLOG_WARN( "Product selection check failed: current node category '{}' does not contain '{}'", m_metadata.category(), NODE_CATEGORY_VALUE_FUNCTION );
-			return nullptr;
-		}
-
-		const GmodNode* child = m_children[0];
-		if ( !child )
-		{
-			SPDLOG_WARN( "Product selection check failed: child pointer is null" );
-			return nullptr;
-		}
+		return m_links->productSelection;
+	}
 
-		if ( child->m_metadata.category().find( NODE_CATEGORY_PRODUCT ) == std::string::npos )
-		{
-			SPDLOG_WARN( "Product selection check failed: child category '{}' does not contain '{}'", child->m_metadata.category(), NODE_CATEGORY_PRODUCT );
-			return nullptr;
-		}
+	//----------------------------------------------
+	// Graph accessors
+	//----------------------------------------------
 
-		if ( child->m_metadata.type() != NODE_TYPE_VALUE_SELECTION )
-		{
-			SPDLOG_WARN( "Product selection check failed: child type '{}' is not '{}'", child->m_metadata.type(), NODE_TYPE_VALUE_SELECTION );
-			return nullptr;
-		}
+	const internal::GmodGraph* GmodNode::graph() const noexcept
+	{
+		return m_links->graph;
+	}
 
-		return child;
+	uint32_t GmodNode::graphIndex() const noexcept
+	{
+		return m_links->graphIndex;
 	}
 
 	//----------------------------------------------
@@ -423,7 +437,7 @@ namespace dnv::vista::sdk
 
 	GmodNode GmodNode::withLocation( std::string_view locationStr ) const
 	{
-		Locations locations = VIS::instance().locations( m_visVersion );
+		const Locations& locations = VIS::instance().locations( m_visVersion );
 		Location location = locations.parse( locationStr );
 
 		return withLocation( location );
@@ -431,7 +445,7 @@ namespace dnv::vista::sdk
 
 	GmodNode GmodNode::tryWithLocation( std::string_view locationStr ) const
 	{
-		Locations locations = VIS::instance().locations( m_visVersion );
+		const Locations& locations = VIS::instance().locations( m_visVersion );
 		Location parsedLocation;
 
 		if ( !locations.tryParse( locationStr, parsedLocation ) )
@@ -444,7 +458,7 @@ namespace dnv::vista::sdk
 
 	GmodNode GmodNode::tryWithLocation( std::string_view locationStr, ParsingErrors& errors ) const
 	{
-		auto locations = VIS::instance().locations( m_visVersion );
+		const Locations& locations = VIS::instance().locations( m_visVersion );
 
 		Location location;
 		if ( !locations.tryParse( locationStr, location, errors ) )
@@ -465,37 +479,25 @@ namespace dnv::vista::sdk
 		return withLocation( location.value() );
 	}
 
+	GmodLocatedNode GmodNode::located( const std::optional<Location>& location ) const
+	{
+		return GmodLocatedNode{ *this, location };
+	}
+
 	//----------------------------------------------
 	// Node type checking methods
 	//----------------------------------------------
 
 	bool GmodNode::isIndividualizable( bool isTargetNode, bool isInSet ) const
 	{
-		if ( m_metadata.type() == NODE_TYPE_GROUP )
-		{
-			return false;
-		}
-		if ( m_metadata.type() == NODE_TYPE_VALUE_SELECTION )
-		{
-			return false;
-		}
-		if ( isProductType() )
-		{
-			return false;
-		}
-		if ( m_metadata.category() == NODE_CATEGORY_ASSET && m_metadata.type() == NODE_TYPE_VALUE_TYPE )
+		if ( m_flags & internal::GmodNodeFlags::NOT_INDIVIDUALIZABLE )
 		{
 			return false;
 		}
-		if ( isFunctionComposition() )
-		{
-			if ( m_code.empty() )
-			{
-				SPDLOG_WARN( "isIndividualizable: Code is empty, cannot check last character for 'i'. Node: {}", m_code );
-				return false;
-			}
 
-			return m_code.back() == 'i' || isInSet || isTargetNode;
+		if ( m_flags & internal::GmodNodeFlags::FUNCTION_COMPOSITION )
+		{
+			return ( m_flags & internal::GmodNodeFlags::INDIVIDUALIZABLE_COMPOSITION ) || isInSet || isTargetNode;
 		}
 
 		return true;
@@ -503,121 +505,49 @@ namespace dnv::vista::sdk
 
 	bool GmodNode::isFunctionComposition() const
 	{
-		return ( m_metadata.category() == NODE_CATEGORY_ASSET_FUNCTION ||
-				   m_metadata.category() == NODE_CATEGORY_PRODUCT_FUNCTION ) &&
-			   m_metadata.type() == NODE_TYPE_COMPOSITION;
+		return m_flags & internal::GmodNodeFlags::FUNCTION_COMPOSITION;
 	}
 
 	bool GmodNode::isMappable() const noexcept
 	{
-		if ( !m_cachedProductType.has_value() )
-		{
-			if ( m_children.size() == 1 &&
-				 m_metadata.category().find( NODE_CATEGORY_VALUE_FUNCTION ) != std::string::npos )
-			{
-				const GmodNode* child = m_children[0];
-				if ( child &&
-					 child->m_metadata.category() == NODE_CATEGORY_PRODUCT &&
-					 child->m_metadata.type() == NODE_TYPE_VALUE_TYPE )
-				{
-					m_cachedProductType = child;
-				}
-				else
-				{
-					m_cachedProductType = nullptr;
-				}
-			}
-			else
-			{
-				m_cachedProductType = nullptr;
-			}
-		}
-
-		if ( m_cachedProductType.value() != nullptr )
-		{
-			return false;
-		}
-
-		if ( !m_cachedProductSelection.has_value() )
-		{
-			if ( m_children.size() == 1 &&
-				 m_metadata.category().find( NODE_CATEGORY_VALUE_FUNCTION ) != std::string::npos )
-			{
-				const GmodNode* child = m_children[0];
-				if ( child &&
-					 child->m_metadata.category().find( NODE_CATEGORY_PRODUCT ) != std::string::npos &&
-					 child->m_metadata.type() == NODE_TYPE_VALUE_SELECTION )
-				{
-					m_cachedProductSelection = child;
-				}
-				else
-				{
-					m_cachedProductSelection = nullptr;
-				}
-			}
-			else
-			{
-				m_cachedProductSelection = nullptr;
-			}
-		}
-
-		if ( m_cachedProductSelection.value() != nullptr )
-		{
-			return false;
-		}
-
-		if ( m_metadata.category().find( NODE_CATEGORY_PRODUCT ) != std::string::npos && m_metadata.type() == NODE_TYPE_VALUE_SELECTION )
-		{
-			return false;
-		}
-
-		if ( m_metadata.category() == NODE_CATEGORY_ASSET )
-		{
-			return false;
-		}
-
-		if ( m_code.empty() )
-		{
-			return false;
-		}
-
-		char lastChar = m_code.back();
-		return lastChar != 'a' && lastChar != 's';
+		return ( m_flags & internal::GmodNodeFlags::MAPPABLE_KIND ) &&
+			   m_links->productType == nullptr &&
+			   m_links->productSelection == nullptr;
 	}
 
 	bool GmodNode::isProductSelection() const
 	{
-		return Gmod::isProductSelection( m_metadata );
+		return m_flags & internal::GmodNodeFlags::PRODUCT_SELECTION;
 	}
 
 	bool GmodNode::isProductType() const
 	{
-		return Gmod::isProductType( m_metadata );
+		return m_flags & internal::GmodNodeFlags::PRODUCT_TYPE;
 	}
 
 	bool GmodNode::isAsset() const
 	{
-		return Gmod::isAsset( m_metadata );
+		return m_flags & internal::GmodNodeFlags::ASSET;
 	}
 
 	bool GmodNode::isLeafNode() const
 	{
-		return Gmod::isLeafNode( m_metadata );
+		return m_flags & internal::GmodNodeFlags::LEAF_NODE;
 	}
 
 	bool GmodNode::isFunctionNode() const
 	{
-		return Gmod::isFunctionNode( m_metadata );
+		return m_flags & internal::GmodNodeFlags::FUNCTION_NODE;
 	}
 
 	bool GmodNode::isAssetFunctionNode() const
 	{
-		return Gmod::isAssetFunctionNode( m_metadata );
+		return m_flags & internal::GmodNodeFlags::ASSET_FUNCTION_NODE;
 	}
 
 	bool GmodNode::isRoot() const noexcept
 	{
-		return m_code == "VE";
+		return m_flags & internal::GmodNodeFlags::ROOT;
 	}
 
 	//----------------------------------------------
@@ -626,16 +556,17 @@ namespace dnv::vista::sdk
 
 	bool GmodNode::isChild( const GmodNode& node ) const
 	{
-		return isChild( node.m_code );
+		return isChild( node.m_codeId );
 	}
 
 	bool GmodNode::isChild( const std::string& code ) const
 	{
-		if ( m_children.size() <= 8 )
+		/* A few string compares are cheaper than interning lookups */
+		if ( m_links->children.size() <= 8 )
 		{
-			for ( const auto* child : m_children )
+			for ( const auto* child : m_links->children )
 			{
-				if ( child->code() == code )
+				if ( child->m_code == code )
 				{
 					return true;
 				}
@@ -644,7 +575,32 @@ namespace dnv::vista::sdk
 			return false;
 		}
 
-		return m_childrenSet.contains( code );
+		/* A code that was never interned cannot belong to any node */
+		uint32_t codeId;
+		if ( !StringInterner::instance().tryGetId( code, codeId ) )
+		{
+			return false;
+		}
+
+		return isChild( codeId );
+	}
+
+	bool GmodNode::isChild( uint32_t codeId ) const
+	{
+		if ( m_links->graph != nullptr ) [[likely]]
+		{
+			return m_links->graph->isChild( m_links->graphIndex, codeId );
+		}
+
+		for ( const auto* child : m_links->children )
+		{
+			if ( child->m_codeId == codeId )
+			{
+				return true;
+			}
+		}
+
+		return false;
 	}
 
 	//----------------------------------------------
@@ -677,17 +633,15 @@ namespace dnv::vista::sdk
 			return;
 		}
 
-		const std::string& childCode = child->code();
-		if ( m_childrenSet.contains( childCode ) )
+		for ( const auto* existing : m_links->children )
 		{
-			return;
+			if ( existing->m_codeId == child->m_codeId )
+			{
+				return;
+			}
 		}
 
-		m_children.push_back( child );
-		m_childrenSet.emplace( childCode );
-
-		m_cachedProductType.reset();
-		m_cachedProductSelection.reset();
+		m_links->children.push_back( child );
 	}
 
 	void GmodNode::addParent( GmodNode* parent )
@@ -697,23 +651,186 @@ namespace dnv::vista::sdk
 			return;
 		}
 
-		m_parents.push_back( parent );
+		m_links->parents.push_back( parent );
 	}
 
 	void GmodNode::trim()
 	{
-		m_children.shrink_to_fit();
-		m_parents.shrink_to_fit();
+		m_links->children.shrink_to_fit();
+		m_links->parents.shrink_to_fit();
+	}
+
+	//=====================================================================
+	// GmodLocatedNode class
+	//=====================================================================
 
-		if ( m_childrenSet.size() != m_children.size() )
+	static_assert( sizeof( GmodLocatedNode ) <= 16 );
+
+	namespace
+	{
+		/** @brief Count byte of a `GmodLocatedNode` location stored by interned id. */
+		static constexpr char INTERNED_LOCATION = static_cast<char>( 0xFF );
+
+		/**
+		 * @brief Gets the table of long `GmodLocatedNode` locations.
+		 * @details Kept apart from `StringInterner::instance()`, so locations neither take code ids
+		 *          nor show up in code lookups.
+		 * @return The table.
+		 */
+		StringInterner& locationInterner()
 		{
-			m_childrenSet.clear();
-			m_childrenSet.reserve( m_children.size() );
+			static StringInterner interner;
 
-			for ( const auto* child : m_children )
-			{
-				m_childrenSet.emplace( child->code() );
-			}
+			return interner;
 		}
 	}
+
+	//----------------------------------------------
+	// Construction / destruction
+	//----------------------------------------------
+
+	GmodLocatedNode::GmodLocatedNode() noexcept
+		: m_node{ nullptr },
+		  m_location{}
+	{
+	}
+
+	GmodLocatedNode::GmodLocatedNode( const GmodNode& node, const std::optional<Location>& location )
+		: m_node{ &node },
+		  m_location{}
+	{
+		if ( !location.has_value() )
+		{
+			return;
+		}
+
+		const std::string& value = location->value();
+		if ( value.size() <= INLINE_LOCATION_CAPACITY )
+		{
+			std::memcpy( m_location.data(), value.data(), value.size() );
+			m_location.back() = static_cast<char>( value.size() );
+		}
+		else
+		{
+			const uint32_t id = locationInterner().intern( value );
+			std::memcpy( m_location.data(), &id, sizeof( id ) );
+			m_location.back() = INTERNED_LOCATION;
+		}
+	}
+
+	//----------------------------------------------
+	// Operators
+	//----------------------------------------------
+
+	bool GmodLocatedNode::operator==( const GmodLocatedNode& other ) const noexcept
+	{
+		/* Each location has a single representation, and unused bytes are zero */
+		return m_node->codeId() == other.m_node->codeId() && m_location == other.m_location;
+	}
+
+	bool GmodLocatedNode::operator!=( const GmodLocatedNode& other ) const noexcept
+	{
+		return !( *this == other );
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	const GmodNode& GmodLocatedNode::node() const noexcept
+	{
+		return *m_node;
+	}
+
+	const std::string& GmodLocatedNode::code() const noexcept
+	{
+		return m_node->code();
+	}
+
+	std::optional<Location> GmodLocatedNode::location() const
+	{
+		if ( !hasLocation() )
+		{
+			return std::nullopt;
+		}
+
+		return Location{ locationView() };
+	}
+
+	bool GmodLocatedNode::hasLocation() const noexcept
+	{
+		return m_location.back() != 0;
+	}
+
+	bool GmodLocatedNode::hasSameLocation( const GmodLocatedNode& other ) const noexcept
+	{
+		return m_location == other.m_location;
+	}
+
+	size_t GmodLocatedNode::hashCode() const noexcept
+	{
+		size_t hash = m_node->codeId();
+		if ( hasLocation() )
+		{
+			uint64_t location;
+			std::memcpy( &location, m_location.data(), sizeof( location ) );
+
+			hash ^= std::hash<uint64_t>{}( location ) + 0x9e3779b9 + ( hash << 6 ) + ( hash >> 2 );
+		}
+
+		return hash;
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	GmodLocatedNode GmodLocatedNode::withNode( const GmodNode& node ) const noexcept
+	{
+		GmodLocatedNode result{ *this };
+		result.m_node = &node;
+
+		return result;
+	}
+
+	GmodNode GmodLocatedNode::toNode() const
+	{
+		return hasLocation() ? m_node->withLocation( Location{ locationView() } ) : m_node->withoutLocation();
+	}
+
+	std::string GmodLocatedNode::toString() const
+	{
+		if ( !hasLocation() )
+		{
+			return m_node->code();
+		}
+
+		return fmt::format( "{}-{}", m_node->code(), locationView() );
+	}
+
+	void GmodLocatedNode::toString( std::stringstream& builder ) const
+	{
+		builder << m_node->code();
+		if ( hasLocation() )
+		{
+			builder << '-' << locationView();
+		}
+	}
+
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
+
+	std::string_view GmodLocatedNode::locationView() const
+	{
+		if ( m_location.back() == INTERNED_LOCATION )
+		{
+			uint32_t id;
+			std::memcpy( &id, m_location.data(), sizeof( id ) );
+
+			return locationInterner().string( id );
+		}
+
+		return std::string_view{ m_location.data(), static_cast<size_t>( m_location.back() ) };
+	}
 }
@@ -11,6 +11,7 @@
 #include "dnv/vista/sdk/GmodTraversal.h"
 #include "dnv/vista/sdk/Locations.h"
 #include "dnv/vista/sdk/VIS.h"
+#include "dnv/vista/sdk/WorkStealing.h"
 
 namespace dnv::vista::sdk
 {
@@ -20,38 +21,66 @@ namespace dnv::vista::sdk
 		// LocationSetsVisitor
 		//--------------------------------------------------------------------------
 
+		/**
+		 * @brief Individualizable set of a path found by `LocationSetsVisitor`.
+		 * @details `location` points at the node of the path whose location the set takes, or is
+		 *          `nullptr` if the set has no location; copy the node before modifying the path.
+		 */
+		struct LocationSet
+		{
+			size_t start;
+			size_t end;
+			const GmodLocatedNode* location;
+		};
+
+		/**
+		 * @brief Gets a node of a path if it has a location.
+		 * @param node The node.
+		 * @return `node`, or `nullptr` if it has no location.
+		 */
+		inline const GmodLocatedNode* locationOf( const GmodLocatedNode& node ) noexcept
+		{
+			return node.hasLocation() ? &node : nullptr;
+		}
+
 		struct LocationSetsVisitor
 		{
 			size_t currentParentStart;
 
 			LocationSetsVisitor() : currentParentStart( std::numeric_limits<size_t>().max() ) {}
 
-			std::optional<std::tuple<size_t, size_t, std::optional<Location>>> visit(
-				const GmodNode& node,
-				size_t i,
-				const std::vector<GmodNode*>& pathParents,
-				const GmodNode& pathTargetNode )
+			/**
+			 * @brief Visits the node at `i` of a path.
+			 * @param i The index of the node.
+			 * @param pathNodes The nodes of the path, from the root to the target node.
+			 * @return The set ending at the node, if any.
+			 */
+			std::optional<LocationSet> visit( size_t i, std::span<const GmodLocatedNode> pathNodes )
 			{
-				bool isParent = Gmod::isPotentialParent( node.metadata().type() );
-				bool isTargetNode = ( static_cast<size_t>( i ) == pathParents.size() );
+				const GmodLocatedNode& pathNode = pathNodes[i];
+				const GmodNode& node = pathNode.node();
+				const size_t targetIndex = pathNodes.size() - 1;
+
+				bool isParent = ( node.flags() & GmodNodeFlags::POTENTIAL_PARENT ) != 0;
+				bool isTargetNode = ( i == targetIndex );
 
 				if ( currentParentStart == std::numeric_limits<size_t>().max() )
 				{
 					if ( isParent )
 						currentParentStart = i;
 					if ( node.isIndividualizable( isTargetNode ) )
-						return std::make_tuple( i, i, node.location() );
+						return LocationSet{ i, i, locationOf( pathNode ) };
 				}
 				else
 				{
 					if ( isParent || isTargetNode )
 					{
-						std::optional<std::tuple<size_t, size_t, std::optional<Location>>> nodes = std::nullopt;
+						std::optional<LocationSet> nodes = std::nullopt;
 
 						if ( currentParentStart + 1 == i )
 						{
 							if ( node.isIndividualizable( isTargetNode ) )
-								nodes = std::make_tuple( i, i, node.location() );
+								nodes = LocationSet{ i, i, locationOf( pathNode ) };
 						}
 						else
 						{
@@ -60,19 +89,20 @@ namespace dnv::vista::sdk
 
 							for ( size_t j = currentParentStart + 1; j <= i; ++j )
 							{
-								const GmodNode* setNode = ( j < pathParents.size() ) ? pathParents[j] : &pathTargetNode;
+								const GmodNode* setNode = &pathNodes[j].node();
 
-								if ( !setNode->isIndividualizable( j == pathParents.size(), true ) )
+								if ( !setNode->isIndividualizable( j == targetIndex, true ) )
 								{
 									if ( nodes.has_value() )
 										skippedOne = j;
 									continue;
 								}
 
+								const GmodLocatedNode* setNodeLocation = locationOf( pathNodes[j] );
 								if ( nodes.has_value() &&
-									 std::get<2>( nodes.value() ).has_value() &&
-									 setNode->location().has_value() &&
-									 std::get<2>( nodes.value() ) != setNode->location() )
+									 nodes->location != nullptr &&
+									 setNodeLocation != nullptr &&
+									 !nodes->location->hasSameLocation( *setNodeLocation ) )
 								{
 									throw std::runtime_error( "Mapping error: different locations in the same nodeset" );
 								}
@@ -83,13 +113,13 @@ namespace dnv::vista::sdk
 								if ( setNode->isFunctionComposition() )
 									hasComposition = true;
 
-								auto location = nodes.has_value() && std::get<2>( nodes.value() ).has_value() ? std::get<2>( nodes.value() ) : setNode->location();
-								size_t start = nodes.has_value() ? std::get<0>( nodes.value() ) : j;
+								const GmodLocatedNode* location = nodes.has_value() && nodes->location != nullptr ? nodes->location : setNodeLocation;
+								size_t start = nodes.has_value() ? nodes->start : j;
 								size_t end = j;
-								nodes = std::make_tuple( start, end, location );
+								nodes = LocationSet{ start, end, location };
 							}
 
-							if ( nodes.has_value() && std::get<0>( nodes.value() ) == std::get<1>( nodes.value() ) && hasComposition )
+							if ( nodes.has_value() && nodes->start == nodes->end && hasComposition )
 								nodes = std::nullopt;
 						}
 
@@ -97,13 +127,12 @@ namespace dnv::vista::sdk
 						if ( nodes.has_value() )
 						{
 							bool hasLeafNode = false;
-							size_t startIdx = std::get<0>( nodes.value() );
-							size_t endIdx = std::get<1>( nodes.value() );
+							size_t startIdx = nodes->start;
+							size_t endIdx = nodes->end;
 
 							for ( size_t j = startIdx; j <= endIdx; ++j )
 							{
-								const GmodNode* setNode = ( j < pathParents.size() ) ? pathParents[j] : &pathTargetNode;
-								if ( setNode->isLeafNode() || j == pathParents.size() )
+								if ( pathNodes[j].node().isLeafNode() || j == targetIndex )
 								{
 									hasLeafNode = true;
 									break;
@@ -117,13 +146,54 @@ namespace dnv::vista::sdk
 					}
 
 					if ( isTargetNode && node.isIndividualizable( isTargetNode ) )
-						return std::make_tuple( i, i, node.location() );
+						return LocationSet{ i, i, locationOf( pathNode ) };
 				}
 
 				return std::nullopt;
 			}
 		};
 
+		//--------------------------------------------------------------------------
+		// Path nodes
+		//--------------------------------------------------------------------------
+
+		/**
+		 * @brief The nodes of a path as `GmodNode` pointers, for `GmodPath::parents()` and `GmodPath::node()`.
+		 * @details Created on first use and then only read. Nodes without location are the Gmod's
+		 *          own nodes, located ones are copies in `located`, which is reserved up front so
+		 *          that the pointers stay valid.
+		 */
+		struct PathNodes
+		{
+			std::vector<GmodNode*> parents;
+			GmodNode* node{ nullptr };
+			std::vector<GmodNode> located;
+		};
+
+		/**
+		 * @brief Gets the node of a Gmod that a path stores for a node.
+		 * @param gmod The Gmod of the path.
+		 * @param node The node, possibly located or from another Gmod of the same version.
+		 * @return The node of `gmod` with the code of `node`.
+		 * @throws std::invalid_argument If `gmod` has no node with the code of `node`.
+		 */
+		const GmodNode& gmodNode( const Gmod& gmod, const GmodNode& node )
+		{
+			const GmodGraph* graph = node.graph();
+			if ( graph != nullptr && graph == gmod.rootNode().graph() ) [[likely]]
+			{
+				return *graph->nodes[node.graphIndex()];
+			}
+
+			const GmodNode* base = nullptr;
+			if ( !gmod.tryGetNode( node.codeId(), base ) )
+			{
+				throw std::invalid_argument( fmt::format( "Invalid GMOD path - node '{}' is not part of the GMOD.", node.code() ) );
+			}
+
+			return *base;
+		}
+
 		//--------------------------------------------------------------------------
 		// Parsing
 		//--------------------------------------------------------------------------
@@ -132,19 +202,26 @@ namespace dnv::vista::sdk
 		{
 			std::string code;
 			std::optional<Location> location;
+			const GmodNode* node{ nullptr };
 		};
 
+		/**
+		 * @brief State of one short path parse.
+		 * @details The containers are borrowed from the `ParseScratch` of the parsing thread and are
+		 *          empty when the parse starts.
+		 */
 		struct ParseContext
 		{
-			std::deque<PathNode> partsQueue;
+			std::deque<PathNode>& partsQueue;
 			PathNode toFind;
-			std::optional<std::unordered_map<std::string, Location>> nodeLocations;
+			std::unordered_map<std::string, Location>& nodeLocations;
+			std::vector<GmodLocatedNode>& pathNodes;
 			std::optional<GmodPath> resultingPath;
 			const Gmod& gmod;
-			std::vector<GmodNode*> ownedNodesForCurrentPath;
 
-			ParseContext( std::deque<PathNode> initialParts, const Gmod& g, PathNode firstToFind )
-				: partsQueue( std::move( initialParts ) ), toFind( std::move( firstToFind ) ), gmod( g )
+			ParseContext( std::deque<PathNode>& parts, std::unordered_map<std::string, Location>& locations,
+				std::vector<GmodLocatedNode>& nodes, const Gmod& g, PathNode firstToFind )
+				: partsQueue( parts ), toFind( std::move( firstToFind ) ), nodeLocations( locations ), pathNodes( nodes ), gmod( g )
 			{
 			}
 
@@ -159,7 +236,7 @@ namespace dnv::vista::sdk
 			const std::vector<const GmodNode*>& traversedParents,
 			const GmodNode& currentNode )
 		{
-			bool foundCurrentToFind = ( currentNode.code() == context.toFind.code );
+			bool foundCurrentToFind = ( currentNode.codeId() == context.toFind.node->codeId() );
 
 			if ( !foundCurrentToFind && Gmod::isLeafNode( currentNode.metadata() ) )
 			{
@@ -173,137 +250,91 @@ namespace dnv::vista::sdk
 
 			if ( context.toFind.location.has_value() )
 			{
-				if ( !context.nodeLocations.has_value() )
-				{
-					context.nodeLocations.emplace();
-				}
-				context.nodeLocations->emplace( std::string( context.toFind.code ), context.toFind.location.value() );
+				context.nodeLocations.emplace( context.toFind.code, context.toFind.location.value() );
 			}
 
 			if ( !context.partsQueue.empty() )
 			{
-				context.toFind = context.partsQueue.front();
+				context.toFind = std::move( context.partsQueue.front() );
 				context.partsQueue.pop_front();
 
 				return TraversalHandlerResult::Continue;
 			}
 
-			std::vector<GmodNode*> pathParents;
-			pathParents.reserve( traversedParents.size() + 1 );
+			std::vector<GmodLocatedNode>& pathNodes = context.pathNodes;
+			pathNodes.clear();
+			pathNodes.reserve( traversedParents.size() + 2 );
 
 			for ( const GmodNode* parent : traversedParents )
 			{
 				if ( !parent )
 					continue;
 
-				if ( context.nodeLocations.has_value() )
+				if ( !context.nodeLocations.empty() )
 				{
-					auto it = context.nodeLocations->find( std::string( parent->code() ) );
-					if ( it != context.nodeLocations->end() )
+					auto it = context.nodeLocations.find( std::string( parent->code() ) );
+					if ( it != context.nodeLocations.end() )
 					{
-						GmodNode* newNode = new GmodNode( parent->withLocation( it->second ) );
-						context.ownedNodesForCurrentPath.push_back( newNode );
-						pathParents.push_back( newNode );
+						pathNodes.emplace_back( *parent, it->second );
 
 						continue;
 					}
 				}
-				pathParents.push_back( const_cast<GmodNode*>( parent ) );
-			}
-
-			GmodNode* endNode;
-			if ( context.toFind.location.has_value() )
-			{
-				GmodNode* newNode = new GmodNode( currentNode.withLocation( context.toFind.location.value() ) );
-				context.ownedNodesForCurrentPath.push_back( newNode );
-				endNode = newNode;
-			}
-			else
-			{
-				endNode = const_cast<GmodNode*>( &currentNode );
+				pathNodes.emplace_back( *parent, std::nullopt );
 			}
 
-			GmodNode* startNode = nullptr;
-			if ( !pathParents.empty() && !pathParents[0]->parents().empty() && pathParents[0]->parents().size() == 1 )
+			const GmodNode* startNode = nullptr;
+			if ( !pathNodes.empty() && pathNodes[0].node().parents().size() == 1 )
 			{
-				startNode = const_cast<GmodNode*>( pathParents[0]->parents()[0] );
+				startNode = pathNodes[0].node().parents()[0];
 			}
-			else if ( !endNode->parents().empty() && endNode->parents().size() == 1 )
+			else if ( currentNode.parents().size() == 1 )
 			{
-				startNode = const_cast<GmodNode*>( endNode->parents()[0] );
+				startNode = currentNode.parents()[0];
 			}
 
 			while ( startNode && startNode->parents().size() == 1 )
 			{
-				pathParents.insert( pathParents.begin(), startNode );
-				startNode = const_cast<GmodNode*>( startNode->parents()[0] );
+				pathNodes.insert( pathNodes.begin(), GmodLocatedNode{ *startNode, std::nullopt } );
+				startNode = startNode->parents()[0];
 			}
 
-			if ( pathParents.empty() || pathParents[0] != &context.gmod.rootNode() )
+			const GmodNode& rootNode = context.gmod.rootNode();
+			if ( pathNodes.empty() || &pathNodes[0].node() != &rootNode )
 			{
-				pathParents.insert( pathParents.begin(), const_cast<GmodNode*>( &context.gmod.rootNode() ) );
+				pathNodes.insert( pathNodes.begin(), GmodLocatedNode{ rootNode, std::nullopt } );
 			}
 
+			pathNodes.emplace_back( currentNode, context.toFind.location );
+
 			internal::LocationSetsVisitor locationSetsVisitor;
-			for ( size_t i = 0; i < pathParents.size() + 1; ++i )
+			for ( size_t i = 0; i < pathNodes.size(); ++i )
 			{
-				GmodNode* nodeInPath = ( i < pathParents.size() ) ? pathParents[i] : endNode;
-				if ( !nodeInPath )
-					continue;
-
-				std::optional<std::tuple<size_t, size_t, std::optional<Location>>> setDetails =
-					locationSetsVisitor.visit( *nodeInPath, i, pathParents, *endNode );
+				std::optional<LocationSet> setDetails = locationSetsVisitor.visit( i, pathNodes );
 
 				if ( setDetails.has_value() )
 				{
-					const auto& setTuple = setDetails.value();
-					size_t setStartIdx = std::get<0>( setTuple );
-					size_t setEndIdx = std::get<1>( setTuple );
-					const std::optional<Location>& setCommonLocation = std::get<2>( setTuple );
+					size_t setStartIdx = setDetails->start;
+					size_t setEndIdx = setDetails->end;
 
-					if ( setStartIdx == setEndIdx )
+					if ( setStartIdx == setEndIdx || setDetails->location == nullptr )
 						continue;
 
-					if ( setCommonLocation.has_value() )
+					/* The set location points into the path, which is updated below */
+					const GmodLocatedNode setLocation = *setDetails->location;
+					for ( size_t k = setStartIdx; k <= setEndIdx; ++k )
 					{
-						for ( size_t k = setStartIdx; k <= setEndIdx; ++k )
+						if ( !pathNodes[k].hasSameLocation( setLocation ) )
 						{
-							GmodNode** nodesToUpdateInPath;
-							if ( k < pathParents.size() )
-							{
-								nodesToUpdateInPath = &pathParents[k];
-							}
-							else
-							{
-								nodesToUpdateInPath = &endNode;
-							}
-							GmodNode* currentNodeInSet = *nodesToUpdateInPath;
-
-							bool needsNewNode = true;
-							if ( currentNodeInSet->location().has_value() && setCommonLocation.has_value() &&
-								 currentNodeInSet->location().value() == setCommonLocation.value() )
-							{
-								needsNewNode = false;
-							}
-							else if ( !currentNodeInSet->location().has_value() && !setCommonLocation.has_value() )
-							{
-								needsNewNode = false;
-							}
-
-							if ( needsNewNode )
-							{
-								GmodNode* newNodeWithSetLocation = new GmodNode( currentNodeInSet->tryWithLocation( setCommonLocation ) );
-								context.ownedNodesForCurrentPath.push_back( newNodeWithSetLocation );
-								*nodesToUpdateInPath = newNodeWithSetLocation;
-							}
+							pathNodes[k] = setLocation.withNode( pathNodes[k].node() );
 						}
 					}
 				}
 				else
 				{
-					if ( nodeInPath->location().has_value() )
+					if ( pathNodes[i].hasLocation() )
 					{
-						SPDLOG_ERROR( "parseInternalTraversalHandler: Node '{}' has a location but was not processed by set logic. Path invalid.", nodeInPath->code().data() );
+						SPDLOG_ERROR( "parseInternalTraversalHandler: Node '{}' has a location but was not processed by set logic. Path invalid.", pathNodes[i].code() );
 						return TraversalHandlerResult::Stop;
 					}
 				}
@@ -311,181 +342,244 @@ namespace dnv::vista::sdk
 
 			GmodPath pathObject;
 			pathObject.m_gmod = &context.gmod;
-			pathObject.m_parents = pathParents;
-			pathObject.m_node = endNode;
-			pathObject.m_visVersion = endNode->visVersion();
-			pathObject.m_ownedNodes = std::move( context.ownedNodesForCurrentPath );
-			context.ownedNodesForCurrentPath.clear();
+			pathObject.m_visVersion = currentNode.visVersion();
+			pathObject.setNodes( pathNodes );
 
 			context.resultingPath.emplace( std::move( pathObject ) );
 			return TraversalHandlerResult::Stop;
 		}
-	}
-
-	//=====================================================================
-	// GmodPath class
-	//=====================================================================
 
-	//----------------------------------------------
-	// Construction / destruction
-	//----------------------------------------------
+		//--------------------------------------------------------------------------
+		// Short path resolution
+		//--------------------------------------------------------------------------
 
-	GmodPath::GmodPath( const Gmod& gmod, GmodNode* node, std::vector<GmodNode*> parents )
-		: m_gmod{ &gmod },
-		  m_node{ node },
-		  m_parents{ std::move( parents ) }
-	{
-		if ( !m_node )
+		/**
+		 * @brief Parent stack of a short path resolution.
+		 * @details Resolution only descends towards the part being searched, so the stack stays
+		 *          shallow and occurrences are counted by scanning it.
+		 */
+		struct ResolveStack
 		{
-			throw std::invalid_argument( "GmodPath constructor: node cannot be null." );
-		}
-
-		m_visVersion = m_node->visVersion();
+			std::vector<const GmodNode*> nodes;
+			std::vector<uint32_t> indices;
 
-		if ( m_parents.empty() )
-		{
-			if ( m_node != &m_gmod->rootNode() )
+			size_t occurrences( uint32_t index ) const noexcept
 			{
-				std::string nodeCode = std::string( m_node->code() );
-				std::string rootCode = std::string( m_gmod->rootNode().code() );
-				throw std::invalid_argument( fmt::format( "Invalid GMOD path - no parents, and node '{}' is not the GMOD root '{}'.", nodeCode, rootCode ) );
+				return static_cast<size_t>( std::count( indices.begin(), indices.end(), index ) );
 			}
-		}
-		else
-		{
-			if ( m_parents.front() == nullptr )
+		};
+
+		/**
+		 * @brief Depth-first search for the parts of a short path, pruned by the reachability labels.
+		 * @details Visits nodes in the same order as `GmodTraversal::traverse()` with
+		 *          `parseInternalTraversalHandler`, but skips children from which the part being
+		 *          searched is certainly unreachable. The skipped subtrees cannot contain that part, and
+		 *          the handler does not change state for any other node, so the first match and
+		 *          therefore the resulting path are the same as with the full traversal.
+		 * @param context The parse state; `toFind` must refer to a node of `graph`.
+		 * @param graph The graph of the Gmod being parsed against.
+		 * @param stack The parents of the current node.
+		 * @param index The graph index of the current node.
+		 * @return The traversal result of the subtree.
+		 */
+		TraversalHandlerResult resolveParts( ParseContext& context, const GmodGraph& graph, ResolveStack& stack, uint32_t index )
+		{
+			if ( graph.flags[index] & GmodNodeFlags::SKIP_SUBSTRUCTURE )
 			{
-				throw std::invalid_argument( "Invalid GMOD path: first parent is null." );
+				return TraversalHandlerResult::Continue;
 			}
 
-			if ( m_parents.front() != &m_gmod->rootNode() )
+			const GmodNode& node = *graph.nodes[index];
+			TraversalHandlerResult result = parseInternalTraversalHandler( context, stack.nodes, node );
+			if ( result == TraversalHandlerResult::Stop || result == TraversalHandlerResult::SkipSubtree )
 			{
-				std::string firstParentCode = std::string( m_parents.front()->code() );
-				std::string rootCode = std::string( m_gmod->rootNode().code() );
-				throw std::invalid_argument( fmt::format( "Invalid GMOD path - first parent '{}' should be GMOD root '{}'.", firstParentCode, rootCode ) );
+				return result;
 			}
 
-			for ( size_t i = 0; i < m_parents.size(); ++i )
+			bool skipOccurrenceCheck = !stack.indices.empty() && graph.isProductSelectionAssignment( stack.indices.back(), index );
+			if ( !skipOccurrenceCheck )
 			{
-				GmodNode* currentParentNode = m_parents[i];
-				GmodNode* childNodeToCheck = ( i + 1 < m_parents.size() ) ? m_parents[i + 1] : m_node;
+				size_t occ = stack.occurrences( index );
 
-				if ( !currentParentNode )
-				{
-					throw std::invalid_argument( fmt::format( "Invalid GMOD path: null parent encountered in parents list at index {}.", i ) );
-				}
-				if ( !childNodeToCheck )
+				if ( occ == TraversalOptions::DEFAULT_MAX_TRAVERSAL_OCCURRENCE )
 				{
-					throw std::invalid_argument( fmt::format( "Invalid GMOD path: child node (or final node) is null for parent at index {}.", i ) );
+					return TraversalHandlerResult::SkipSubtree;
 				}
 
-				if ( !currentParentNode->isChild( *childNodeToCheck ) )
+				if ( occ > TraversalOptions::DEFAULT_MAX_TRAVERSAL_OCCURRENCE )
 				{
-					std::string childCode = std::string( childNodeToCheck->code() );
-					std::string parentCode = std::string( currentParentNode->code() );
-					throw std::invalid_argument( fmt::format( "Invalid GMOD path - node '{}' not child of '{}'.", childCode, parentCode ) );
+					throw std::runtime_error( "Invalid state - node occurred more than expected" );
 				}
 			}
-		}
 
-		try
-		{
-			internal::LocationSetsVisitor visitor;
-			for ( size_t i = 0; i < m_parents.size() + 1; ++i )
+			stack.nodes.push_back( &node );
+			stack.indices.push_back( index );
+
+			for ( const uint32_t child : graph.childrenOf( index ) )
 			{
-				GmodNode* nodeToVisit = ( i < m_parents.size() ) ? m_parents[i] : m_node;
-				if ( !nodeToVisit )
+				/* The part being searched changes as parts are found, so check it per child */
+				if ( !graph.mayReach( child, context.toFind.node->graphIndex() ) )
+				{
+					continue;
+				}
+
+				if ( resolveParts( context, graph, stack, child ) == TraversalHandlerResult::Stop )
 				{
-					throw std::runtime_error( fmt::format( "Null node encountered at index {} during LocationSetsVisitor phase.", i ) );
+					stack.nodes.pop_back();
+					stack.indices.pop_back();
+
+					return TraversalHandlerResult::Stop;
 				}
-				visitor.visit( *nodeToVisit, i, m_parents, *m_node );
 			}
+
+			stack.nodes.pop_back();
+			stack.indices.pop_back();
+
+			return TraversalHandlerResult::Continue;
 		}
-		catch ( [[maybe_unused]] const std::exception& ex )
+
+		/**
+		 * @brief Buffers of short path parsing, kept per thread so repeated parses reuse their capacity.
+		 * @details `GmodPath::parseInternal()` clears them before use; nothing it calls parses
+		 *          another path, so one set per thread is enough.
+		 */
+		struct ParseScratch
 		{
-			if ( m_node )
-			{
-				SPDLOG_ERROR( "GmodPath construction for node '{}' failed during LocationSetsVisitor validation: {}", m_node->code(), ex.what() );
-			}
+			std::deque<PathNode> parts;
+			std::unordered_map<std::string, Location> nodeLocations;
+			std::vector<GmodLocatedNode> pathNodes;
+			ResolveStack stack;
+		};
 
-			throw;
+		/**
+		 * @brief Gets the parse buffers of the calling thread.
+		 * @return The buffers, emptied.
+		 */
+		ParseScratch& threadParseScratch()
+		{
+			thread_local ParseScratch s_scratch;
+
+			s_scratch.parts.clear();
+			s_scratch.nodeLocations.clear();
+			s_scratch.pathNodes.clear();
+			s_scratch.stack.nodes.clear();
+			s_scratch.stack.indices.clear();
+
+			return s_scratch;
 		}
-	}
 
-	GmodPath::GmodPath()
-		: m_visVersion{ VisVersion::Unknown },
-		  m_gmod{ nullptr },
-		  m_node{ nullptr }
-	{
+		//--------------------------------------------------------------------------
+		// Bulk parsing
+		//--------------------------------------------------------------------------
+
+		/** @brief Number of items a worker of `GmodPath::tryParseMany()` parses per claimed chunk. */
+		constexpr size_t PARSE_CHUNK_SIZE{ 64 };
 	}
 
-	GmodPath::GmodPath( const GmodPath& other )
-		: m_visVersion{ other.m_visVersion },
-		  m_gmod{ other.m_gmod },
-		  m_node{ nullptr },
-		  m_parents{}
+	//=====================================================================
+	// GmodPath class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction / destruction
+	//----------------------------------------------
+
+	GmodPath::GmodPath( const Gmod& gmod, GmodNode* node, const std::vector<GmodNode*>& parents )
+		: m_visVersion{ VisVersion::Unknown },
+		  m_gmod{ &gmod },
+		  m_length{ 0 },
+		  m_inlineNodes{},
+		  m_pathNodes{ nullptr }
 	{
-		m_ownedNodes.reserve( other.m_ownedNodes.size() );
-		std::unordered_map<const GmodNode*, GmodNode*> nodeMapping;
+		if ( !node )
+		{
+			throw std::invalid_argument( "GmodPath constructor: node cannot be null." );
+		}
 
-		for ( GmodNode* ownedNodeToCopy : other.m_ownedNodes )
+		for ( size_t i = 0; i < parents.size(); ++i )
 		{
-			if ( ownedNodeToCopy )
+			if ( !parents[i] )
 			{
-				GmodNode* newCopy = new GmodNode( *ownedNodeToCopy );
-				m_ownedNodes.push_back( newCopy );
-				nodeMapping[ownedNodeToCopy] = newCopy;
-			}
-			else
-			{
-				m_ownedNodes.push_back( nullptr );
+				if ( i == 0 )
+				{
+					throw std::invalid_argument( "Invalid GMOD path: first parent is null." );
+				}
+
+				throw std::invalid_argument( fmt::format( "Invalid GMOD path: null parent encountered in parents list at index {}.", i ) );
 			}
 		}
 
-		m_parents.reserve( other.m_parents.size() );
-		for ( GmodNode* originalParent : other.m_parents )
+		GmodLocatedNode* nodes = resizeNodes( parents.size() + 1 );
+		for ( size_t i = 0; i < parents.size(); ++i )
 		{
-			auto it = nodeMapping.find( originalParent );
-			if ( it != nodeMapping.end() )
-			{
-				m_parents.push_back( it->second );
-			}
-			else
-			{
-				m_parents.push_back( originalParent );
-			}
+			nodes[i] = GmodLocatedNode{ internal::gmodNode( gmod, *parents[i] ), parents[i]->location() };
 		}
 
-		auto nodeIt = nodeMapping.find( other.m_node );
-		if ( nodeIt != nodeMapping.end() )
+		const GmodNode& targetNode = internal::gmodNode( gmod, *node );
+		nodes[parents.size()] = GmodLocatedNode{ targetNode, node->location() };
+		m_visVersion = targetNode.visVersion();
+
+		validate();
+	}
+
+	GmodPath::GmodPath( const Gmod& gmod, std::span<const GmodLocatedNode> nodes )
+		: m_visVersion{ VisVersion::Unknown },
+		  m_gmod{ &gmod },
+		  m_length{ 0 },
+		  m_inlineNodes{},
+		  m_pathNodes{ nullptr }
+	{
+		if ( nodes.empty() )
 		{
-			m_node = nodeIt->second;
+			throw std::invalid_argument( "GmodPath constructor: nodes cannot be empty." );
 		}
-		else
+
+		GmodLocatedNode* pathNodes = resizeNodes( nodes.size() );
+		for ( size_t i = 0; i < nodes.size(); ++i )
 		{
-			m_node = other.m_node;
+			pathNodes[i] = nodes[i].withNode( internal::gmodNode( gmod, nodes[i].node() ) );
 		}
+
+		m_visVersion = pathNodes[0].node().visVersion();
+
+		validate();
+	}
+
+	GmodPath::GmodPath()
+		: m_visVersion{ VisVersion::Unknown },
+		  m_gmod{ nullptr },
+		  m_length{ 0 },
+		  m_inlineNodes{},
+		  m_pathNodes{ nullptr }
+	{
+	}
+
+	GmodPath::GmodPath( const GmodPath& other )
+		: m_visVersion{ other.m_visVersion },
+		  m_gmod{ other.m_gmod },
+		  m_length{ other.m_length },
+		  m_inlineNodes{ other.m_inlineNodes },
+		  m_heapNodes{ other.m_heapNodes },
+		  m_pathNodes{ nullptr }
+	{
 	}
 
 	GmodPath::GmodPath( GmodPath&& other ) noexcept
 		: m_visVersion{ other.m_visVersion },
 		  m_gmod{ other.m_gmod },
-		  m_node{ other.m_node },
-		  m_parents{ std::move( other.m_parents ) },
-		  m_ownedNodes{ std::move( other.m_ownedNodes ) }
+		  m_length{ other.m_length },
+		  m_inlineNodes{ other.m_inlineNodes },
+		  m_heapNodes{ std::move( other.m_heapNodes ) },
+		  m_pathNodes{ other.m_pathNodes.exchange( nullptr ) }
 	{
-		other.m_node = nullptr;
 		other.m_gmod = nullptr;
-		other.m_visVersion = VisVersion::Unknown;
+		other.m_length = 0;
+		other.m_heapNodes.clear();
 	}
 
 	GmodPath::~GmodPath()
 	{
-		for ( GmodNode* ownedNode : m_ownedNodes )
-		{
-			delete ownedNode;
-		}
-		m_ownedNodes.clear();
+		resetPathNodes();
 	}
 
 	//----------------------------------------------
@@ -499,29 +593,12 @@ namespace dnv::vista::sdk
 			return *this;
 		}
 
-		for ( GmodNode* ownedNode : m_ownedNodes )
-		{
-			delete ownedNode;
-		}
-		m_ownedNodes.clear();
-
+		resetPathNodes();
 		m_visVersion = other.m_visVersion;
 		m_gmod = other.m_gmod;
-		m_parents = other.m_parents;
-		m_node = other.m_node;
-
-		m_ownedNodes.reserve( other.m_ownedNodes.size() );
-		for ( GmodNode* ownedNodeToCopy : other.m_ownedNodes )
-		{
-			if ( ownedNodeToCopy )
-			{
-				m_ownedNodes.push_back( new GmodNode( *ownedNodeToCopy ) );
-			}
-			else
-			{
-				m_ownedNodes.push_back( nullptr );
-			}
-		}
+		m_length = other.m_length;
+		m_inlineNodes = other.m_inlineNodes;
+		m_heapNodes = other.m_heapNodes;
 
 		return *this;
 	}
@@ -533,21 +610,17 @@ namespace dnv::vista::sdk
 			return *this;
 		}
 
-		for ( GmodNode* ownedNode : m_ownedNodes )
-		{
-			delete ownedNode;
-		}
-		m_ownedNodes.clear();
-
+		resetPathNodes();
 		m_visVersion = other.m_visVersion;
 		m_gmod = other.m_gmod;
-		m_parents = std::move( other.m_parents );
-		m_node = other.m_node;
-		m_ownedNodes = std::move( other.m_ownedNodes );
+		m_length = other.m_length;
+		m_inlineNodes = other.m_inlineNodes;
+		m_heapNodes = std::move( other.m_heapNodes );
+		m_pathNodes.store( other.m_pathNodes.exchange( nullptr ) );
 
-		other.m_node = nullptr;
 		other.m_gmod = nullptr;
-		other.m_visVersion = VisVersion::Unknown;
+		other.m_length = 0;
+		other.m_heapNodes.clear();
 
 		return *this;
 	}
@@ -563,87 +636,16 @@ namespace dnv::vista::sdk
 			return true;
 		}
 
-		if ( m_parents.size() != other.m_parents.size() )
-		{
-			return false;
-		}
-
-		if ( m_visVersion != other.m_visVersion )
+		if ( m_length != other.m_length || m_visVersion != other.m_visVersion )
 		{
 			return false;
 		}
 
-		/* Compare parents */
-		for ( size_t i = 0; i < m_parents.size(); ++i )
+		const GmodLocatedNode* thisNodes = nodesData();
+		const GmodLocatedNode* otherNodes = other.nodesData();
+		for ( size_t i = 0; i < m_length; ++i )
 		{
-			{ /* Null pointers */
-				if ( ( !m_parents[i] && other.m_parents[i] ) || ( m_parents[i] && !other.m_parents[i] ) )
-				{
-					return false;
-				}
-
-				if ( !m_parents[i] && !other.m_parents[i] )
-				{
-					continue;
-				}
-			}
-
-			{ /* Compare codes */
-				if ( m_parents[i]->code() != other.m_parents[i]->code() )
-				{
-					return false;
-				}
-			}
-
-			{ /* Compare locations */
-				bool thisHasLocation = m_parents[i]->location().has_value();
-				bool otherHasLocation = other.m_parents[i]->location().has_value();
-
-				if ( thisHasLocation != otherHasLocation )
-				{
-					return false;
-				}
-
-				if ( thisHasLocation && otherHasLocation &&
-					 m_parents[i]->location().value() != other.m_parents[i]->location().value() )
-				{
-					return false;
-				}
-			}
-		}
-
-		{ /* Null target nodes */
-			if ( ( !m_node && other.m_node ) || ( m_node && !other.m_node ) )
-			{
-				return false;
-			}
-
-			if ( !m_node && !other.m_node )
-			{
-				return true;
-			}
-		}
-
-		{ /* Target node code */
-
-			if ( m_node->code() != other.m_node->code() )
-			{
-				return false;
-			}
-		}
-
-		{ /* Target node location */
-
-			bool thisHasLocation = m_node->location().has_value();
-			bool otherHasLocation = other.m_node->location().has_value();
-
-			if ( thisHasLocation != otherHasLocation )
-			{
-				return false;
-			}
-
-			if ( thisHasLocation && otherHasLocation &&
-				 m_node->location().value() != other.m_node->location().value() )
+			if ( thisNodes[i] != otherNodes[i] )
 			{
 				return false;
 			}
@@ -663,37 +665,26 @@ namespace dnv::vista::sdk
 
 	GmodNode* GmodPath::operator[]( size_t index ) const
 	{
-		if ( index >= ( m_parents.size() + 1 ) )
+		if ( index >= length() )
 		{
-			throw std::out_of_range( fmt::format( "Index {} out of range for GmodPath indexer. Path length is {}.", index, m_parents.size() + 1 ) );
+			throw std::out_of_range( fmt::format( "Index {} out of range for GmodPath indexer. Path length is {}.", index, length() ) );
 		}
 
-		if ( index < m_parents.size() )
-		{
-			GmodNode* parentNode = m_parents[index];
-			return parentNode;
-		}
-		else
+		if ( m_length == 0 )
 		{
-			return m_node;
+			return nullptr;
 		}
-	}
 
-	GmodNode*& GmodPath::operator[]( size_t index )
-	{
-		if ( index >= ( m_parents.size() + 1 ) )
+		/* Nodes are owned by the Gmod or the path; they are handed out mutable only for API compatibility */
+		const GmodLocatedNode& pathNode = nodesData()[index];
+		if ( !pathNode.hasLocation() )
 		{
-			throw std::out_of_range( fmt::format( "Index {} out of range for GmodPath indexer. Path length is {}.", index, m_parents.size() + 1 ) );
+			return const_cast<GmodNode*>( &pathNode.node() );
 		}
 
-		if ( index < m_parents.size() )
-		{
-			return m_parents[index];
-		}
-		else
-		{
-			return m_node;
-		}
+		const internal::PathNodes& nodes = pathNodes();
+
+		return index + 1 < m_length ? nodes.parents[index] : nodes.node;
 	}
 
 	//----------------------------------------------
@@ -709,19 +700,11 @@ namespace dnv::vista::sdk
 	{
 		size_t hashCode = 0;
 
-		for ( size_t i = 0; i < m_parents.size(); ++i )
+		/* Code ids are shared by every VIS version, so equal paths of different Gmod instances hash equally */
+		const GmodLocatedNode* nodes = nodesData();
+		for ( size_t i = 0; i < m_length; ++i )
 		{
-			if ( m_parents[i] )
-			{
-				size_t nodeHash = m_parents[i]->hashCode();
-				hashCode ^= nodeHash + 0x9e3779b9 + ( hashCode << 6 ) + ( hashCode >> 2 );
-			}
-		}
-
-		if ( m_node )
-		{
-			size_t nodeHash = m_node->hashCode();
-			hashCode ^= nodeHash + 0x9e3779b9 + ( hashCode << 6 ) + ( hashCode >> 2 );
+			hashCode ^= nodes[i].hashCode() + 0x9e3779b9 + ( hashCode << 6 ) + ( hashCode >> 2 );
 		}
 
 		return hashCode;
@@ -732,19 +715,25 @@ namespace dnv::vista::sdk
 		return m_gmod;
 	}
 
-	GmodNode* GmodPath::node() const noexcept
+	GmodNode* GmodPath::node() const
 	{
-		return m_node;
+		return m_length == 0 ? nullptr : ( *this )[m_length - 1];
 	}
 
-	const std::vector<GmodNode*>& GmodPath::parents() const noexcept
+	const std::vector<GmodNode*>& GmodPath::parents() const
 	{
-		return m_parents;
+		return pathNodes().parents;
+	}
+
+	std::span<const GmodLocatedNode> GmodPath::locatedNodes() const noexcept
+	{
+		return std::span<const GmodLocatedNode>( nodesData(), m_length );
 	}
 
 	size_t GmodPath::length() const noexcept
 	{
-		return m_parents.size() + 1;
+		/* An empty path has a single, null node */
+		return m_length != 0 ? m_length : 1;
 	}
 
 	std::vector<GmodIndividualizableSet> GmodPath::individualizableSets() const
@@ -752,17 +741,15 @@ namespace dnv::vista::sdk
 		std::vector<GmodIndividualizableSet> result;
 		internal::LocationSetsVisitor visitor;
 
-		for ( size_t i = 0; i < length(); ++i )
+		const std::span<const GmodLocatedNode> nodes = locatedNodes();
+		for ( size_t i = 0; i < nodes.size(); ++i )
 		{
-			GmodNode* node = ( *this )[i];
-			if ( !node )
-				continue;
-
-			auto set = visitor.visit( *node, i, m_parents, *m_node );
+			auto set = visitor.visit( i, nodes );
 			if ( !set.has_value() )
 				continue;
 
-			const auto& [startIdx, endIdx, location] = set.value();
+			const size_t startIdx = set->start;
+			const size_t endIdx = set->end;
 			int start = static_cast<int>( startIdx );
 			int end = static_cast<int>( endIdx );
 
@@ -773,14 +760,14 @@ namespace dnv::vista::sdk
 				continue;
 			}
 
-			std::vector<int> nodes;
-			nodes.reserve( static_cast<size_t>( end - start + 1 ) );
+			std::vector<int> setNodes;
+			setNodes.reserve( static_cast<size_t>( end - start + 1 ) );
 			for ( int j = start; j <= end; ++j )
 			{
-				nodes.push_back( j );
+				setNodes.push_back( j );
 			}
 
-			result.emplace_back( std::move( nodes ), *this );
+			result.emplace_back( std::move( setNodes ), *this );
 		}
 
 		return result;
@@ -788,43 +775,24 @@ namespace dnv::vista::sdk
 
 	std::optional<std::string> GmodPath::normalAssignmentName( size_t nodeDepth ) const
 	{
-		if ( nodeDepth >= length() )
-		{
-			return std::nullopt;
-		}
-
-		GmodNode* nodeInPath = ( *this )[nodeDepth];
-		if ( !nodeInPath )
+		if ( nodeDepth >= m_length )
 		{
 			return std::nullopt;
 		}
 
-		const auto& normalAssignmentNames = nodeInPath->metadata().normalAssignmentNames();
+		const GmodLocatedNode* nodes = nodesData();
+		const auto& normalAssignmentNames = nodes[nodeDepth].node().metadata().normalAssignmentNames();
 		if ( normalAssignmentNames.empty() )
 		{
 			return std::nullopt;
 		}
 
-		if ( length() == 0 )
+		for ( size_t i = m_length; i > 0; --i )
 		{
-			return std::nullopt;
-		}
-
-		for ( size_t i = length() - 1;; --i )
-		{
-			GmodNode* child = ( *this )[i];
-			if ( child )
+			auto it = normalAssignmentNames.find( nodes[i - 1].code() );
+			if ( it != normalAssignmentNames.end() )
 			{
-				auto it = normalAssignmentNames.find( child->code().data() );
-				if ( it != normalAssignmentNames.end() )
-				{
-					return it->second;
-				}
-			}
-
-			if ( i == 0 )
-			{
-				break;
+				return it->second;
 			}
 		}
 
@@ -835,65 +803,46 @@ namespace dnv::vista::sdk
 	{
 		std::vector<std::pair<size_t, std::string>> result;
 
-		auto enumerator = this->enumerator();
-		while ( enumerator.next() )
+		const GmodLocatedNode* nodes = nodesData();
+		for ( size_t depth = 0; depth < m_length; ++depth )
 		{
-			const auto& [depth, node] = enumerator.current();
-
-			if ( !node )
-			{
-				continue;
-			}
-
-			bool isTarget = ( depth == m_parents.size() );
+			const GmodNode& node = nodes[depth].node();
+			bool isTarget = ( depth + 1 == m_length );
 
-			if ( !( node->isLeafNode() || isTarget ) || !node->isFunctionNode() )
+			if ( !( node.isLeafNode() || isTarget ) || !node.isFunctionNode() )
 			{
 				continue;
 			}
 
 			std::string name;
-			const auto& commonName = node->metadata().commonName();
+			const auto& commonName = node.metadata().commonName();
 			if ( commonName.has_value() && !commonName->empty() )
 			{
 				name = *commonName;
 			}
 			else
 			{
-				name = node->metadata().name();
+				name = node.metadata().name();
 			}
 
-			const auto& normalAssignmentNames = node->metadata().normalAssignmentNames();
+			const auto& normalAssignmentNames = node.metadata().normalAssignmentNames();
 
 			if ( !normalAssignmentNames.empty() )
 			{
-				if ( m_node )
+				auto nodeCodeIt = normalAssignmentNames.find( nodes[m_length - 1].code() );
+				if ( nodeCodeIt != normalAssignmentNames.end() )
 				{
-					auto nodeCodeIt = normalAssignmentNames.find( std::string( m_node->code() ) );
-					if ( nodeCodeIt != normalAssignmentNames.end() )
-					{
-						name = nodeCodeIt->second;
-					}
+					name = nodeCodeIt->second;
 				}
 
-				if ( !m_parents.empty() && depth < m_parents.size() )
+				/* Parents from the one nearest the target node up to `depth` */
+				for ( size_t i = m_length - 1; i > depth; --i )
 				{
-					for ( size_t i = m_parents.size() - 1; i >= depth; --i )
+					auto parentCodeIt = normalAssignmentNames.find( nodes[i - 1].code() );
+					if ( parentCodeIt != normalAssignmentNames.end() )
 					{
-						if ( m_parents[i] )
-						{
-							auto parentCodeIt = normalAssignmentNames.find( std::string( m_parents[i]->code() ) );
-							if ( parentCodeIt != normalAssignmentNames.end() )
-							{
-								name = parentCodeIt->second;
-								break;
-							}
-						}
-
-						if ( i == depth )
-						{
-							break;
-						}
+						name = parentCodeIt->second;
+						break;
 					}
 				}
 			}
@@ -939,14 +888,33 @@ namespace dnv::vista::sdk
 		return true;
 	}
 
+	bool GmodPath::isValid( std::span<const GmodLocatedNode> nodes, int& missingLinkAt )
+	{
+		missingLinkAt = -1;
+
+		if ( nodes.size() < 2 || !nodes[0].node().isRoot() )
+			return false;
+
+		for ( size_t i = 0; i + 1 < nodes.size(); ++i )
+		{
+			if ( !nodes[i].node().isChild( nodes[i + 1].node() ) )
+			{
+				missingLinkAt = static_cast<int>( i );
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	bool GmodPath::isMappable() const
 	{
-		if ( !m_node )
+		if ( m_length == 0 )
 		{
 			return false;
 		}
 
-		return m_node->isMappable();
+		return nodesData()[m_length - 1].node().isMappable();
 	}
 
 	std::string GmodPath::toString() const
@@ -977,79 +945,70 @@ namespace dnv::vista::sdk
 
 	GmodPath GmodPath::withoutLocations() const
 	{
-		if ( !m_gmod || !m_node )
+		if ( !m_gmod || m_length == 0 )
 		{
 			return GmodPath{};
 		}
 
-		std::vector<GmodNode*> newParents;
-		newParents.reserve( m_parents.size() );
+		GmodPath result;
+		result.m_visVersion = m_visVersion;
+		result.m_gmod = m_gmod;
 
-		for ( GmodNode* parent : m_parents )
+		const GmodLocatedNode* nodes = nodesData();
+		GmodLocatedNode* resultNodes = result.resizeNodes( m_length );
+		for ( size_t i = 0; i < m_length; ++i )
 		{
-			if ( parent )
-			{
-				const GmodNode* baseNode = nullptr;
-				if ( m_gmod->tryGetNode( parent->code(), baseNode ) && baseNode )
-				{
-					newParents.push_back( const_cast<GmodNode*>( baseNode ) );
-				}
-			}
+			resultNodes[i] = GmodLocatedNode{ nodes[i].node(), std::nullopt };
 		}
 
-		const GmodNode* baseFinalNode = nullptr;
-		if ( m_gmod->tryGetNode( m_node->code(), baseFinalNode ) && baseFinalNode )
-		{
-			return GmodPath( *m_gmod, const_cast<GmodNode*>( baseFinalNode ), std::move( newParents ) );
-		}
-
-		return GmodPath{};
+		return result;
 	}
 
 	void GmodPath::toString( std::stringstream& builder, char separator ) const
 	{
-		for ( const auto& parent : m_parents )
+		if ( m_length == 0 )
 		{
-			if ( !Gmod::isLeafNode( parent->metadata() ) )
+			return;
+		}
+
+		const GmodLocatedNode* nodes = nodesData();
+		for ( size_t i = 0; i + 1 < m_length; ++i )
+		{
+			if ( !Gmod::isLeafNode( nodes[i].node().metadata() ) )
 			{
 				continue;
 			}
 
-			parent->toString( builder );
+			nodes[i].toString( builder );
 			builder << separator;
 		}
 
-		m_node->toString( builder );
+		nodes[m_length - 1].toString( builder );
 	}
 
 	void GmodPath::toStringDump( std::stringstream& builder ) const
 	{
-		auto enumerator = this->enumerator();
+		const GmodLocatedNode* nodes = nodesData();
 		bool first = true;
 
-		while ( enumerator.next() )
+		for ( size_t depth = 1; depth < m_length; ++depth )
 		{
-			const auto& [depth, pathNode] = enumerator.current();
-
-			if ( depth == 0 )
-			{
-				continue;
-			}
+			const GmodNode& pathNode = nodes[depth].node();
 
 			if ( !first )
 			{
 				builder << " | ";
 			}
 
-			builder << pathNode->code().data();
+			builder << pathNode.code();
 
-			const auto& name = pathNode->metadata().name();
+			const auto& name = pathNode.metadata().name();
 			if ( !name.empty() )
 			{
 				builder << "/N:" << name;
 			}
 
-			const auto& commonName = pathNode->metadata().commonName();
+			const auto& commonName = pathNode.metadata().commonName();
 			if ( commonName.has_value() && !commonName->empty() )
 			{
 				builder << "/CN:" << *commonName;
@@ -1067,23 +1026,142 @@ namespace dnv::vista::sdk
 
 	void GmodPath::toFullPathString( std::stringstream& builder ) const
 	{
-		auto enumerator = this->enumerator();
+		const GmodLocatedNode* nodes = nodesData();
 
-		while ( enumerator.next() )
+		for ( size_t depth = 0; depth < m_length; ++depth )
 		{
-			const auto& [depth, pathNode] = enumerator.current();
+			nodes[depth].toString( builder );
 
-			if ( !pathNode )
+			if ( depth != ( m_length - 1 ) )
 			{
-				continue;
+				builder << '/';
 			}
+		}
+	}
 
-			pathNode->toString( builder );
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
 
-			if ( depth != ( length() - 1 ) )
+	const GmodLocatedNode* GmodPath::nodesData() const noexcept
+	{
+		return m_length <= m_inlineNodes.size() ? m_inlineNodes.data() : m_heapNodes.data();
+	}
+
+	GmodLocatedNode* GmodPath::nodesData() noexcept
+	{
+		return m_length <= m_inlineNodes.size() ? m_inlineNodes.data() : m_heapNodes.data();
+	}
+
+	GmodLocatedNode* GmodPath::resizeNodes( size_t length )
+	{
+		resetPathNodes();
+
+		m_length = length;
+		if ( m_length > m_inlineNodes.size() )
+		{
+			m_heapNodes.assign( m_length, GmodLocatedNode{} );
+
+			return m_heapNodes.data();
+		}
+
+		m_heapNodes.clear();
+
+		return m_inlineNodes.data();
+	}
+
+	void GmodPath::setNodes( std::span<const GmodLocatedNode> nodes )
+	{
+		GmodLocatedNode* data = resizeNodes( nodes.size() );
+		std::copy( nodes.begin(), nodes.end(), data );
+	}
+
+	const internal::PathNodes& GmodPath::pathNodes() const
+	{
+		if ( const internal::PathNodes* existing = m_pathNodes.load( std::memory_order_acquire ) )
+		{
+			return *existing;
+		}
+
+		const GmodLocatedNode* nodes = nodesData();
+		auto created = std::make_unique<internal::PathNodes>();
+		created->parents.reserve( m_length != 0 ? m_length - 1 : 0 );
+		created->located.reserve( static_cast<size_t>( std::count_if( nodes, nodes + m_length, []( const GmodLocatedNode& node ) { return node.hasLocation(); } ) ) );
+
+		/* Nodes are owned by the Gmod or the path; they are handed out mutable only for API compatibility */
+		for ( size_t i = 0; i < m_length; ++i )
+		{
+			GmodNode* node = nodes[i].hasLocation()
+								 ? &created->located.emplace_back( nodes[i].toNode() )
+								 : const_cast<GmodNode*>( &nodes[i].node() );
+
+			if ( i + 1 < m_length )
 			{
-				builder << '/';
+				created->parents.push_back( node );
 			}
+			else
+			{
+				created->node = node;
+			}
+		}
+
+		/* Readers of the same path may create the nodes concurrently; the first one to finish is kept */
+		const internal::PathNodes* expected = nullptr;
+		if ( m_pathNodes.compare_exchange_strong( expected, created.get(), std::memory_order_acq_rel, std::memory_order_acquire ) )
+		{
+			return *created.release();
+		}
+
+		return *expected;
+	}
+
+	void GmodPath::resetPathNodes() noexcept
+	{
+		delete m_pathNodes.exchange( nullptr );
+	}
+
+	void GmodPath::validate() const
+	{
+		const std::span<const GmodLocatedNode> nodes = locatedNodes();
+		const GmodNode& rootNode = m_gmod->rootNode();
+		const GmodNode& targetNode = nodes.back().node();
+
+		if ( nodes.size() == 1 )
+		{
+			if ( &targetNode != &rootNode )
+			{
+				throw std::invalid_argument( fmt::format( "Invalid GMOD path - no parents, and node '{}' is not the GMOD root '{}'.", targetNode.code(), rootNode.code() ) );
+			}
+		}
+		else
+		{
+			if ( &nodes[0].node() != &rootNode )
+			{
+				throw std::invalid_argument( fmt::format( "Invalid GMOD path - first parent '{}' should be GMOD root '{}'.", nodes[0].code(), rootNode.code() ) );
+			}
+
+			for ( size_t i = 0; i + 1 < nodes.size(); ++i )
+			{
+				if ( !nodes[i].node().isChild( nodes[i + 1].node() ) )
+				{
+					throw std::invalid_argument( fmt::format( "Invalid GMOD path - node '{}' not child of '{}'.", nodes[i + 1].code(), nodes[i].code() ) );
+				}
+			}
+		}
+
+		try
+		{
+			internal::LocationSetsVisitor visitor;
+			for ( size_t i = 0; i < nodes.size(); ++i )
+			{
+				visitor.visit( i, nodes );
+			}
+		}
+		catch ( [[maybe_unused]] const std::exception& ex )
+		{
+			SPDLOG_ERROR( "GmodPath construction for node '{}' failed during LocationSetsVisitor validation: {}", targetNode.code(), ex.what() );
+
+			throw;
 		}
 	}
 
@@ -1196,6 +1274,65 @@ namespace dnv::vista::sdk
 		return false;
 	}
 
+	std::vector<GmodPathParseOutcome> GmodPath::tryParseMany(
+		std::span<const std::string_view> items, const Gmod& gmod, const Locations& locations, const GmodPathParseOptions& options )
+	{
+		if ( gmod.visVersion() != locations.visVersion() )
+		{
+			throw std::invalid_argument( "Got different VIS versions for Gmod and Locations arguments" );
+		}
+
+		std::vector<GmodPathParseOutcome> outcomes( items.size() );
+		if ( items.empty() )
+		{
+			return outcomes;
+		}
+
+		const size_t chunkCount = ( items.size() + internal::PARSE_CHUNK_SIZE - 1 ) / internal::PARSE_CHUNK_SIZE;
+		const size_t threadCount = options.threadCount != 0 ? options.threadCount : std::max<size_t>( 1, std::thread::hardware_concurrency() );
+		const size_t workerCount = std::min( threadCount, chunkCount );
+
+		internal::ChunkRanges ranges( chunkCount, workerCount );
+		const bool fullPath = options.fullPath;
+
+		const std::function<void( size_t )> task = [&]( size_t worker ) {
+			size_t chunk;
+			while ( ranges.next( worker, chunk ) )
+			{
+				const size_t first = chunk * internal::PARSE_CHUNK_SIZE;
+				const size_t last = std::min( items.size(), first + internal::PARSE_CHUNK_SIZE );
+				for ( size_t i = first; i < last; ++i )
+				{
+					GmodPathParseOutcome& outcome = outcomes[i];
+					std::unique_ptr<GmodParsePathResult> result;
+					try
+					{
+						result = fullPath ? parseFullPathInternal( items[i], gmod, locations ) : parseInternal( items[i], gmod, locations );
+					}
+					catch ( const std::exception& ex )
+					{
+						outcome.error = ex.what();
+
+						continue;
+					}
+
+					if ( auto* okResult = dynamic_cast<GmodParsePathResult::Ok*>( result.get() ) )
+					{
+						outcome.path.emplace( std::move( okResult->path ) );
+					}
+					else if ( auto* errResult = dynamic_cast<GmodParsePathResult::Err*>( result.get() ) )
+					{
+						outcome.error = std::move( errResult->error );
+					}
+				}
+			}
+		};
+
+		internal::runWorkers( workerCount, options.executor, task );
+
+		return outcomes;
+	}
+
 	//----------------------------
 	// Enumeration
 	//----------------------------
@@ -1231,7 +1368,8 @@ namespace dnv::vista::sdk
 		if ( item.empty() )
 			return std::make_unique<GmodParsePathResult::Err>( "Item is empty" );
 
-		std::deque<internal::PathNode> parts;
+		internal::ParseScratch& scratch = internal::threadParseScratch();
+		std::deque<internal::PathNode>& parts = scratch.parts;
 		std::string_view currentSegment = item;
 		while ( !currentSegment.empty() )
 		{
@@ -1263,7 +1401,8 @@ namespace dnv::vista::sdk
 				if ( !gmod.tryGetNode( part, tempNodeCheck ) )
 					return std::make_unique<GmodParsePathResult::Err>( fmt::format( "Failed to get GmodNode for {}", std::string( part ) ) );
 			}
-			parts.push_back( currentPathNode );
+			currentPathNode.node = tempNodeCheck;
+			parts.push_back( std::move( currentPathNode ) );
 
 			if ( slashPosition == std::string_view::npos )
 				break;
@@ -1279,43 +1418,51 @@ namespace dnv::vista::sdk
 				return std::make_unique<GmodParsePathResult::Err>( "Found part with empty code" );
 		}
 
-		internal::PathNode toFind = parts.front();
+		internal::PathNode toFind = std::move( parts.front() );
 		parts.pop_front();
 
 		const GmodNode* baseNode = nullptr;
 		if ( !gmod.tryGetNode( toFind.code, baseNode ) || !baseNode )
 			return std::make_unique<GmodParsePathResult::Err>( "Failed to get GmodNode for " + toFind.code );
 
-		internal::ParseContext context( std::move( parts ), gmod, toFind );
+		internal::ParseContext context( parts, scratch.nodeLocations, scratch.pathNodes, gmod, std::move( toFind ) );
 
-		TraverseHandlerWithState<internal::ParseContext> handler =
-			[]( internal::ParseContext& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
-			return internal::parseInternalTraversalHandler( state, parents, node );
-		};
+		const internal::GmodGraph* graph = baseNode->graph();
+		if ( graph != nullptr ) [[likely]]
+		{
+			internal::resolveParts( context, *graph, scratch.stack, baseNode->graphIndex() );
+		}
+		else
+		{
+			TraverseHandlerWithState<internal::ParseContext> handler =
+				[]( internal::ParseContext& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+				return internal::parseInternalTraversalHandler( state, parents, node );
+			};
 
-		GmodTraversal::traverse( context, *baseNode, handler );
+			GmodTraversal::traverse( context, *baseNode, handler );
+		}
 
 		if ( context.resultingPath.has_value() )
 		{
-			const auto& resultPath = context.resultingPath.value();
+			const std::span<const GmodLocatedNode> resultNodes = context.resultingPath->locatedNodes();
 
-			if ( resultPath.m_parents.empty() )
+			if ( resultNodes.size() == 1 )
 			{
-				if ( resultPath.m_node != &gmod.rootNode() )
+				if ( &resultNodes[0].node() != &gmod.rootNode() )
 				{
 					return std::make_unique<GmodParsePathResult::Err>( "Single node path must be the root node" );
 				}
 			}
 			else
 			{
-				if ( resultPath.m_parents.empty() || resultPath.m_parents[0] != &gmod.rootNode() )
+				if ( &resultNodes[0].node() != &gmod.rootNode() )
 				{
 					return std::make_unique<GmodParsePathResult::Err>( "Path must start from root node" );
 				}
 			}
 
 			int missingLinkAt;
-			if ( !GmodPath::isValid( resultPath.m_parents, *resultPath.m_node, missingLinkAt ) )
+			if ( !GmodPath::isValid( resultNodes, missingLinkAt ) )
 			{
 				return std::make_unique<GmodParsePathResult::Err>( "Invalid path structure - missing parent-child relationship" );
 			}
@@ -1324,9 +1471,6 @@ namespace dnv::vista::sdk
 		}
 		else
 		{
-			for ( GmodNode* ownedNode : context.ownedNodesForCurrentPath )
-				delete ownedNode;
-
 			return std::make_unique<GmodParsePathResult::Err>( "Failed to find path after traversal for item '" + std::string( item ) + "'." );
 		}
 	}
@@ -1367,138 +1511,160 @@ namespace dnv::vista::sdk
 				std::string( rootNodeCode ) + "'. Path was: '" + std::string( item ) + "'" );
 		}
 
-		std::vector<GmodNode> parsedNodes;
-		if ( item.length() > 0 )
-		{
-			parsedNodes.reserve( item.length() / 3 );
-		}
-
-		std::string_view currentProcessing = item;
+		/* Scratch for the segments; paths of typical depth fit the inline buffers */
+		constexpr size_t inlineCapacity = INLINE_PARENTS_CAPACITY + 1;
+		std::array<std::string_view, inlineCapacity> inlineCodes;
+		std::array<std::string_view, inlineCapacity> inlineLocations;
+		std::array<const GmodNode*, inlineCapacity> inlineNodes;
+		std::array<std::optional<Location>, inlineCapacity> inlineParsedLocations;
+		std::vector<std::string_view> heapCodes;
+		std::vector<std::string_view> heapLocations;
+		std::vector<const GmodNode*> heapNodes;
+		std::vector<std::optional<Location>> heapParsedLocations;
+
+		std::span<std::string_view> codes = inlineCodes;
+		std::span<std::string_view> locationParts = inlineLocations;
+		std::span<const GmodNode*> nodes = inlineNodes;
+		std::span<std::optional<Location>> parsedLocations = inlineParsedLocations;
+
+		const size_t maxNodeCount = static_cast<size_t>( std::count( item.begin(), item.end(), '/' ) ) + 1;
+		if ( maxNodeCount > inlineCapacity )
+		{
+			heapCodes.resize( maxNodeCount );
+			heapLocations.resize( maxNodeCount );
+			heapNodes.resize( maxNodeCount );
+			heapParsedLocations.resize( maxNodeCount );
+			codes = heapCodes;
+			locationParts = heapLocations;
+			nodes = heapNodes;
+			parsedLocations = heapParsedLocations;
+		}
+
+		/* A segment without '-' gets a null location view, "code-" an empty one */
+		size_t nodeCount = 0;
 		size_t searchOffset = 0;
-		while ( searchOffset < currentProcessing.length() )
+		while ( searchOffset < item.length() )
 		{
-			size_t nextSlashPos = currentProcessing.find( '/', searchOffset );
-			std::string_view nodeCode;
+			size_t nextSlashPos = item.find( '/', searchOffset );
+			std::string_view segment;
 
 			if ( nextSlashPos == std::string_view::npos )
 			{
-				nodeCode = currentProcessing.substr( searchOffset );
-				searchOffset = currentProcessing.length();
+				segment = item.substr( searchOffset );
+				searchOffset = item.length();
 			}
 			else
 			{
-				nodeCode = currentProcessing.substr( searchOffset, nextSlashPos - searchOffset );
+				segment = item.substr( searchOffset, nextSlashPos - searchOffset );
 				searchOffset = nextSlashPos + 1;
 			}
 
-			if ( nodeCode.empty() )
+			size_t dashIndex = segment.find( '-' );
+			codes[nodeCount] = segment.substr( 0, dashIndex );
+			locationParts[nodeCount] = dashIndex == std::string_view::npos ? std::string_view{} : segment.substr( dashIndex + 1 );
+			++nodeCount;
+		}
+
+		if ( nodeCount == 0 )
+		{
+			return std::make_unique<GmodParsePathResult::Err>(
+				"GmodPath::parseFullPathInternal: Failed to find any nodes in path string '" + std::string( item ) + "'." );
+		}
+
+		codes = codes.first( nodeCount );
+		nodes = nodes.first( nodeCount );
+		(void)gmod.tryGetNodes( codes, nodes );
+
+		/* Errors are reported for the first bad segment, in path order */
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			const bool hasLocation = locationParts[i].data() != nullptr;
+
+			if ( codes[i].empty() && !hasLocation )
 			{
 				return std::make_unique<GmodParsePathResult::Err>(
 					fmt::format( "GmodPath::parseFullPathInternal: Path string '{}' contains an empty segment.", item ) );
 			}
 
-			size_t dashIndex = nodeCode.find( '-' );
-			const GmodNode* tempNode = nullptr;
-
-			if ( dashIndex == std::string_view::npos )
+			if ( !nodes[i] )
 			{
-				if ( !gmod.tryGetNode( nodeCode, tempNode ) || !tempNode )
-				{
-					return std::make_unique<GmodParsePathResult::Err>(
-						fmt::format( "Failed to get GmodNode for {}", std::string( nodeCode ) ) );
-				}
-
-				parsedNodes.push_back( *tempNode );
+				return std::make_unique<GmodParsePathResult::Err>(
+					fmt::format( "Failed to get GmodNode for {}", std::string( codes[i] ) ) );
 			}
-			else
+
+			if ( !hasLocation )
 			{
-				std::string_view codepart = nodeCode.substr( 0, dashIndex );
-				if ( !gmod.tryGetNode( codepart, tempNode ) || !tempNode )
-				{
-					return std::make_unique<GmodParsePathResult::Err>(
-						fmt::format( "Failed to get GmodNode for {}", std::string( codepart ) ) );
-				}
-				std::string_view location = nodeCode.substr( dashIndex + 1 );
-				Location parsedLocation;
-				if ( !locations.tryParse( location, parsedLocation ) )
-				{
-					return std::make_unique<GmodParsePathResult::Err>(
-						fmt::format( "Failed to parse location - {}", std::string( location ) ) );
-				}
+				continue;
+			}
 
-				parsedNodes.push_back( tempNode->tryWithLocation( std::make_optional( parsedLocation ) ) );
+			Location parsedLocation;
+			if ( !locations.tryParse( locationParts[i], parsedLocation ) )
+			{
+				return std::make_unique<GmodParsePathResult::Err>(
+					fmt::format( "Failed to parse location - {}", std::string( locationParts[i] ) ) );
 			}
-		}
 
-		if ( parsedNodes.empty() )
-		{
-			return std::make_unique<GmodParsePathResult::Err>(
-				"GmodPath::parseFullPathInternal: Failed to find any nodes in path string '" + std::string( item ) + "'." );
+			parsedLocations[i] = std::move( parsedLocation );
 		}
 
-		GmodNode tempEndNode = parsedNodes.back();
-		parsedNodes.pop_back();
-
-		std::vector<GmodNode*> tempParentsForValidation;
-		tempParentsForValidation.reserve( parsedNodes.size() );
-		for ( GmodNode& pv : parsedNodes )
+		/* Links are checked on the graph: a binary search in the sorted child code ids of each parent */
+		const internal::GmodGraph& graph = *gmod.rootNode().graph();
+		const size_t parentCount = nodeCount - 1;
+		bool isValidSequence = parentCount != 0 && nodes[0]->isRoot();
+		for ( size_t i = 0; isValidSequence && i < parentCount; ++i )
 		{
-			tempParentsForValidation.push_back( &pv );
+			isValidSequence = graph.isChild( nodes[i]->graphIndex(), nodes[i + 1]->codeId() );
 		}
 
-		int missingLinkAt;
-		if ( !GmodPath::isValid( tempParentsForValidation, tempEndNode, missingLinkAt ) )
+		if ( !isValidSequence )
 		{
 			return std::make_unique<GmodParsePathResult::Err>(
 				"GmodPath::parseFullPathInternal: Sequence of nodes is invalid. Path: '" + std::string( item ) + "'" );
 		}
 
+		/* The nodes are written to the resulting path; set locations are applied to them in place below */
+		GmodPath finalPath;
+		finalPath.m_gmod = &gmod;
+		finalPath.m_visVersion = nodes[parentCount]->visVersion();
+
+		const std::span<GmodLocatedNode> pathNodes( finalPath.resizeNodes( nodeCount ), nodeCount );
+		for ( size_t i = 0; i < nodeCount; ++i )
+		{
+			pathNodes[i] = GmodLocatedNode{ *nodes[i], parsedLocations[i] };
+		}
+
 		internal::LocationSetsVisitor locationVisitor;
 		std::optional<size_t> previousNonNullLocationIdx;
 
 		std::array<std::pair<int, int>, 16> setsArray;
 		int setCounter = 0;
 
-		std::vector<GmodNode*> tempParentsForVisit;
-		tempParentsForVisit.reserve( parsedNodes.size() );
-		for ( GmodNode& node : parsedNodes )
-		{
-			tempParentsForVisit.push_back( &node );
-		}
-
-		for ( size_t i = 0; i < parsedNodes.size() + 1; ++i )
+		for ( size_t i = 0; i < nodeCount; ++i )
 		{
-			GmodNode& nodeForVisit = ( i < parsedNodes.size() ) ? parsedNodes[i] : tempEndNode;
-
-			std::optional<std::tuple<size_t, size_t, std::optional<Location>>> setDetails =
-				locationVisitor.visit( nodeForVisit, i, tempParentsForVisit, tempEndNode );
+			std::optional<internal::LocationSet> setDetails = locationVisitor.visit( i, pathNodes );
 
 			if ( !setDetails.has_value() )
 			{
-				if ( !previousNonNullLocationIdx.has_value() && nodeForVisit.location().has_value() )
+				if ( !previousNonNullLocationIdx.has_value() && pathNodes[i].hasLocation() )
 				{
 					previousNonNullLocationIdx = i;
 				}
 				continue;
 			}
 
-			const auto& setTuple = setDetails.value();
-			size_t setStartIdx = std::get<0>( setTuple );
-			size_t setEndIdx = std::get<1>( setTuple );
-			std::optional<Location> setCommonLocation = std::get<2>( setTuple );
+			size_t setStartIdx = setDetails->start;
+			size_t setEndIdx = setDetails->end;
 
 			if ( previousNonNullLocationIdx.has_value() )
 			{
 				for ( size_t j = previousNonNullLocationIdx.value(); j < setStartIdx; ++j )
 				{
-					GmodNode& previousNode = ( j < parsedNodes.size() )
-												 ? parsedNodes[j]
-												 : tempEndNode;
+					const GmodLocatedNode& previousNode = pathNodes[j];
 
-					if ( previousNode.location().has_value() )
+					if ( previousNode.hasLocation() )
 					{
 						return std::make_unique<GmodParsePathResult::Err>(
-							fmt::format( "Expected all nodes in the set to be without individualization. Found {}", std::string( previousNode.code() ) ) );
+							fmt::format( "Expected all nodes in the set to be without individualization. Found {}", previousNode.code() ) );
 					}
 				}
 			}
@@ -1513,25 +1679,23 @@ namespace dnv::vista::sdk
 				throw std::out_of_range( fmt::format( "Exceeded maximum of 16 location sets supported while parsing path: '{}'", std::string( item ) ) );
 			}
 
-			if ( setStartIdx == setEndIdx )
+			if ( setStartIdx == setEndIdx || setDetails->location == nullptr )
 				continue;
 
+			/* The set location points into the path, which is updated below */
+			const GmodLocatedNode setLocation = *setDetails->location;
 			for ( size_t j = setStartIdx; j <= setEndIdx; ++j )
 			{
-				if ( j < parsedNodes.size() )
-				{
-					parsedNodes[j] = parsedNodes[j].tryWithLocation( setCommonLocation );
-				}
-				else
+				if ( !pathNodes[j].hasSameLocation( setLocation ) )
 				{
-					tempEndNode = tempEndNode.tryWithLocation( setCommonLocation );
+					pathNodes[j] = setLocation.withNode( pathNodes[j].node() );
 				}
 			}
 		}
 
 		std::pair<int, int> currentSet = { -1, -1 };
 		int currentSetIndex = 0;
-		for ( int i = 0; i < static_cast<int>( parsedNodes.size() ) + 1; ++i )
+		for ( int i = 0; i < static_cast<int>( nodeCount ); ++i )
 		{
 			while ( currentSetIndex < setCounter && currentSet.second < i )
 			{
@@ -1548,74 +1712,41 @@ namespace dnv::vista::sdk
 
 			bool insideSet = ( currentSet.first != -1 && i >= currentSet.first && i <= currentSet.second );
 
-			GmodNode& nodeCheck = ( static_cast<size_t>( i ) < parsedNodes.size() )
-									  ? parsedNodes[static_cast<size_t>( i )]
-									  : tempEndNode;
-
-			const GmodNode* expectedLocationNode = nullptr;
-			if ( currentSet.second != -1 )
-			{
-				if ( currentSet.second >= 0 && currentSet.second < static_cast<int>( parsedNodes.size() ) )
-				{
-					expectedLocationNode = &parsedNodes[static_cast<size_t>( currentSet.second )];
-				}
-				else
-				{
-					expectedLocationNode = &tempEndNode;
-				}
-			}
+			const GmodLocatedNode& nodeCheck = pathNodes[static_cast<size_t>( i )];
 
 			if ( insideSet )
 			{
-				if ( !expectedLocationNode || nodeCheck.location() != expectedLocationNode->location() )
+				/* Nodes in a set share the location of its last node */
+				const GmodLocatedNode& expectedLocationNode = pathNodes[static_cast<size_t>( currentSet.second )];
+
+				if ( !nodeCheck.hasSameLocation( expectedLocationNode ) )
 				{
-					[[maybe_unused]] auto formatLocation = []( const std::optional<Location>& location ) -> std::string {
-						if ( location.has_value() )
+					[[maybe_unused]] auto formatLocation = []( const GmodLocatedNode& node ) -> std::string {
+						if ( node.hasLocation() )
 						{
-							return location.value().toString();
+							return node.location()->toString();
 						}
 						return "nullopt";
 					};
 
 					return std::make_unique<GmodParsePathResult::Err>(
 						"GmodPath::parseFullPathInternal: Expected nodes in set to be individualized the same. Found " +
-						std::string( nodeCheck.code().data() ) + " with location " +
-						formatLocation( nodeCheck.location() ) + ", expected " +
-						formatLocation( expectedLocationNode ? expectedLocationNode->location() : std::optional<Location>() ) );
+						nodeCheck.code() + " with location " +
+						formatLocation( nodeCheck ) + ", expected " +
+						formatLocation( expectedLocationNode ) );
 				}
 			}
 			else
 			{
-				if ( nodeCheck.location().has_value() )
+				if ( nodeCheck.hasLocation() )
 				{
 					return std::make_unique<GmodParsePathResult::Err>(
-						fmt::format( "Expected all nodes outside set to be without individualization. Found {}", std::string( nodeCheck.code() ) ) );
+						fmt::format( "Expected all nodes outside set to be without individualization. Found {}", nodeCheck.code() ) );
 				}
 			}
 		}
 
-		auto finalPath = std::make_unique<GmodPath>();
-		finalPath->m_gmod = &gmod;
-		finalPath->m_visVersion = gmod.visVersion();
-
-		finalPath->m_parents.reserve( parsedNodes.size() );
-		for ( const GmodNode& parsedNode : parsedNodes )
-		{
-			GmodNode* heapParent = new GmodNode( parsedNode );
-			finalPath->m_parents.push_back( heapParent );
-			finalPath->m_ownedNodes.push_back( heapParent );
-		}
-
-		GmodNode* heapEndNode = new GmodNode( tempEndNode );
-		finalPath->m_node = heapEndNode;
-		finalPath->m_ownedNodes.push_back( heapEndNode );
-
-		if ( finalPath->m_node )
-		{
-			finalPath->m_visVersion = finalPath->m_node->visVersion();
-		}
-
-		return std::make_unique<GmodParsePathResult::Ok>( std::move( *finalPath ) );
+		return std::make_unique<GmodParsePathResult::Ok>( std::move( finalPath ) );
 	}
 
 	//----------------------------------------------
@@ -1696,6 +1827,7 @@ namespace dnv::vista::sdk
 			throw std::invalid_argument( "GmodIndividualizableSet constructor: nodeIndices cannot be empty." );
 		}
 
+		const std::span<const GmodLocatedNode> pathNodes = m_path.locatedNodes();
 		for ( int nodeIdx : m_nodeIndices )
 		{
 			if ( static_cast<size_t>( nodeIdx ) >= m_path.length() || nodeIdx < 0 )
@@ -1705,36 +1837,35 @@ namespace dnv::vista::sdk
 										 std::to_string( m_path.length() ) + "." );
 			}
 
-			GmodNode* currentNode = m_path[static_cast<size_t>( nodeIdx )];
-			if ( !currentNode )
+			if ( static_cast<size_t>( nodeIdx ) >= pathNodes.size() )
 			{
 				throw std::runtime_error( "GmodIndividualizableSet constructor: Node at index " +
 										  std::to_string( nodeIdx ) + " is null in the source path." );
 			}
 
+			const GmodLocatedNode& currentNode = pathNodes[static_cast<size_t>( nodeIdx )];
 			bool isTargetNode = ( static_cast<size_t>( nodeIdx ) == m_path.length() - 1 );
 			bool isInSet = ( m_nodeIndices.size() > 1 );
-			if ( !currentNode->isIndividualizable( isTargetNode, isInSet ) )
+			if ( !currentNode.node().isIndividualizable( isTargetNode, isInSet ) )
 			{
 				throw std::invalid_argument( "GmodIndividualizableSet constructor: Node '" +
-											 std::string( currentNode->code().data() ) + "' (at index " +
+											 currentNode.code() + "' (at index " +
 											 std::to_string( nodeIdx ) + ") is not individualizable in the given context." );
 			}
 		}
 
 		if ( m_nodeIndices.size() > 1 )
 		{
-			GmodNode* firstNode = m_path[static_cast<size_t>( m_nodeIndices[0] )];
-			std::optional<Location> expectedLocation = firstNode->location();
+			const GmodLocatedNode& firstNode = pathNodes[static_cast<size_t>( m_nodeIndices[0] )];
 
 			for ( size_t k = 1; k < m_nodeIndices.size(); ++k )
 			{
 				int currentIdx = m_nodeIndices[k];
-				GmodNode* currentNode = m_path[static_cast<size_t>( currentIdx )];
-				if ( currentNode->location() != expectedLocation )
+				const GmodLocatedNode& currentNode = pathNodes[static_cast<size_t>( currentIdx )];
+				if ( !currentNode.hasSameLocation( firstNode ) )
 				{
 					throw std::invalid_argument( "GmodIndividualizableSet constructor: Nodes have different locations. Node '" +
-												 std::string( currentNode->code().data() ) + "' (at index " +
+												 currentNode.code() + "' (at index " +
 												 std::to_string( currentIdx ) + ") has location while first node in set had different or no location." );
 				}
 			}
@@ -1743,8 +1874,8 @@ namespace dnv::vista::sdk
 		bool foundPartOfShortPath = false;
 		for ( int nodeIdx : m_nodeIndices )
 		{
-			GmodNode* currentNode = m_path[static_cast<size_t>( nodeIdx )];
-			if ( currentNode == m_path.node() || currentNode->isLeafNode() )
+			const size_t index = static_cast<size_t>( nodeIdx );
+			if ( index + 1 == pathNodes.size() || pathNodes[index].node().isLeafNode() )
 			{
 				foundPartOfShortPath = true;
 				break;
@@ -1808,47 +1939,31 @@ namespace dnv::vista::sdk
 		}
 
 		int firstNodeIdx = m_nodeIndices[0];
-		if ( firstNodeIdx < 0 || static_cast<size_t>( firstNodeIdx ) >= m_path.length() )
+		const std::span<const GmodLocatedNode> pathNodes = m_path.locatedNodes();
+		if ( firstNodeIdx < 0 || static_cast<size_t>( firstNodeIdx ) >= pathNodes.size() )
 		{
 			return std::nullopt;
 		}
 
-		const GmodNode* firstNode = m_path[static_cast<size_t>( firstNodeIdx )];
-		if ( !firstNode )
-		{
-			return std::nullopt;
-		}
-
-		return firstNode->location();
+		return pathNodes[static_cast<size_t>( firstNodeIdx )].location();
 	}
 
 	void GmodIndividualizableSet::setLocation( const std::optional<Location>& location )
 	{
+		m_path.resetPathNodes();
+
+		GmodLocatedNode* pathNodes = m_path.nodesData();
 		for ( size_t i = 0; i < m_nodeIndices.size(); ++i )
 		{
 			int nodeIdx = m_nodeIndices[i];
 
-			if ( nodeIdx < 0 || static_cast<size_t>( nodeIdx ) >= m_path.length() )
-			{
-				continue;
-			}
-
-			GmodNode*& nodeInPath = m_path[static_cast<size_t>( nodeIdx )];
-			if ( !nodeInPath )
+			if ( nodeIdx < 0 || static_cast<size_t>( nodeIdx ) >= m_path.m_length )
 			{
 				continue;
 			}
 
-			if ( !location.has_value() )
-			{
-				GmodNode newNode = nodeInPath->withoutLocation();
-				*nodeInPath = std::move( newNode );
-			}
-			else
-			{
-				GmodNode newNode = nodeInPath->withLocation( location.value() );
-				*nodeInPath = std::move( newNode );
-			}
+			GmodLocatedNode& nodeInPath = pathNodes[static_cast<size_t>( nodeIdx )];
+			nodeInPath = GmodLocatedNode{ nodeInPath.node(), location };
 		}
 	}
 
@@ -1866,20 +1981,21 @@ namespace dnv::vista::sdk
 				continue;
 			}
 
-			GmodNode* currentNode = m_path[static_cast<size_t>( nodeIdx )];
-			if ( !currentNode )
+			const std::span<const GmodLocatedNode> pathNodes = m_path.locatedNodes();
+			if ( static_cast<size_t>( nodeIdx ) >= pathNodes.size() )
 			{
 				SPDLOG_ERROR( "GmodIndividualizableSet::toString(): Node at index {} in m_path is null. Skipping.", nodeIdx );
 				continue;
 			}
 
-			if ( currentNode->isLeafNode() || j == m_nodeIndices.size() - 1 )
+			const GmodLocatedNode& currentNode = pathNodes[static_cast<size_t>( nodeIdx )];
+			if ( currentNode.node().isLeafNode() || j == m_nodeIndices.size() - 1 )
 			{
 				if ( firstNodeAppended )
 				{
 					ss << '/';
 				}
-				currentNode->toString( ss );
+				currentNode.toString( ss );
 				firstNodeAppended = true;
 			}
 		}
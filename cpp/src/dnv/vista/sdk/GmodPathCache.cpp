@@ -0,0 +1,303 @@
+/**
+ * @file GmodPathCache.cpp
+ * @brief Implementation of the short GMOD path parse cache
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/GmodPathCache.h"
+
+#include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/Locations.h"
+#include "dnv/vista/sdk/VIS.h"
+
+namespace dnv::vista::sdk
+{
+	namespace
+	{
+		//----------------------------------------------
+		// Keys
+		//----------------------------------------------
+
+		/** @brief Cache key; `path` views the string owned by the slot or the caller. */
+		struct KeyView
+		{
+			VisVersion version;
+			std::string_view path;
+
+			bool operator==( const KeyView& other ) const noexcept
+			{
+				return version == other.version && path == other.path;
+			}
+		};
+
+		size_t hashOf( const KeyView& key ) noexcept
+		{
+			return std::hash<std::string_view>{}( key.path ) ^ ( static_cast<size_t>( key.version ) * 0x9e3779b97f4a7c15ull );
+		}
+
+		struct KeyViewHash
+		{
+			size_t operator()( const KeyView& key ) const noexcept
+			{
+				return hashOf( key );
+			}
+		};
+
+		/**
+		 * @brief Trims a path the way `GmodPath::tryParse()` does before parsing it.
+		 * @param item The path string.
+		 * @return `item` without surrounding whitespace and without one leading '/'.
+		 */
+		std::string_view normalize( std::string_view item ) noexcept
+		{
+			constexpr std::string_view whitespace = " \t\n\r\f\v";
+
+			const size_t start = item.find_first_not_of( whitespace );
+			if ( start == std::string_view::npos )
+			{
+				return {};
+			}
+
+			item = item.substr( start, item.find_last_not_of( whitespace ) - start + 1 );
+			if ( item.front() == '/' )
+			{
+				item.remove_prefix( 1 );
+			}
+
+			return item;
+		}
+	}
+
+	//=====================================================================
+	// GmodPathCache::Shard struct
+	//=====================================================================
+
+	/**
+	 * @brief One independently locked part of the cache.
+	 * @details `slots` is sized once, so slot strings never move and `index` can view them.
+	 */
+	struct GmodPathCache::Shard
+	{
+		struct Slot
+		{
+			VisVersion version{};
+			std::string path;
+			uint64_t gmodId{ 0 };
+			std::shared_ptr<const GmodPath> value;
+			std::atomic<bool> referenced{ false };
+		};
+
+		std::vector<Slot> slots;
+		std::unordered_map<KeyView, size_t, KeyViewHash> index;
+		size_t used{ 0 };
+		size_t hand{ 0 };
+
+		std::atomic<uint64_t> hits{ 0 };
+		std::atomic<uint64_t> misses{ 0 };
+		std::atomic<uint64_t> evictions{ 0 };
+
+		mutable std::shared_mutex mutex;
+
+		/**
+		 * @brief Picks the slot for a new entry, evicting with the CLOCK algorithm once all are used.
+		 * @return The index of a slot without an index entry.
+		 */
+		size_t claimSlot()
+		{
+			if ( used < slots.size() )
+			{
+				return used++;
+			}
+
+			while ( slots[hand].referenced.exchange( false, std::memory_order_relaxed ) )
+			{
+				hand = ( hand + 1 ) % slots.size();
+			}
+
+			const size_t victim = hand;
+			hand = ( hand + 1 ) % slots.size();
+
+			Slot& slot = slots[victim];
+			index.erase( KeyView{ slot.version, slot.path } );
+			slot.value.reset();
+			evictions.fetch_add( 1, std::memory_order_relaxed );
+
+			return victim;
+		}
+	};
+
+	//=====================================================================
+	// GmodPathCache class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction / destruction
+	//----------------------------------------------
+
+	GmodPathCache::GmodPathCache( size_t capacity, size_t shardCount )
+	{
+		if ( capacity == 0 || shardCount == 0 )
+		{
+			throw std::invalid_argument( "GmodPathCache: capacity and shard count must be positive" );
+		}
+
+		shardCount = std::bit_ceil( shardCount );
+		m_shardMask = shardCount - 1;
+		m_shardCapacity = ( capacity + shardCount - 1 ) / shardCount;
+		m_shards = std::make_unique<Shard[]>( shardCount );
+
+		for ( size_t i = 0; i < shardCount; ++i )
+		{
+			m_shards[i].slots = std::vector<Shard::Slot>( m_shardCapacity );
+			m_shards[i].index.reserve( m_shardCapacity );
+		}
+	}
+
+	GmodPathCache::~GmodPathCache() = default;
+
+	//----------------------------------------------
+	// Parsing
+	//----------------------------------------------
+
+	bool GmodPathCache::tryParse( std::string_view item, const Gmod& gmod, const Locations& locations, std::shared_ptr<const GmodPath>& outPath )
+	{
+		const KeyView key{ gmod.visVersion(), normalize( item ) };
+		const size_t hash = hashOf( key );
+		Shard& shard = shardOf( hash );
+
+		{
+			std::shared_lock lock( shard.mutex );
+
+			auto it = shard.index.find( key );
+			if ( it != shard.index.end() )
+			{
+				Shard::Slot& slot = shard.slots[it->second];
+				if ( slot.gmodId == gmod.instanceId() )
+				{
+					slot.referenced.store( true, std::memory_order_relaxed );
+					outPath = slot.value;
+					shard.hits.fetch_add( 1, std::memory_order_relaxed );
+
+					return true;
+				}
+			}
+		}
+
+		shard.misses.fetch_add( 1, std::memory_order_relaxed );
+
+		/* Parse outside the lock; a concurrent miss on the same key parses too, and one result is kept */
+		std::optional<GmodPath> parsed;
+		if ( !GmodPath::tryParse( key.path, gmod, locations, parsed ) )
+		{
+			outPath.reset();
+
+			return false;
+		}
+
+		auto value = std::make_shared<const GmodPath>( std::move( *parsed ) );
+
+		std::unique_lock lock( shard.mutex );
+
+		auto it = shard.index.find( key );
+		if ( it != shard.index.end() )
+		{
+			Shard::Slot& slot = shard.slots[it->second];
+			if ( slot.gmodId == gmod.instanceId() )
+			{
+				outPath = slot.value;
+
+				return true;
+			}
+
+			/* Parsed against another Gmod of the same version: the newer one takes the slot */
+			slot.gmodId = gmod.instanceId();
+			slot.value = value;
+			slot.referenced.store( false, std::memory_order_relaxed );
+			outPath = std::move( value );
+
+			return true;
+		}
+
+		const size_t slotIndex = shard.claimSlot();
+		Shard::Slot& slot = shard.slots[slotIndex];
+		slot.version = key.version;
+		slot.path.assign( key.path );
+		slot.gmodId = gmod.instanceId();
+		slot.value = value;
+		slot.referenced.store( false, std::memory_order_relaxed );
+		shard.index.emplace( KeyView{ slot.version, slot.path }, slotIndex );
+
+		outPath = std::move( value );
+
+		return true;
+	}
+
+	bool GmodPathCache::tryParse( std::string_view item, VisVersion visVersion, std::shared_ptr<const GmodPath>& outPath )
+	{
+		VIS& vis = VIS::instance();
+
+		return tryParse( item, vis.gmod( visVersion ), vis.locations( visVersion ), outPath );
+	}
+
+	bool GmodPathCache::tryParse( std::string_view item, const Gmod& gmod, std::shared_ptr<const GmodPath>& outPath )
+	{
+		return tryParse( item, gmod, VIS::instance().locations( gmod.visVersion() ), outPath );
+	}
+
+	//----------------------------------------------
+	// Management
+	//----------------------------------------------
+
+	void GmodPathCache::clear()
+	{
+		for ( size_t i = 0; i <= m_shardMask; ++i )
+		{
+			Shard& shard = m_shards[i];
+			std::unique_lock lock( shard.mutex );
+
+			shard.index.clear();
+			for ( size_t s = 0; s < shard.used; ++s )
+			{
+				shard.slots[s].value.reset();
+				shard.slots[s].path.clear();
+				shard.slots[s].referenced.store( false, std::memory_order_relaxed );
+			}
+			shard.used = 0;
+			shard.hand = 0;
+		}
+	}
+
+	GmodPathCache::Statistics GmodPathCache::statistics() const
+	{
+		Statistics result{ 0, 0, 0, 0 };
+		for ( size_t i = 0; i <= m_shardMask; ++i )
+		{
+			const Shard& shard = m_shards[i];
+
+			result.hits += shard.hits.load( std::memory_order_relaxed );
+			result.misses += shard.misses.load( std::memory_order_relaxed );
+			result.evictions += shard.evictions.load( std::memory_order_relaxed );
+
+			std::shared_lock lock( shard.mutex );
+			result.size += shard.index.size();
+		}
+
+		return result;
+	}
+
+	size_t GmodPathCache::capacity() const noexcept
+	{
+		return m_shardCapacity * ( m_shardMask + 1 );
+	}
+
+	//----------------------------------------------
+	// Private helper methods
+	//----------------------------------------------
+
+	GmodPathCache::Shard& GmodPathCache::shardOf( size_t hash ) const noexcept
+	{
+		/* The low bits pick the bucket inside the shard's map, so mix the high ones into the shard */
+		return m_shards[( ( hash * 0x9e3779b97f4a7c15ull ) >> 32 ) & m_shardMask];
+	}
+}
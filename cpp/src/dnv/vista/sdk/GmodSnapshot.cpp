@@ -0,0 +1,611 @@
+/**
+ * @file GmodSnapshot.cpp
+ * @brief Implementation of the binary GMOD cache writer and reader
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/GmodSnapshot.h"
+
+#include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/VISVersion.h"
+
+#if defined( _WIN32 )
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace dnv::vista::sdk
+{
+	namespace
+	{
+		//=====================================================================
+		// Constants
+		//=====================================================================
+
+		static constexpr size_t SECTION_ALIGNMENT{ 8 };
+
+		//=====================================================================
+		// Helper functions
+		//=====================================================================
+
+		inline constexpr uint64_t alignUp( uint64_t offset ) noexcept
+		{
+			return ( offset + SECTION_ALIGNMENT - 1 ) & ~static_cast<uint64_t>( SECTION_ALIGNMENT - 1 );
+		}
+
+		inline uint32_t checksum( const std::byte* data, size_t size ) noexcept
+		{
+			return static_cast<uint32_t>( ::crc32( 0L, reinterpret_cast<const Bytef*>( data ), static_cast<uInt>( size ) ) );
+		}
+
+		//----------------------------------------------
+		// Memory mapping
+		//----------------------------------------------
+
+		std::pair<const std::byte*, size_t> mapFile( const std::filesystem::path& path )
+		{
+#if defined( _WIN32 )
+			HANDLE file = ::CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+			if ( file == INVALID_HANDLE_VALUE )
+			{
+				throw std::runtime_error( fmt::format( "Failed to open GMOD snapshot '{}'", path.string() ) );
+			}
+
+			LARGE_INTEGER fileSize{};
+			if ( !::GetFileSizeEx( file, &fileSize ) || fileSize.QuadPart <= 0 )
+			{
+				::CloseHandle( file );
+				throw std::runtime_error( fmt::format( "Failed to read size of GMOD snapshot '{}'", path.string() ) );
+			}
+
+			HANDLE mapping = ::CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+			::CloseHandle( file );
+			if ( mapping == nullptr )
+			{
+				throw std::runtime_error( fmt::format( "Failed to create file mapping for GMOD snapshot '{}'", path.string() ) );
+			}
+
+			/* The view keeps the mapping object alive */
+			void* view = ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+			::CloseHandle( mapping );
+			if ( view == nullptr )
+			{
+				throw std::runtime_error( fmt::format( "Failed to map GMOD snapshot '{}'", path.string() ) );
+			}
+
+			return { static_cast<const std::byte*>( view ), static_cast<size_t>( fileSize.QuadPart ) };
+#else
+			int fd = ::open( path.c_str(), O_RDONLY | O_CLOEXEC );
+			if ( fd < 0 )
+			{
+				throw std::runtime_error( fmt::format( "Failed to open GMOD snapshot '{}'", path.string() ) );
+			}
+
+			struct stat fileStat{};
+			if ( ::fstat( fd, &fileStat ) != 0 || fileStat.st_size <= 0 )
+			{
+				::close( fd );
+				throw std::runtime_error( fmt::format( "Failed to read size of GMOD snapshot '{}'", path.string() ) );
+			}
+
+			const auto size = static_cast<size_t>( fileStat.st_size );
+
+			/* Read-only mapping; it only lives as long as the GmodSnapshot view */
+			void* view = ::mmap( nullptr, size, PROT_READ, MAP_SHARED, fd, 0 );
+			::close( fd );
+			if ( view == MAP_FAILED )
+			{
+				throw std::runtime_error( fmt::format( "Failed to map GMOD snapshot '{}'", path.string() ) );
+			}
+
+			return { static_cast<const std::byte*>( view ), size };
+#endif
+		}
+
+		void unmapFile( const std::byte* data, [[maybe_unused]] size_t size ) noexcept
+		{
+#if defined( _WIN32 )
+			::UnmapViewOfFile( data );
+#else
+			::munmap( const_cast<std::byte*>( data ), size );
+#endif
+		}
+	}
+
+	//=====================================================================
+	// GmodSnapshot class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction / destruction
+	//----------------------------------------------
+
+	GmodSnapshot::GmodSnapshot( const std::byte* data, size_t size, GmodSnapshotValidation validation )
+		: m_data{ data },
+		  m_size{ size },
+		  m_header{ reinterpret_cast<const internal::GmodSnapshotHeader*>( data ) }
+	{
+		try
+		{
+			validate( validation );
+		}
+		catch ( ... )
+		{
+			unmap();
+			throw;
+		}
+	}
+
+	GmodSnapshot::GmodSnapshot( GmodSnapshot&& other ) noexcept
+		: m_data{ std::exchange( other.m_data, nullptr ) },
+		  m_size{ std::exchange( other.m_size, 0 ) },
+		  m_header{ std::exchange( other.m_header, nullptr ) }
+	{
+	}
+
+	GmodSnapshot::~GmodSnapshot()
+	{
+		unmap();
+	}
+
+	//----------------------------------------------
+	// Assignment operators
+	//----------------------------------------------
+
+	GmodSnapshot& GmodSnapshot::operator=( GmodSnapshot&& other ) noexcept
+	{
+		if ( this == &other )
+		{
+			return *this;
+		}
+
+		unmap();
+
+		m_data = std::exchange( other.m_data, nullptr );
+		m_size = std::exchange( other.m_size, 0 );
+		m_header = std::exchange( other.m_header, nullptr );
+
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Static factory methods
+	//----------------------------------------------
+
+	GmodSnapshot GmodSnapshot::open( const std::filesystem::path& path, GmodSnapshotValidation validation )
+	{
+		auto [data, size] = mapFile( path );
+
+		if ( size < sizeof( internal::GmodSnapshotHeader ) )
+		{
+			unmapFile( data, size );
+			throw std::runtime_error( fmt::format( "GMOD snapshot '{}' is truncated ({} bytes)", path.string(), size ) );
+		}
+
+		return GmodSnapshot{ data, size, validation };
+	}
+
+	bool GmodSnapshot::tryOpen( const std::filesystem::path& path, std::optional<GmodSnapshot>& snapshot,
+		GmodSnapshotValidation validation ) noexcept
+	{
+		snapshot.reset();
+
+		try
+		{
+			snapshot.emplace( open( path, validation ) );
+
+			return true;
+		}
+		catch ( [[maybe_unused]] const std::exception& ex )
+		{
+			SPDLOG_WARN( "GmodSnapshot::tryOpen: {}", ex.what() );
+
+			return false;
+		}
+	}
+
+	void GmodSnapshot::write( const Gmod& gmod, const std::filesystem::path& path, uint32_t resourceChecksum )
+	{
+		const auto& nodeMap = gmod.m_nodeMap;
+		const auto& seeds = nodeMap.seeds();
+		const size_t tableSize = nodeMap.size();
+
+		if ( tableSize == 0 )
+		{
+			throw std::runtime_error( "Cannot write a snapshot of an empty GMOD" );
+		}
+
+		//----------------------------
+		// Node order and indices
+		//----------------------------
+
+		std::vector<const GmodNode*> orderedNodes;
+		std::vector<uint32_t> nodeSlots;
+		std::vector<uint32_t> slots( tableSize, internal::GMOD_SNAPSHOT_NPOS );
+		std::unordered_map<const GmodNode*, uint32_t> indexByNode;
+
+		orderedNodes.reserve( tableSize / 2 );
+		nodeSlots.reserve( tableSize / 2 );
+		indexByNode.reserve( tableSize / 2 );
+
+		/* Iteration order is ascending table slot order */
+		for ( auto it = nodeMap.begin(); it != nodeMap.end(); ++it )
+		{
+			const auto index = static_cast<uint32_t>( orderedNodes.size() );
+			slots[it.index()] = index;
+			nodeSlots.push_back( static_cast<uint32_t>( it.index() ) );
+			orderedNodes.push_back( &it->second );
+			indexByNode.emplace( &it->second, index );
+		}
+
+		//----------------------------
+		// Strings, edges, assignments
+		//----------------------------
+
+		std::string strings;
+		std::unordered_map<std::string_view, uint32_t> stringOffsets;
+
+		auto addString = [&strings, &stringOffsets]( std::string_view value ) -> internal::GmodSnapshotString {
+			auto it = stringOffsets.find( value );
+			if ( it == stringOffsets.end() )
+			{
+				it = stringOffsets.emplace( value, static_cast<uint32_t>( strings.size() ) ).first;
+				strings.append( value );
+			}
+
+			return { it->second, static_cast<uint32_t>( value.size() ) };
+		};
+
+		auto addOptionalString = [&addString]( const std::optional<std::string>& value ) -> internal::GmodSnapshotString {
+			if ( !value.has_value() )
+			{
+				return { internal::GMOD_SNAPSHOT_NPOS, 0 };
+			}
+
+			return addString( *value );
+		};
+
+		auto indexOf = [&indexByNode]( const GmodNode* node ) -> uint32_t {
+			auto it = indexByNode.find( node );
+			if ( it == indexByNode.end() )
+			{
+				throw std::runtime_error( fmt::format( "GMOD relation references node '{}' outside of the node map", node->code() ) );
+			}
+
+			return it->second;
+		};
+
+		std::vector<internal::GmodSnapshotNode> records;
+		std::vector<uint32_t> edges;
+		std::vector<internal::GmodSnapshotAssignment> assignments;
+
+		records.reserve( orderedNodes.size() );
+
+		for ( size_t i = 0; i < orderedNodes.size(); ++i )
+		{
+			const GmodNode& node = *orderedNodes[i];
+			const GmodNodeMetadata& metadata = node.metadata();
+
+			internal::GmodSnapshotNode record{};
+			record.slot = nodeSlots[i];
+			record.code = addString( node.code() );
+			record.category = addString( metadata.category() );
+			record.type = addString( metadata.type() );
+			record.name = addString( metadata.name() );
+			record.commonName = addOptionalString( metadata.commonName() );
+			record.definition = addOptionalString( metadata.definition() );
+			record.commonDefinition = addOptionalString( metadata.commonDefinition() );
+
+			const auto& installSubstructure = metadata.installSubstructure();
+			record.installSubstructure = installSubstructure.has_value() ? ( *installSubstructure ? 2 : 1 ) : 0;
+
+			record.childrenOffset = static_cast<uint32_t>( edges.size() );
+			record.childrenCount = static_cast<uint32_t>( node.children().size() );
+			for ( const GmodNode* child : node.children() )
+			{
+				edges.push_back( indexOf( child ) );
+			}
+
+			record.parentsOffset = static_cast<uint32_t>( edges.size() );
+			record.parentsCount = static_cast<uint32_t>( node.parents().size() );
+			for ( const GmodNode* parent : node.parents() )
+			{
+				edges.push_back( indexOf( parent ) );
+			}
+
+			/* Sorted so that identical GMODs always produce byte-identical snapshots */
+			std::vector<std::pair<std::string_view, std::string_view>> names(
+				metadata.normalAssignmentNames().begin(), metadata.normalAssignmentNames().end() );
+			std::sort( names.begin(), names.end() );
+
+			record.assignmentsOffset = static_cast<uint32_t>( assignments.size() );
+			record.assignmentsCount = static_cast<uint32_t>( names.size() );
+			for ( const auto& [key, value] : names )
+			{
+				assignments.push_back( { addString( key ), addString( value ) } );
+			}
+
+			records.push_back( record );
+		}
+
+		//----------------------------
+		// Layout
+		//----------------------------
+
+		internal::GmodSnapshotHeader header{};
+		header.magic = internal::GMOD_SNAPSHOT_MAGIC;
+		header.formatVersion = FORMAT_VERSION;
+		header.visVersion = static_cast<uint32_t>( gmod.visVersion() );
+		header.nodeCount = static_cast<uint32_t>( records.size() );
+		header.tableSize = static_cast<uint32_t>( tableSize );
+		header.edgeCount = static_cast<uint32_t>( edges.size() );
+		header.assignmentCount = static_cast<uint32_t>( assignments.size() );
+		header.nodesOffset = alignUp( sizeof( internal::GmodSnapshotHeader ) );
+		header.seedsOffset = alignUp( header.nodesOffset + records.size() * sizeof( internal::GmodSnapshotNode ) );
+		header.slotsOffset = alignUp( header.seedsOffset + tableSize * sizeof( int32_t ) );
+		header.edgesOffset = alignUp( header.slotsOffset + tableSize * sizeof( uint32_t ) );
+		header.assignmentsOffset = alignUp( header.edgesOffset + edges.size() * sizeof( uint32_t ) );
+		header.stringsOffset = alignUp( header.assignmentsOffset + assignments.size() * sizeof( internal::GmodSnapshotAssignment ) );
+		header.stringsSize = strings.size();
+		header.fileSize = header.stringsOffset + header.stringsSize;
+
+		std::vector<std::byte> buffer( header.fileSize, std::byte{ 0 } );
+
+		std::vector<int32_t> seedValues( seeds.begin(), seeds.end() );
+		std::memcpy( buffer.data() + header.nodesOffset, records.data(), records.size() * sizeof( internal::GmodSnapshotNode ) );
+		std::memcpy( buffer.data() + header.seedsOffset, seedValues.data(), seedValues.size() * sizeof( int32_t ) );
+		std::memcpy( buffer.data() + header.slotsOffset, slots.data(), slots.size() * sizeof( uint32_t ) );
+		std::memcpy( buffer.data() + header.edgesOffset, edges.data(), edges.size() * sizeof( uint32_t ) );
+		std::memcpy( buffer.data() + header.assignmentsOffset, assignments.data(), assignments.size() * sizeof( internal::GmodSnapshotAssignment ) );
+		std::memcpy( buffer.data() + header.stringsOffset, strings.data(), strings.size() );
+
+		header.checksum = checksum( buffer.data() + sizeof( header ), buffer.size() - sizeof( header ) );
+		header.sourceChecksum = resourceChecksum;
+		std::memcpy( buffer.data(), &header, sizeof( header ) );
+
+		//----------------------------
+		// Output
+		//----------------------------
+
+		/* Write to a temporary file first so that processes mapping the previous snapshot never see a partial file */
+		auto tempPath = path;
+		tempPath += ".tmp";
+
+		{
+			std::ofstream file( tempPath, std::ios::binary | std::ios::trunc );
+			if ( !file.is_open() )
+			{
+				throw std::runtime_error( fmt::format( "Failed to create GMOD snapshot '{}'", tempPath.string() ) );
+			}
+
+			file.write( reinterpret_cast<const char*>( buffer.data() ), static_cast<std::streamsize>( buffer.size() ) );
+			if ( !file.good() )
+			{
+				throw std::runtime_error( fmt::format( "Failed to write GMOD snapshot '{}'", tempPath.string() ) );
+			}
+		}
+
+		std::filesystem::rename( tempPath, path );
+	}
+
+	uint32_t GmodSnapshot::fileChecksum( const std::filesystem::path& path )
+	{
+		std::ifstream file( path, std::ios::binary );
+		if ( !file.is_open() )
+		{
+			throw std::runtime_error( fmt::format( "Failed to open '{}'", path.string() ) );
+		}
+
+		const std::vector<char> content{ std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() };
+		if ( file.bad() )
+		{
+			throw std::runtime_error( fmt::format( "Failed to read '{}'", path.string() ) );
+		}
+
+		return checksum( reinterpret_cast<const std::byte*>( content.data() ), content.size() );
+	}
+
+	std::string GmodSnapshot::fileName( VisVersion visVersion )
+	{
+		return fmt::format( "gmod-{}.snapshot", VisVersionExtensions::toVersionString( visVersion ) );
+	}
+
+	std::string GmodSnapshot::sourceFileName( VisVersion visVersion )
+	{
+		return fmt::format( "gmod-{}.json.gz", VisVersionExtensions::toVersionString( visVersion ) );
+	}
+
+	//----------------------------------------------
+	// Node query methods
+	//----------------------------------------------
+
+	bool GmodSnapshot::tryFindNode( std::string_view code, uint32_t& index ) const noexcept
+	{
+		index = internal::GMOD_SNAPSHOT_NPOS;
+
+		if ( code.empty() || m_header == nullptr ) [[unlikely]]
+		{
+			return false;
+		}
+
+		const auto seedTable = seeds();
+		const size_t size = seedTable.size();
+		const uint32_t hashValue = ChdDictionary<GmodNode>::hash( code );
+		const int32_t seed = seedTable[hashValue & ( size - 1 )];
+
+		const size_t slot = seed < 0
+								? static_cast<size_t>( -seed - 1 )
+								: internal::Hashing::seed( static_cast<uint32_t>( seed ), hashValue, size );
+
+		const uint32_t candidate = slots()[slot];
+		if ( candidate == internal::GMOD_SNAPSHOT_NPOS )
+		{
+			return false;
+		}
+
+		if ( string( nodes()[candidate].code ) != code )
+		{
+			return false;
+		}
+
+		index = candidate;
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Private construction
+	//----------------------------------------------
+
+	void GmodSnapshot::validate( GmodSnapshotValidation validation ) const
+	{
+		if constexpr ( std::endian::native != std::endian::little )
+		{
+			throw std::runtime_error( "GMOD snapshots are only supported on little-endian hosts" );
+		}
+
+		const auto& header = *m_header;
+
+		if ( header.magic != internal::GMOD_SNAPSHOT_MAGIC )
+		{
+			throw std::runtime_error( "Not a GMOD snapshot (bad magic)" );
+		}
+
+		if ( header.formatVersion != FORMAT_VERSION )
+		{
+			throw std::runtime_error( fmt::format(
+				"Unsupported GMOD snapshot format version {} (expected {})", header.formatVersion, FORMAT_VERSION ) );
+		}
+
+		if ( header.fileSize != m_size )
+		{
+			throw std::runtime_error( fmt::format(
+				"GMOD snapshot size mismatch (header: {} bytes, file: {} bytes)", header.fileSize, m_size ) );
+		}
+
+		if ( !VisVersionExtensions::isValid( static_cast<VisVersion>( header.visVersion ) ) )
+		{
+			throw std::runtime_error( fmt::format( "GMOD snapshot has invalid VIS version {}", header.visVersion ) );
+		}
+
+		if ( header.nodeCount == 0 || header.tableSize < header.nodeCount || ( header.tableSize & ( header.tableSize - 1 ) ) != 0 )
+		{
+			throw std::runtime_error( fmt::format(
+				"GMOD snapshot has invalid table dimensions (nodes: {}, table size: {})", header.nodeCount, header.tableSize ) );
+		}
+
+		auto checkSection = [this]( std::string_view name, uint64_t offset, uint64_t count, uint64_t elementSize, uint64_t alignment ) {
+			if ( offset < sizeof( internal::GmodSnapshotHeader ) || offset % alignment != 0 ||
+				 offset > m_size || count > ( m_size - offset ) / elementSize )
+			{
+				throw std::runtime_error( fmt::format( "GMOD snapshot section '{}' is out of bounds", name ) );
+			}
+		};
+
+		checkSection( "nodes", header.nodesOffset, header.nodeCount, sizeof( internal::GmodSnapshotNode ), alignof( internal::GmodSnapshotNode ) );
+		checkSection( "seeds", header.seedsOffset, header.tableSize, sizeof( int32_t ), alignof( int32_t ) );
+		checkSection( "slots", header.slotsOffset, header.tableSize, sizeof( uint32_t ), alignof( uint32_t ) );
+		checkSection( "edges", header.edgesOffset, header.edgeCount, sizeof( uint32_t ), alignof( uint32_t ) );
+		checkSection( "assignments", header.assignmentsOffset, header.assignmentCount, sizeof( internal::GmodSnapshotAssignment ), alignof( internal::GmodSnapshotAssignment ) );
+		checkSection( "strings", header.stringsOffset, header.stringsSize, 1, 1 );
+
+		/* Reads every page of the file; the checks below only touch the records */
+		if ( validation == GmodSnapshotValidation::Full &&
+			 checksum( m_data + sizeof( internal::GmodSnapshotHeader ), m_size - sizeof( internal::GmodSnapshotHeader ) ) != header.checksum )
+		{
+			throw std::runtime_error( "GMOD snapshot checksum mismatch" );
+		}
+
+		auto checkString = [&header]( const internal::GmodSnapshotString& ref ) {
+			if ( ref.offset != internal::GMOD_SNAPSHOT_NPOS && static_cast<uint64_t>( ref.offset ) + ref.length > header.stringsSize )
+			{
+				throw std::runtime_error( "GMOD snapshot string reference is out of bounds" );
+			}
+		};
+
+		auto checkRange = [&header]( uint32_t offset, uint32_t count, uint64_t limit ) {
+			if ( static_cast<uint64_t>( offset ) + count > limit )
+			{
+				throw std::runtime_error( "GMOD snapshot record range is out of bounds" );
+			}
+		};
+
+		const auto slotTable = slots();
+		for ( const uint32_t index : slotTable )
+		{
+			if ( index != internal::GMOD_SNAPSHOT_NPOS && index >= header.nodeCount )
+			{
+				throw std::runtime_error( "GMOD snapshot slot table references an unknown node" );
+			}
+		}
+
+		for ( const int32_t seed : seeds() )
+		{
+			if ( seed < 0 && static_cast<uint64_t>( -static_cast<int64_t>( seed ) - 1 ) >= header.tableSize )
+			{
+				throw std::runtime_error( "GMOD snapshot seed table references a slot outside the table" );
+			}
+		}
+
+		const auto nodeRecords = nodes();
+		const auto edgeValues = std::span<const uint32_t>{ section<uint32_t>( header.edgesOffset ), header.edgeCount };
+		for ( size_t i = 0; i < nodeRecords.size(); ++i )
+		{
+			const auto& node = nodeRecords[i];
+
+			if ( node.slot >= header.tableSize || slotTable[node.slot] != i || node.code.offset == internal::GMOD_SNAPSHOT_NPOS )
+			{
+				throw std::runtime_error( fmt::format( "GMOD snapshot node {} has an inconsistent table slot", i ) );
+			}
+
+			checkString( node.code );
+			checkString( node.category );
+			checkString( node.type );
+			checkString( node.name );
+			checkString( node.commonName );
+			checkString( node.definition );
+			checkString( node.commonDefinition );
+
+			checkRange( node.childrenOffset, node.childrenCount, header.edgeCount );
+			checkRange( node.parentsOffset, node.parentsCount, header.edgeCount );
+			checkRange( node.assignmentsOffset, node.assignmentsCount, header.assignmentCount );
+
+			for ( const auto& assignment : assignments( node ) )
+			{
+				checkString( assignment.key );
+				checkString( assignment.value );
+			}
+		}
+
+		for ( const uint32_t edge : edgeValues )
+		{
+			if ( edge >= header.nodeCount )
+			{
+				throw std::runtime_error( "GMOD snapshot edge references an unknown node" );
+			}
+		}
+	}
+
+	void GmodSnapshot::unmap() noexcept
+	{
+		if ( m_data != nullptr )
+		{
+			unmapFile( m_data, m_size );
+		}
+
+		m_data = nullptr;
+		m_size = 0;
+		m_header = nullptr;
+	}
+}
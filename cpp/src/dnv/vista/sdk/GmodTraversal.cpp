@@ -2,17 +2,10 @@
 
 #include "dnv/vista/sdk/GmodTraversal.h"
 
+#include "dnv/vista/sdk/WorkStealing.h"
+
 namespace dnv::vista::sdk
 {
-	//=====================================================================
-	// Constants
-	//=====================================================================
-
-	namespace
-	{
-		static constexpr std::string_view NODE_CATEGORY_ASSET_FUNCTION = "ASSET FUNCTION";
-	}
-
 	//=====================================================================
 	// Traversal algorithms
 	//=====================================================================
@@ -25,74 +18,269 @@ namespace dnv::vista::sdk
 			// GmodTraversal::Parents class
 			//----------------------------------------------
 
-			Parents::Parents()
+			Parents::Parents( size_t nodeCount )
+				: m_occurrences( nodeCount, 0 )
 			{
 				m_parents.reserve( 64 );
-				m_occurrences.reserve( 4 );
+				m_indices.reserve( 64 );
+				m_nextChildren.reserve( 64 );
 			}
 
-			//----------------------------
-			// Stack operations
-			//----------------------------
+			//----------------------------------------------
+			// GmodTraversal::Cursor class
+			//----------------------------------------------
 
-			void Parents::push( const GmodNode* parent )
+			Cursor::Cursor( const GmodNode& rootNode, size_t maxTraversalOccurrence )
+				: m_graph{ rootNode.graph() },
+				  m_parents{ m_graph != nullptr ? m_graph->nodes.size() : 0 },
+				  m_node{ &rootNode },
+				  m_index{ m_graph != nullptr ? rootNode.graphIndex() : 0 },
+				  m_maxTraversalOccurrence{ maxTraversalOccurrence },
+				  m_atStart{ true },
+				  m_pending{ false }
 			{
-				m_parents.push_back( parent );
+			}
+
+			//----------------------------------------------
+			// Parallel traversal
+			//----------------------------------------------
 
-				std::string_view key = parent->code();
-				if ( auto it = m_occurrences.find( key ); it != m_occurrences.end() )
+			void SubtreeTasks::add( const std::vector<const GmodNode*>& taskParents, uint32_t node )
+			{
+				for ( const GmodNode* parent : taskParents )
 				{
-					++it->second;
+					parents.push_back( parent->graphIndex() );
 				}
-				else
+				parentOffsets.push_back( static_cast<uint32_t>( parents.size() ) );
+				nodes.push_back( node );
+			}
+
+			size_t parallelWorkerCount( const ParallelTraversalOptions& options, size_t taskCount )
+			{
+				const size_t threadCount = options.threadCount != 0 ? options.threadCount : std::max<size_t>( 1, std::thread::hardware_concurrency() );
+
+				return std::max<size_t>( 1, std::min( threadCount, taskCount ) );
+			}
+
+			void runSubtreeTasks(
+				const internal::GmodGraph& graph,
+				const SubtreeTasks& tasks,
+				size_t workerCount,
+				const ParallelTraversalOptions::Executor& executor,
+				std::atomic<bool>& stopped,
+				const std::function<void( size_t worker, Parents& parents, uint32_t node )>& runTask )
+			{
+				internal::ChunkRanges ranges( tasks.nodes.size(), workerCount );
+
+				std::mutex errorMutex;
+				std::exception_ptr error;
+
+				const std::function<void( size_t )> task = [&]( size_t worker ) {
+					Parents parents( graph.nodes.size() );
+
+					size_t chunk;
+					while ( !stopped.load( std::memory_order_acquire ) && ranges.next( worker, chunk ) )
+					{
+						for ( uint32_t i = tasks.parentOffsets[chunk]; i < tasks.parentOffsets[chunk + 1]; ++i )
+						{
+							const uint32_t index = tasks.parents[i];
+							parents.push( graph.nodes[index], index );
+						}
+
+						try
+						{
+							runTask( worker, parents, tasks.nodes[chunk] );
+						}
+						catch ( ... )
+						{
+							std::lock_guard lock( errorMutex );
+							if ( !error )
+							{
+								error = std::current_exception();
+							}
+							stopped.store( true, std::memory_order_release );
+
+							return;
+						}
+
+						while ( !parents.empty() )
+						{
+							parents.pop();
+						}
+					}
+				};
+
+				internal::runWorkers( workerCount, executor, task );
+
+				if ( error )
 				{
-					m_occurrences[key] = 1;
+					std::rethrow_exception( error );
 				}
 			}
 
-			void Parents::pop()
+			//----------------------------------------------
+			// Subtree statistics
+			//----------------------------------------------
+
+			/**
+			 * @brief Computes the sizes of the traversal from every node of a graph.
+			 * @details Strongly connected components are found with Tarjan's algorithm, which completes
+			 *          them in reverse topological order, so the nodes a component reaches are sized
+			 *          before it. A node outside a cycle never meets itself or its descendants among its
+			 *          parents, so its traversal does not depend on them and is sized from its children.
+			 *          Each node of a cycle is traversed, within its component only.
+			 */
+			internal::SubtreeStatistics::Table buildSubtreeStatistics( const internal::GmodGraph& graph, size_t maxTraversalOccurrence )
 			{
-				if ( m_parents.empty() )
+				constexpr uint32_t UNVISITED = std::numeric_limits<uint32_t>::max();
+
+				const size_t nodeCount = graph.nodes.size();
+				internal::SubtreeStatistics::Table table;
+				table.pathCounts.assign( nodeCount, 0 );
+				table.maxDepths.assign( nodeCount, 0 );
+
+				auto skipped = [&graph]( uint32_t index ) { return ( graph.flags[index] & internal::GmodNodeFlags::SKIP_SUBSTRUCTURE ) != 0; };
+
+				if ( maxTraversalOccurrence == 0 )
 				{
-					return;
+					/* The start node is visited, but none is entered */
+					for ( uint32_t index = 0; index < nodeCount; ++index )
+					{
+						table.pathCounts[index] = skipped( index ) ? 0 : 1;
+					}
+
+					return table;
 				}
 
-				const GmodNode* parent = m_parents.back();
-				m_parents.pop_back();
+				std::vector<uint32_t> order( nodeCount, UNVISITED );
+				std::vector<uint32_t> low( nodeCount, 0 );
+				std::vector<uint32_t> component( nodeCount, UNVISITED );
+				std::vector<uint32_t> componentStack;
+				std::vector<std::pair<uint32_t, uint32_t>> callStack;
+				std::optional<Parents> parents;
+				uint32_t counter = 0;
+				uint32_t componentCount = 0;
+
+				auto sizeAcyclic = [&]( uint32_t index ) {
+					if ( skipped( index ) )
+					{
+						return;
+					}
 
-				std::string_view key = parent->code();
-				if ( auto it = m_occurrences.find( key ); it != m_occurrences.end() )
-				{
-					if ( it->second == 1 )
+					uint64_t count = 1;
+					uint32_t depth = 0;
+					for ( const uint32_t child : graph.childrenOf( index ) )
 					{
-						m_occurrences.erase( it );
+						if ( table.pathCounts[child] != 0 )
+						{
+							count += table.pathCounts[child];
+							depth = std::max( depth, table.maxDepths[child] + 1 );
+						}
 					}
-					else
+					table.pathCounts[index] = count;
+					table.maxDepths[index] = depth;
+				};
+
+				auto sizeCyclic = [&]( uint32_t index ) {
+					if ( skipped( index ) )
 					{
-						--it->second;
+						return;
 					}
-				}
-			}
 
-			size_t Parents::occurrences( const GmodNode& node ) const noexcept
-			{
-				std::string_view key = node.code();
-				if ( auto it = m_occurrences.find( key ); it != m_occurrences.end() )
+					if ( !parents.has_value() )
+					{
+						parents.emplace( nodeCount );
+					}
+
+					uint64_t count = 0;
+					size_t depth = 0;
+					auto handler = [&]( const std::vector<const GmodNode*>& nodeParents, const GmodNode& node ) {
+						const uint32_t visited = node.graphIndex();
+						if ( component[visited] != component[index] )
+						{
+							count += table.pathCounts[visited];
+							depth = std::max( depth, nodeParents.size() + table.maxDepths[visited] );
+
+							return TraversalHandlerResult::SkipSubtree;
+						}
+
+						++count;
+						depth = std::max( depth, nodeParents.size() );
+
+						return TraversalHandlerResult::Continue;
+					};
+
+					[[maybe_unused]] const TraversalHandlerResult result = traverseIterative( graph, *parents, index, handler, maxTraversalOccurrence );
+
+					table.pathCounts[index] = count;
+					table.maxDepths[index] = static_cast<uint32_t>( depth );
+				};
+
+				for ( uint32_t start = 0; start < nodeCount; ++start )
 				{
-					return it->second;
-				}
+					if ( order[start] != UNVISITED )
+					{
+						continue;
+					}
 
-				return 0;
-			}
+					order[start] = low[start] = counter++;
+					componentStack.push_back( start );
+					callStack.emplace_back( start, 0 );
 
-			const GmodNode* Parents::lastOrDefault() const noexcept
-			{
-				return m_parents.empty() ? nullptr : m_parents.back();
-			}
+					while ( !callStack.empty() )
+					{
+						const uint32_t index = callStack.back().first;
+						const std::span<const uint32_t> children = graph.childrenOf( index );
+						if ( callStack.back().second < children.size() )
+						{
+							const uint32_t child = children[callStack.back().second++];
+							if ( order[child] == UNVISITED )
+							{
+								order[child] = low[child] = counter++;
+								componentStack.push_back( child );
+								callStack.emplace_back( child, 0 );
+							}
+							else if ( component[child] == UNVISITED )
+							{
+								low[index] = std::min( low[index], order[child] );
+							}
 
-			const std::vector<const GmodNode*>& Parents::asList() const noexcept
-			{
-				return m_parents;
+							continue;
+						}
+
+						callStack.pop_back();
+						if ( !callStack.empty() )
+						{
+							const uint32_t parent = callStack.back().first;
+							low[parent] = std::min( low[parent], low[index] );
+						}
+
+						if ( low[index] != order[index] )
+						{
+							continue;
+						}
+
+						/* `index` roots a component: its members are on top of the stack */
+						const size_t first = static_cast<size_t>(
+							std::find( componentStack.rbegin(), componentStack.rend(), index ).base() - componentStack.begin() ) - 1;
+						const std::span<const uint32_t> members( componentStack.data() + first, componentStack.size() - first );
+						for ( const uint32_t member : members )
+						{
+							component[member] = componentCount;
+						}
+						++componentCount;
+
+						const bool cyclic = members.size() > 1 || std::find( children.begin(), children.end(), index ) != children.end();
+						for ( const uint32_t member : members )
+						{
+							cyclic ? sizeCyclic( member ) : sizeAcyclic( member );
+						}
+
+						componentStack.resize( first );
+					}
+				}
+
+				return table;
 			}
 
 			//----------------------------------------------
@@ -118,6 +306,224 @@ namespace dnv::vista::sdk
 				PathExistsContext& operator=( const PathExistsContext& ) = delete;
 				PathExistsContext& operator=( PathExistsContext&& ) noexcept = delete;
 			};
+
+			//----------------------------------------------
+			// Path analysis
+			//----------------------------------------------
+
+			/**
+			 * @brief Searches a path by traversing the GMOD from a start node.
+			 * @details Used when the search cannot be answered from the `internal::PathExistsIndex`.
+			 */
+			bool pathExistsBetweenTraversal(
+				const GmodNode& start,
+				const std::vector<const GmodNode*>& fromPath,
+				const GmodNode& to,
+				std::vector<const GmodNode*>& remainingParents )
+			{
+				PathExistsContext context( to, fromPath );
+
+				TraverseHandlerWithState<PathExistsContext> handler =
+					[]( PathExistsContext& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+					if ( node.code() != state.to.code() )
+						return TraversalHandlerResult::Continue;
+
+					std::vector<const GmodNode*> actualParents;
+					actualParents.reserve( parents.size() + 10 );
+
+					if ( !parents.empty() && !parents[0]->isRoot() )
+					{
+						std::vector<const GmodNode*> pathToRoot;
+						const GmodNode* current = parents[0];
+
+						while ( current && !current->isRoot() )
+						{
+							if ( current->parents().size() != 1 )
+							{
+								throw std::runtime_error( "Invalid state - expected one parent" );
+							}
+
+							current = current->parents()[0];
+							if ( current )
+							{
+								pathToRoot.push_back( current );
+							}
+						}
+
+						std::reverse( pathToRoot.begin(), pathToRoot.end() );
+						actualParents.insert( actualParents.end(), pathToRoot.begin(), pathToRoot.end() );
+						actualParents.insert( actualParents.end(), parents.begin(), parents.end() );
+					}
+					else
+					{
+						actualParents = parents;
+					}
+
+					if ( actualParents.size() < state.fromPath.size() )
+					{
+						return TraversalHandlerResult::Continue;
+					}
+
+					bool match = true;
+					for ( size_t i = 0; i < state.fromPath.size(); ++i )
+					{
+						if ( actualParents[i]->code() != state.fromPath[i]->code() )
+						{
+							match = false;
+							break;
+						}
+					}
+
+					if ( match )
+					{
+						state.remainingParents.clear();
+						for ( const auto* p : actualParents )
+						{
+							bool found = false;
+							for ( const auto* fp : state.fromPath )
+							{
+								if ( fp->code() == p->code() )
+								{
+									found = true;
+									break;
+								}
+							}
+							if ( !found )
+							{
+								state.remainingParents.push_back( p );
+							}
+						}
+						return TraversalHandlerResult::Stop;
+					}
+
+					return TraversalHandlerResult::Continue;
+				};
+
+				bool reachedEnd = traverse( context, start, handler );
+
+				remainingParents = std::move( context.remainingParents );
+
+				return !reachedEnd;
+			}
+
+			/** @brief State of the traversal that fills an `internal::PathExistsIndex::Entry`. */
+			struct PathExistsIndexState
+			{
+				const internal::GmodGraph& graph;
+				uint32_t target;
+				internal::PathExistsIndex::Entry entry;
+			};
+
+			/**
+			 * @brief Collects the parent chains under which a traversal from a start node meets a target node.
+			 * @return The entry, or `std::nullopt` if an ancestor of the start node has several parents.
+			 */
+			std::optional<internal::PathExistsIndex::Entry> buildPathExistsEntry(
+				const internal::GmodGraph& graph, uint32_t start, uint32_t target )
+			{
+				PathExistsIndexState state{ graph, target, {} };
+
+				const GmodNode* current = graph.nodes[start];
+				while ( current != nullptr && !current->isRoot() )
+				{
+					if ( current->parents().size() != 1 )
+					{
+						return std::nullopt;
+					}
+
+					current = current->parents()[0];
+					if ( current != nullptr )
+					{
+						state.entry.ancestors.push_back( current );
+					}
+				}
+				std::reverse( state.entry.ancestors.begin(), state.entry.ancestors.end() );
+
+				/* Subtrees that cannot reach the target are skipped, the traversal order is otherwise unchanged */
+				TraverseHandlerWithState<PathExistsIndexState> handler =
+					[]( PathExistsIndexState& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+					const uint32_t index = node.graphIndex();
+					if ( index != state.target )
+					{
+						return state.graph.mayReach( index, state.target ) ? TraversalHandlerResult::Continue : TraversalHandlerResult::SkipSubtree;
+					}
+
+					internal::PathExistsIndex::Entry& entry = state.entry;
+					if ( entry.chainCount() == internal::PathExistsIndex::MAX_CHAINS )
+					{
+						entry.truncated = true;
+
+						return TraversalHandlerResult::Stop;
+					}
+
+					entry.chainNodes.insert( entry.chainNodes.end(), parents.begin(), parents.end() );
+					entry.chainOffsets.push_back( static_cast<uint32_t>( entry.chainNodes.size() ) );
+
+					return TraversalHandlerResult::Continue;
+				};
+
+				[[maybe_unused]] bool completed = traverse( state, *graph.nodes[start], handler );
+
+				return std::move( state.entry );
+			}
+
+			/**
+			 * @brief Finds the first chain of an entry that extends a path.
+			 * @return True if a chain was found; `remainingParents` then holds its parents that are not in `fromPath`.
+			 */
+			bool matchPathExistsEntry(
+				const internal::PathExistsIndex::Entry& entry,
+				const std::vector<const GmodNode*>& fromPath,
+				std::vector<const GmodNode*>& remainingParents )
+			{
+				for ( size_t c = 0; c < entry.chainCount(); ++c )
+				{
+					const std::span<const GmodNode* const> chain = entry.chain( c );
+
+					/* Chains from a start node below the root continue the ancestors of the start node */
+					const std::span<const GmodNode* const> ancestors =
+						!chain.empty() && !chain[0]->isRoot() ? std::span<const GmodNode* const>( entry.ancestors ) : std::span<const GmodNode* const>{};
+
+					const size_t length = ancestors.size() + chain.size();
+					if ( length < fromPath.size() )
+					{
+						continue;
+					}
+
+					auto parentAt = [&]( size_t i ) { return i < ancestors.size() ? ancestors[i] : chain[i - ancestors.size()]; };
+
+					bool match = true;
+					for ( size_t i = 0; i < fromPath.size(); ++i )
+					{
+						if ( parentAt( i )->codeId() != fromPath[i]->codeId() )
+						{
+							match = false;
+							break;
+						}
+					}
+
+					if ( !match )
+					{
+						continue;
+					}
+
+					remainingParents.clear();
+					for ( size_t i = 0; i < length; ++i )
+					{
+						const GmodNode* parent = parentAt( i );
+						const bool inFromPath = std::any_of( fromPath.begin(), fromPath.end(),
+							[parent]( const GmodNode* fp ) { return fp->codeId() == parent->codeId(); } );
+						if ( !inFromPath )
+						{
+							remainingParents.push_back( parent );
+						}
+					}
+
+					return true;
+				}
+
+				return false;
+			}
 		}
 
 		//=====================================================================
@@ -126,22 +532,84 @@ namespace dnv::vista::sdk
 
 		bool traverse( const Gmod& gmodInstance, TraverseHandler handler, const TraversalOptions& options )
 		{
-			TraverseHandler capturedHandler = handler;
-			TraverseHandlerWithState<TraverseHandler> wrapperHandler =
-				[]( TraverseHandler& h, const std::vector<const GmodNode*>& parents, const GmodNode& node )
-				-> TraversalHandlerResult { return h( parents, node ); };
-
-			return traverse( capturedHandler, gmodInstance, wrapperHandler, options );
+			return traverse( gmodInstance.rootNode(), handler, options );
 		}
 
 		bool traverse( const GmodNode& rootNode, TraverseHandler handler, const TraversalOptions& options )
 		{
-			TraverseHandler capturedHandler = handler;
-			TraverseHandlerWithState<TraverseHandler> wrapperHandler =
-				[]( TraverseHandler& h, const std::vector<const GmodNode*>& parents, const GmodNode& node )
-				-> TraversalHandlerResult { return h( parents, node ); };
+			return traverse(
+				rootNode,
+				[handler]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) { return handler( parents, node ); },
+				options );
+		}
+
+		//----------------------------------------------
+		// Lazy enumeration
+		//----------------------------------------------
+
+		PathView::Iterator::Iterator( detail::Cursor* cursor ) noexcept
+			: m_cursor{ cursor }
+		{
+		}
+
+		PathView::PathView( const GmodNode& rootNode, const TraversalOptions& options )
+			: m_cursor{ std::make_unique<detail::Cursor>( rootNode, options.maxTraversalOccurrence ) }
+		{
+		}
+
+		PathView::Iterator PathView::begin()
+		{
+			if ( m_cursor == nullptr || !m_cursor->next() )
+			{
+				return Iterator{};
+			}
+
+			return Iterator{ m_cursor.get() };
+		}
+
+		PathView paths( const GmodNode& rootNode, const TraversalOptions& options )
+		{
+			return PathView( rootNode, options );
+		}
 
-			return traverse( capturedHandler, rootNode, wrapperHandler, options );
+		PathView paths( const Gmod& gmodInstance, const TraversalOptions& options )
+		{
+			return PathView( gmodInstance.rootNode(), options );
+		}
+
+		//----------------------------------------------
+		// Subtree statistics
+		//----------------------------------------------
+
+		namespace
+		{
+			const internal::SubtreeStatistics::Table& subtreeStatisticsTable(
+				const Gmod& gmodInstance, const GmodNode& node, const TraversalOptions& options )
+			{
+				const internal::GmodGraph* graph = gmodInstance.rootNode().graph();
+				if ( graph == nullptr || node.graph() != graph )
+				{
+					throw std::invalid_argument( fmt::format( "GmodTraversal: node '{}' does not belong to this GMOD", node.code() ) );
+				}
+
+				internal::SubtreeStatistics& statistics = gmodInstance.subtreeStatistics();
+				if ( const internal::SubtreeStatistics::Table* table = statistics.find( options.maxTraversalOccurrence ) )
+				{
+					return *table;
+				}
+
+				return statistics.add( options.maxTraversalOccurrence, detail::buildSubtreeStatistics( *graph, options.maxTraversalOccurrence ) );
+			}
+		}
+
+		uint64_t pathCount( const Gmod& gmodInstance, const GmodNode& node, const TraversalOptions& options )
+		{
+			return subtreeStatisticsTable( gmodInstance, node, options ).pathCounts[node.graphIndex()];
+		}
+
+		size_t maxDepth( const Gmod& gmodInstance, const GmodNode& node, const TraversalOptions& options )
+		{
+			return subtreeStatisticsTable( gmodInstance, node, options ).maxDepths[node.graphIndex()];
 		}
 
 		bool pathExistsBetween(
@@ -155,99 +623,45 @@ namespace dnv::vista::sdk
 			const GmodNode* lastAssetFunction = nullptr;
 			for ( auto it = fromPath.rbegin(); it != fromPath.rend(); ++it )
 			{
-				if ( *it && ( *it )->metadata().category() == NODE_CATEGORY_ASSET_FUNCTION )
+				if ( *it && ( *it )->isAssetFunctionNode() )
 				{
 					lastAssetFunction = *it;
 					break;
 				}
 			}
 
-			detail::PathExistsContext context( to, fromPath );
-
-			TraverseHandlerWithState<detail::PathExistsContext> handler =
-				[]( detail::PathExistsContext& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
-				if ( node.code() != state.to.code() )
-					return TraversalHandlerResult::Continue;
+			const GmodNode& start = lastAssetFunction ? *lastAssetFunction : gmodInstance.rootNode();
 
-				std::vector<const GmodNode*> actualParents;
-				actualParents.reserve( parents.size() + 10 );
+			const internal::GmodGraph* graph = gmodInstance.rootNode().graph();
+			const GmodNode* target = nullptr;
+			if ( graph != nullptr && start.graph() == graph && gmodInstance.tryGetNode( to.codeId(), target ) && target->graph() == graph )
+			{
+				internal::PathExistsIndex& index = gmodInstance.pathExistsIndex();
 
-				if ( !parents.empty() && !parents[0]->isRoot() )
+				const internal::PathExistsIndex::Entry* entry = index.find( start.graphIndex(), target->graphIndex() );
+				if ( entry == nullptr )
 				{
-					std::vector<const GmodNode*> pathToRoot;
-					const GmodNode* current = parents[0];
-
-					while ( current && !current->isRoot() )
+					if ( auto built = detail::buildPathExistsEntry( *graph, start.graphIndex(), target->graphIndex() ); built.has_value() )
 					{
-						if ( current->parents().size() != 1 )
-						{
-							throw std::runtime_error( "Invalid state - expected one parent" );
-						}
-
-						current = current->parents()[0];
-						if ( current )
-						{
-							pathToRoot.push_back( current );
-						}
+						entry = &index.add( start.graphIndex(), target->graphIndex(), std::move( *built ) );
 					}
-
-					std::reverse( pathToRoot.begin(), pathToRoot.end() );
-					actualParents.insert( actualParents.end(), pathToRoot.begin(), pathToRoot.end() );
-					actualParents.insert( actualParents.end(), parents.begin(), parents.end() );
-				}
-				else
-				{
-					actualParents = parents;
-				}
-
-				if ( actualParents.size() < state.fromPath.size() )
-				{
-					return TraversalHandlerResult::Continue;
 				}
 
-				bool match = true;
-				for ( size_t i = 0; i < state.fromPath.size(); ++i )
+				if ( entry != nullptr )
 				{
-					if ( actualParents[i]->code() != state.fromPath[i]->code() )
+					if ( detail::matchPathExistsEntry( *entry, fromPath, remainingParents ) )
 					{
-						match = false;
-						break;
+						return true;
 					}
-				}
 
-				if ( match )
-				{
-					state.remainingParents.clear();
-					for ( const auto* p : actualParents )
+					if ( !entry->truncated )
 					{
-						bool found = false;
-						for ( const auto* fp : state.fromPath )
-						{
-							if ( fp->code() == p->code() )
-							{
-								found = true;
-								break;
-							}
-						}
-						if ( !found )
-						{
-							state.remainingParents.push_back( p );
-						}
+						return false;
 					}
-					return TraversalHandlerResult::Stop;
 				}
+			}
 
-				return TraversalHandlerResult::Continue;
-			};
-
-			bool reachedEnd = traverse(
-				context,
-				lastAssetFunction ? *lastAssetFunction : gmodInstance.rootNode(),
-				handler );
-
-			remainingParents = std::move( context.remainingParents );
-
-			return !reachedEnd;
+			return detail::pathExistsBetweenTraversal( start, fromPath, to, remainingParents );
 		}
 	}
 }
@@ -14,6 +14,7 @@
 #include "dnv/vista/sdk/LocalId.h"
 #include "dnv/vista/sdk/LocalIdBuilder.h"
 #include "dnv/vista/sdk/MetadataTag.h"
+#include "dnv/vista/sdk/StringInterner.h"
 #include "dnv/vista/sdk/VIS.h"
 #include "dnv/vista/sdk/VISVersion.h"
 
@@ -86,6 +87,25 @@ namespace dnv::vista::sdk
 
 		validateSourceAndTargetVersions( sourceVersion, targetVersion );
 
+		const ConversionPlan& plan = conversionPlan( sourceVersion, targetVersion );
+		if ( const ConversionPlan::Entry* entry = plan.find( sourceNode, sourceVersion ); entry != nullptr )
+		{
+			const GmodNode* targetNode = entry->target;
+			if ( targetNode == nullptr )
+			{
+				return std::nullopt;
+			}
+
+			auto resultNode = targetNode->tryWithLocation( sourceNode.location() );
+			if ( sourceNode.location().has_value() && resultNode.location() != sourceNode.location() )
+			{
+				throw std::runtime_error( "Failed to set location" );
+			}
+
+			return resultNode;
+		}
+
+		/* Nodes that are not part of the source GMOD are converted one version at a time */
 		std::optional<GmodNode> node = sourceNode;
 		VisVersion source = sourceVersion;
 
@@ -132,7 +152,37 @@ namespace dnv::vista::sdk
 										  std::string( overallTargetEndNode.code() ) );
 			}
 
-			return GmodPath( targetGmod, const_cast<GmodNode*>( rootNodeInGmodPtr ), {} );
+			return GmodPath( targetGmod, const_cast<GmodNode*>( rootNodeInGmodPtr ) );
+		}
+
+		const ConversionPlan& plan = conversionPlan( sourceVersion, targetVersion );
+		if ( std::optional<GmodPath> direct = tryConvertPathDirect( plan, sourceVersion, sourcePath ); direct.has_value() )
+		{
+			return direct;
+		}
+
+		/* Without locations, the reconstruction depends on the node codes alone */
+		std::u32string templateKey;
+		bool hasLocation = false;
+		templateKey.reserve( sourcePath.length() );
+		for ( const GmodLocatedNode& node : sourcePath.locatedNodes() )
+		{
+			hasLocation = node.hasLocation();
+			if ( hasLocation )
+			{
+				break;
+			}
+
+			templateKey.push_back( static_cast<char32_t>( node.node().codeId() ) );
+		}
+
+		if ( !hasLocation )
+		{
+			std::shared_lock lock( plan.pathTemplatesMutex );
+			if ( auto it = plan.pathTemplates.find( templateKey ); it != plan.pathTemplates.end() )
+			{
+				return GmodPath( targetGmod, it->second );
+			}
 		}
 
 		std::vector<QualifyingNodePair> qualifyingNodesVec;
@@ -153,59 +203,13 @@ namespace dnv::vista::sdk
 			qualifyingNodesVec.emplace_back( originalNodeInPath, std::move( *convertedNodeOpt ) );
 		}
 
-		static std::list<GmodNode> nodesWithLocationStorage;
-
-		if ( !qualifyingNodesVec.empty() )
-		{
-			std::vector<GmodNode*> potentialParentPtrsForInitialCheck;
-			std::vector<GmodNode> potentialParentNodesForInitialCheck;
-
-			for ( size_t i = 0; i < qualifyingNodesVec.size() - 1; ++i )
-			{
-				potentialParentNodesForInitialCheck.push_back( qualifyingNodesVec[i].targetNode() );
-			}
-
-			for ( const auto& nodeVal : potentialParentNodesForInitialCheck )
-			{
-				const GmodNode* baseNodePtr = nullptr;
-				if ( !targetGmod.tryGetNode( nodeVal.code(), baseNodePtr ) || !baseNodePtr )
-				{
-					throw std::runtime_error( "Initial check: Base node not found in targetGmod for parent list." );
-				}
-				if ( nodeVal.location().has_value() )
-				{
-					nodesWithLocationStorage.push_back( baseNodePtr->tryWithLocation( *nodeVal.location() ) );
-					potentialParentPtrsForInitialCheck.push_back( &nodesWithLocationStorage.back() );
-				}
-				else
-				{
-					potentialParentPtrsForInitialCheck.push_back( const_cast<GmodNode*>( baseNodePtr ) );
-				}
-			}
-
-			GmodNode* overallTargetEndNodeForInitialCheckPtr;
-			const GmodNode* baseOverallTargetEndNodePtr = nullptr;
-			if ( !targetGmod.tryGetNode( overallTargetEndNode.code(), baseOverallTargetEndNodePtr ) || !baseOverallTargetEndNodePtr )
-			{
-				throw std::runtime_error( "Initial check: Base node for overallTargetEndNode not found." );
-			}
-			if ( overallTargetEndNode.location().has_value() )
-			{
-				nodesWithLocationStorage.push_back( baseOverallTargetEndNodePtr->tryWithLocation( *overallTargetEndNode.location() ) );
-				overallTargetEndNodeForInitialCheckPtr = &nodesWithLocationStorage.back();
-			}
-			else
-			{
-				overallTargetEndNodeForInitialCheckPtr = const_cast<GmodNode*>( baseOverallTargetEndNodePtr );
-			}
-
-			int missingLinkAtInitial;
-			if ( GmodPath::isValid( potentialParentPtrsForInitialCheck, *overallTargetEndNodeForInitialCheckPtr, missingLinkAtInitial ) )
-			{
-				return GmodPath( targetGmod, overallTargetEndNodeForInitialCheckPtr, potentialParentPtrsForInitialCheck );
-			}
-		}
+		/* Located nodes only live for this conversion; the resulting GmodPath keeps their locations only */
+		std::deque<GmodNode> locatedNodes;
+		auto targetNodeOf = [&locatedNodes]( const GmodNode& baseNode, const std::optional<Location>& location ) -> GmodNode* {
+			return const_cast<GmodNode*>( location.has_value() ? &locatedNodes.emplace_back( baseNode.withLocation( *location ) ) : &baseNode );
+		};
 
+		/* The nodes mapped one-to-one do not form a valid path (see `tryConvertPathDirect()`): reconstruct it */
 		std::vector<GmodNode> reconstructedPath;
 
 		bool selectionChanged = false;
@@ -234,29 +238,12 @@ namespace dnv::vista::sdk
 								const GmodNode* ptr_val_node = nullptr;
 								if ( !targetGmod.tryGetNode( val_node.code(), ptr_val_node ) )
 									throw std::runtime_error( "Failed to get node for pathExistsBetween parent list" );
-								if ( val_node.location().has_value() )
-								{
-									nodesWithLocationStorage.push_back( ptr_val_node->tryWithLocation( *val_node.location() ) );
-									currentParentsPtrsForCheck.push_back( &nodesWithLocationStorage.back() );
-								}
-								else
-								{
-									currentParentsPtrsForCheck.push_back( ptr_val_node );
-								}
+								currentParentsPtrsForCheck.push_back( targetNodeOf( *ptr_val_node, val_node.location() ) );
 							}
 							const GmodNode* nodeToAddAsGmodPtr = nullptr;
 							if ( !targetGmod.tryGetNode( node.code(), nodeToAddAsGmodPtr ) )
 								throw std::runtime_error( "Failed to get node for pathExistsBetween toNode" );
-							GmodNode locatednodeForPathExists = node;
-							if ( node.location().has_value() )
-							{
-								nodesWithLocationStorage.push_back( nodeToAddAsGmodPtr->tryWithLocation( *node.location() ) );
-								locatednodeForPathExists = nodesWithLocationStorage.back();
-							}
-							else
-							{
-								locatednodeForPathExists = *nodeToAddAsGmodPtr;
-							}
+							const GmodNode& locatednodeForPathExists = *targetNodeOf( *nodeToAddAsGmodPtr, node.location() );
 
 							bool pathFound = GmodTraversal::pathExistsBetween(
 								targetGmod, currentParentsPtrsForCheck,
@@ -317,21 +304,18 @@ namespace dnv::vista::sdk
 		{
 			const auto& qualifyingNodeEntry = qualifyingNodesVec[i];
 
-			if ( i > 0 && qualifyingNodeEntry.targetNode().code() == qualifyingNodesVec[i - 1].targetNode().code() )
+			if ( i > 0 && qualifyingNodeEntry.targetNode().codeId() == qualifyingNodesVec[i - 1].targetNode().codeId() )
 			{
 				continue;
 			}
 
-			bool codeChanged = qualifyingNodeEntry.sourceNode()->code() != qualifyingNodeEntry.targetNode().code();
+			const ConversionPlan::Entry* entry = plan.find( *qualifyingNodeEntry.sourceNode(), sourceVersion );
+			const uint8_t changes = entry != nullptr ? entry->flags : planEntryFlags( *qualifyingNodeEntry.sourceNode(), qualifyingNodeEntry.targetNode() );
 
-			const GmodNode* sourceNormalAssignment = qualifyingNodeEntry.sourceNode()->productType();
-			const GmodNode* targetNormalAssignment = qualifyingNodeEntry.targetNode().productType();
+			bool codeChanged = ( changes & ConversionPlan::CODE_CHANGED ) != 0;
+			bool normalAssignmentChanged = ( changes & ConversionPlan::ASSIGNMENT_CHANGED ) != 0;
 
-			bool normalAssignmentChanged =
-				( sourceNormalAssignment == nullptr && targetNormalAssignment != nullptr ) ||
-				( sourceNormalAssignment != nullptr && targetNormalAssignment == nullptr ) ||
-				( sourceNormalAssignment != nullptr && targetNormalAssignment != nullptr &&
-					sourceNormalAssignment->code() != targetNormalAssignment->code() );
+			const GmodNode* targetNormalAssignment = qualifyingNodeEntry.targetNode().productType();
 
 			if ( codeChanged )
 			{
@@ -339,7 +323,7 @@ namespace dnv::vista::sdk
 			}
 			else if ( normalAssignmentChanged )
 			{ /* AC || AN || AD */
-				bool wasDeleted = sourceNormalAssignment != nullptr && targetNormalAssignment == nullptr;
+				bool wasDeleted = ( changes & ConversionPlan::ASSIGNMENT_DELETED ) != 0;
 
 				if ( !codeChanged )
 				{
@@ -348,7 +332,7 @@ namespace dnv::vista::sdk
 
 				if ( wasDeleted )
 				{
-					if ( qualifyingNodeEntry.targetNode().code() == overallTargetEndNode.code() )
+					if ( qualifyingNodeEntry.targetNode().codeId() == overallTargetEndNode.codeId() )
 					{
 						if ( i + 1 < qualifyingNodesVec.size() )
 						{
@@ -388,7 +372,7 @@ namespace dnv::vista::sdk
 				addToPath( targetGmod, reconstructedPath, qualifyingNodeEntry.targetNode() );
 			}
 
-			if ( !reconstructedPath.empty() && reconstructedPath.back().code() == overallTargetEndNode.code() )
+			if ( !reconstructedPath.empty() && reconstructedPath.back().codeId() == overallTargetEndNode.codeId() )
 			{
 				break;
 			}
@@ -412,28 +396,7 @@ namespace dnv::vista::sdk
 										  " from reconstructed path not found in target GMOD during finalization." );
 			}
 
-			GmodNode* nodeToAddAsPtr;
-			if ( pathNodeVal.location().has_value() )
-			{
-				GmodNode nodeWithLocation = baseNodeInGmodPtr->tryWithLocation( *pathNodeVal.location() );
-
-				if ( nodeWithLocation.code().empty() )
-				{
-					SPDLOG_WARN( "tryWithLocation() resulted in empty code for node '{}' with location '{}', using base node instead",
-						baseNodeInGmodPtr->code().data(), pathNodeVal.location()->toString() );
-
-					nodeToAddAsPtr = const_cast<GmodNode*>( baseNodeInGmodPtr );
-				}
-				else
-				{
-					nodesWithLocationStorage.push_back( nodeWithLocation );
-					nodeToAddAsPtr = &nodesWithLocationStorage.back();
-				}
-			}
-			else
-			{
-				nodeToAddAsPtr = const_cast<GmodNode*>( baseNodeInGmodPtr );
-			}
+			GmodNode* nodeToAddAsPtr = targetNodeOf( *baseNodeInGmodPtr, pathNodeVal.location() );
 
 			if ( k < reconstructedPath.size() - 1 )
 			{
@@ -457,6 +420,22 @@ namespace dnv::vista::sdk
 			throw std::runtime_error( "Did not end up with a valid path for " + sourcePath.toString() );
 		}
 
+		if ( !hasLocation )
+		{
+			std::unique_lock lock( plan.pathTemplatesMutex );
+			if ( plan.pathTemplates.size() < ConversionPlan::MAX_PATH_TEMPLATES )
+			{
+				std::vector<GmodLocatedNode> nodes;
+				nodes.reserve( finalParentPtrs.size() + 1 );
+				for ( const GmodNode* parent : finalParentPtrs )
+				{
+					nodes.emplace_back( *parent, std::nullopt );
+				}
+				nodes.emplace_back( *finalEndNodePtr, std::nullopt );
+				plan.pathTemplates.try_emplace( std::move( templateKey ), std::move( nodes ) );
+			}
+		}
+
 		return GmodPath( targetGmod, finalEndNodePtr, finalParentPtrs );
 	}
 
@@ -563,7 +542,7 @@ namespace dnv::vista::sdk
 				}
 			}
 
-			m_versioningNodeChanges.emplace( code, conversion );
+			m_versioningNodeChanges.emplace( StringInterner::instance().intern( code ), conversion );
 		}
 	}
 
@@ -579,7 +558,19 @@ namespace dnv::vista::sdk
 	bool GmodVersioning::GmodVersioningNode::tryGetCodeChanges(
 		const std::string& code, GmodNodeConversion& nodeChanges ) const
 	{
-		auto it = m_versioningNodeChanges.find( code );
+		uint32_t codeId;
+		if ( !StringInterner::instance().tryGetId( code, codeId ) )
+		{
+			return false;
+		}
+
+		return tryGetCodeChanges( codeId, nodeChanges );
+	}
+
+	bool GmodVersioning::GmodVersioningNode::tryGetCodeChanges(
+		uint32_t codeId, GmodNodeConversion& nodeChanges ) const
+	{
+		auto it = m_versioningNodeChanges.find( codeId );
 		if ( it != m_versioningNodeChanges.end() )
 		{
 			nodeChanges = it->second;
@@ -590,6 +581,22 @@ namespace dnv::vista::sdk
 		return false;
 	}
 
+	//----------------------------------------------
+	// ConversionPlan struct
+	//----------------------------------------------
+
+	const GmodVersioning::ConversionPlan::Entry* GmodVersioning::ConversionPlan::find(
+		const GmodNode& node, VisVersion sourceVersion ) const noexcept
+	{
+		const uint32_t codeId = node.codeId();
+		if ( node.visVersion() != sourceVersion || codeId >= entries.size() || !( entries[codeId].flags & KNOWN ) )
+		{
+			return nullptr;
+		}
+
+		return &entries[codeId];
+	}
+
 	//----------------------------------------------
 	// Private helper methods
 	//----------------------------------------------
@@ -599,7 +606,24 @@ namespace dnv::vista::sdk
 	{
 		validateSourceAndTargetVersionPair( sourceNode.visVersion(), targetVersion );
 
-		std::string nextCode = sourceNode.code();
+		const GmodNode* targetNodePtr = nextVersionNode( sourceNode, targetVersion );
+		if ( targetNodePtr == nullptr )
+		{
+			return std::nullopt;
+		}
+
+		auto resultNode = targetNodePtr->tryWithLocation( sourceNode.location() );
+		if ( sourceNode.location().has_value() && resultNode.location() != sourceNode.location() )
+		{
+			throw std::runtime_error( "Failed to set location" );
+		}
+
+		return resultNode;
+	}
+
+	const GmodNode* GmodVersioning::nextVersionNode( const GmodNode& sourceNode, VisVersion targetVersion ) const
+	{
+		std::optional<std::string> nextCode;
 
 		auto versioningIt = m_versioningsMap.find( targetVersion );
 		if ( versioningIt != m_versioningsMap.end() )
@@ -607,7 +631,7 @@ namespace dnv::vista::sdk
 			const auto& versioningNode = versioningIt->second;
 
 			GmodNodeConversion change{};
-			if ( versioningNode.tryGetCodeChanges( sourceNode.code(), change ) && change.target.has_value() )
+			if ( versioningNode.tryGetCodeChanges( sourceNode.codeId(), change ) && change.target.has_value() )
 			{
 				nextCode = change.target.value();
 			}
@@ -615,19 +639,98 @@ namespace dnv::vista::sdk
 
 		const auto& targetGmod = VIS::instance().gmod( targetVersion );
 
+		/* Unchanged codes keep their interned id across versions */
 		const GmodNode* targetNodePtr = nullptr;
-		if ( !targetGmod.tryGetNode( nextCode, targetNodePtr ) )
+		const bool found = nextCode.has_value()
+							   ? targetGmod.tryGetNode( *nextCode, targetNodePtr )
+							   : targetGmod.tryGetNode( sourceNode.codeId(), targetNodePtr );
+
+		return found ? targetNodePtr : nullptr;
+	}
+
+	const GmodVersioning::ConversionPlan& GmodVersioning::conversionPlan(
+		VisVersion sourceVersion, VisVersion targetVersion ) const
+	{
+		const uint64_t key = ( static_cast<uint64_t>( sourceVersion ) << 32 ) | static_cast<uint32_t>( targetVersion );
+
 		{
-			return std::nullopt;
+			std::shared_lock lock( m_conversionPlansMutex );
+			if ( auto it = m_conversionPlans.find( key ); it != m_conversionPlans.end() )
+			{
+				return *it->second;
+			}
 		}
 
-		auto resultNode = targetNodePtr->tryWithLocation( sourceNode.location() );
-		if ( sourceNode.location().has_value() && resultNode.location() != sourceNode.location() )
+		/* Built outside the lock, as it may load the GMOD of every version in between */
+		auto plan = buildConversionPlan( sourceVersion, targetVersion );
+
+		std::unique_lock lock( m_conversionPlansMutex );
+		auto it = m_conversionPlans.try_emplace( key, std::move( plan ) ).first;
+
+		return *it->second;
+	}
+
+	std::unique_ptr<const GmodVersioning::ConversionPlan> GmodVersioning::buildConversionPlan(
+		VisVersion sourceVersion, VisVersion targetVersion ) const
+	{
+		auto plan = std::make_unique<ConversionPlan>();
+		plan->targetGmod = &VIS::instance().gmod( targetVersion );
+
+		auto enumerator = VIS::instance().gmod( sourceVersion ).enumerator();
+		while ( enumerator.next() )
 		{
-			throw std::runtime_error( "Failed to set location" );
+			const GmodNode& sourceNode = enumerator.current();
+
+			const GmodNode* node = &sourceNode;
+			VisVersion source = sourceVersion;
+			while ( node != nullptr && static_cast<int>( source ) <= static_cast<int>( targetVersion ) - 100 )
+			{
+				source = static_cast<VisVersion>( static_cast<int>( source ) + 100 );
+				node = nextVersionNode( *node, source );
+			}
+
+			const uint32_t codeId = sourceNode.codeId();
+			if ( codeId >= plan->entries.size() )
+			{
+				plan->entries.resize( codeId + 1 );
+			}
+
+			ConversionPlan::Entry& entry = plan->entries[codeId];
+			entry.target = node;
+			entry.flags = ConversionPlan::KNOWN | ( node != nullptr ? planEntryFlags( sourceNode, *node ) : 0 );
 		}
 
-		return resultNode;
+		return plan;
+	}
+
+	std::optional<GmodPath> GmodVersioning::tryConvertPathDirect(
+		const ConversionPlan& plan, VisVersion sourceVersion, const GmodPath& sourcePath )
+	{
+		const Gmod& targetGmod = *plan.targetGmod;
+		const size_t length = sourcePath.length();
+
+		/* The mapped nodes keep the locations of the source nodes */
+		std::vector<GmodLocatedNode> targetNodes;
+		targetNodes.reserve( length );
+
+		for ( const GmodLocatedNode& sourceNode : sourcePath.locatedNodes() )
+		{
+			const ConversionPlan::Entry* entry = plan.find( sourceNode.node(), sourceVersion );
+			if ( entry == nullptr || entry->target == nullptr )
+			{
+				return std::nullopt;
+			}
+
+			targetNodes.push_back( sourceNode.withNode( *entry->target ) );
+		}
+
+		int missingLinkAt;
+		if ( !GmodPath::isValid( targetNodes, missingLinkAt ) )
+		{
+			return std::nullopt;
+		}
+
+		return GmodPath( targetGmod, targetNodes );
 	}
 
 	bool GmodVersioning::tryGetVersioningNode(
@@ -711,4 +814,35 @@ namespace dnv::vista::sdk
 
 		throw std::invalid_argument( "Invalid conversion type: " + type );
 	}
+
+	uint8_t GmodVersioning::planEntryFlags( const GmodNode& sourceNode, const GmodNode& targetNode )
+	{
+		uint8_t flags = 0;
+
+		if ( sourceNode.code() != targetNode.code() )
+		{
+			flags |= ConversionPlan::CODE_CHANGED;
+		}
+
+		const GmodNode* sourceNormalAssignment = sourceNode.productType();
+		const GmodNode* targetNormalAssignment = targetNode.productType();
+
+		const bool normalAssignmentChanged =
+			( sourceNormalAssignment == nullptr && targetNormalAssignment != nullptr ) ||
+			( sourceNormalAssignment != nullptr && targetNormalAssignment == nullptr ) ||
+			( sourceNormalAssignment != nullptr && targetNormalAssignment != nullptr &&
+				sourceNormalAssignment->code() != targetNormalAssignment->code() );
+
+		if ( normalAssignmentChanged )
+		{
+			flags |= ConversionPlan::ASSIGNMENT_CHANGED;
+		}
+
+		if ( sourceNormalAssignment != nullptr && targetNormalAssignment == nullptr )
+		{
+			flags |= ConversionPlan::ASSIGNMENT_DELETED;
+		}
+
+		return flags;
+	}
 }
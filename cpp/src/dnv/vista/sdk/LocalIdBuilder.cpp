@@ -14,6 +14,7 @@
 #include "dnv/vista/sdk/LocalIdBuilder.h"
 #include "dnv/vista/sdk/LocalIdParsingErrorBuilder.h"
 #include "dnv/vista/sdk/ParsingErrors.h"
+#include "dnv/vista/sdk/StaticChdDictionary.h"
 #include "dnv/vista/sdk/VIS.h"
 
 namespace dnv::vista::sdk
@@ -863,8 +864,7 @@ namespace dnv::vista::sdk
 						return false;
 					}
 
-					std::string versionStr( segment.substr( 4 ) );
-					if ( !VisVersionExtensions::tryParse( versionStr, visVersion ) )
+					if ( !VisVersionExtensions::tryParse( segment.substr( 4 ), visVersion ) )
 					{
 						errorBuilder.addError( LocalIdParsingState::VisVersion, predefinedMessage );
 
@@ -1381,37 +1381,25 @@ namespace dnv::vista::sdk
 
 	std::optional<LocalIdParsingState> LocalIdBuilder::metaPrefixToState( std::string_view prefix )
 	{
-		if ( prefix == "q" || prefix == "qty" )
+		static constexpr StaticChdDictionary<LocalIdParsingState, 14> s_metaPrefixMap{ { {
+			{ "q", LocalIdParsingState::MetaQuantity },
+			{ "qty", LocalIdParsingState::MetaQuantity },
+			{ "c", LocalIdParsingState::MetaContent },
+			{ "cnt", LocalIdParsingState::MetaContent },
+			{ "cal", LocalIdParsingState::MetaCalculation },
+			{ "calc", LocalIdParsingState::MetaCalculation },
+			{ "s", LocalIdParsingState::MetaState },
+			{ "state", LocalIdParsingState::MetaState },
+			{ "cmd", LocalIdParsingState::MetaCommand },
+			{ "t", LocalIdParsingState::MetaType },
+			{ "type", LocalIdParsingState::MetaType },
+			{ "pos", LocalIdParsingState::MetaPosition },
+			{ "d", LocalIdParsingState::MetaDetail },
+			{ "detail", LocalIdParsingState::MetaDetail } } } };
+
+		if ( const LocalIdParsingState* state = s_metaPrefixMap.find( prefix ) )
 		{
-			return LocalIdParsingState::MetaQuantity;
-		}
-		if ( prefix == "c" || prefix == "cnt" )
-		{
-			return LocalIdParsingState::MetaContent;
-		}
-		if ( prefix == "cal" || prefix == "calc" )
-		{
-			return LocalIdParsingState::MetaCalculation;
-		}
-		if ( prefix == "s" || prefix == "state" )
-		{
-			return LocalIdParsingState::MetaState;
-		}
-		if ( prefix == "cmd" )
-		{
-			return LocalIdParsingState::MetaCommand;
-		}
-		if ( prefix == "t" || prefix == "type" )
-		{
-			return LocalIdParsingState::MetaType;
-		}
-		if ( prefix == "pos" )
-		{
-			return LocalIdParsingState::MetaPosition;
-		}
-		if ( prefix == "d" || prefix == "detail" )
-		{
-			return LocalIdParsingState::MetaDetail;
+			return *state;
 		}
 
 		return std::nullopt;
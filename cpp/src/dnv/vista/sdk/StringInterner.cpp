@@ -0,0 +1,104 @@
+/**
+ * @file StringInterner.cpp
+ * @brief Implementation of the global GMOD code interning table
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/StringInterner.h"
+
+namespace dnv::vista::sdk
+{
+	//=====================================================================
+	// StringInterner class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Singleton access
+	//----------------------------------------------
+
+	StringInterner& StringInterner::instance()
+	{
+		static StringInterner s_instance;
+
+		return s_instance;
+	}
+
+	//----------------------------------------------
+	// Interning
+	//----------------------------------------------
+
+	uint32_t StringInterner::intern( std::string_view str )
+	{
+		{
+			std::shared_lock lock( m_mutex );
+
+			auto it = m_ids.find( str );
+			if ( it != m_ids.end() )
+			{
+				return it->second;
+			}
+		}
+
+		std::unique_lock lock( m_mutex );
+
+		/* Another thread may have interned the string between the two locks */
+		auto it = m_ids.find( str );
+		if ( it != m_ids.end() )
+		{
+			return it->second;
+		}
+
+		if ( m_strings.size() >= NPOS )
+		{
+			throw std::length_error( "StringInterner: id space exhausted" );
+		}
+
+		const auto id = static_cast<uint32_t>( m_strings.size() );
+		const std::string_view stored = m_storage.emplace_back( str );
+		m_strings.push_back( stored );
+		m_ids.emplace( stored, id );
+
+		return id;
+	}
+
+	bool StringInterner::tryGetId( std::string_view str, uint32_t& id ) const
+	{
+		std::shared_lock lock( m_mutex );
+
+		auto it = m_ids.find( str );
+		if ( it == m_ids.end() )
+		{
+			id = NPOS;
+
+			return false;
+		}
+
+		id = it->second;
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Accessors
+	//----------------------------------------------
+
+	std::string_view StringInterner::string( uint32_t id ) const
+	{
+		std::shared_lock lock( m_mutex );
+
+		if ( id >= m_strings.size() )
+		{
+			throw std::out_of_range( fmt::format( "StringInterner: unknown id {}", id ) );
+		}
+
+		return m_strings[id];
+	}
+
+	size_t StringInterner::size() const
+	{
+		std::shared_lock lock( m_mutex );
+
+		return m_strings.size();
+	}
+}
@@ -7,11 +7,13 @@
 
 #include "dnv/vista/sdk/VIS.h"
 
+#include "dnv/vista/sdk/ChdSeedTable.h"
 #include "dnv/vista/sdk/Codebooks.h"
 #include "dnv/vista/sdk/CodebooksDto.h"
 #include "dnv/vista/sdk/EmbeddedResource.h"
 #include "dnv/vista/sdk/Gmod.h"
 #include "dnv/vista/sdk/GmodDto.h"
+#include "dnv/vista/sdk/GmodSnapshot.h"
 #include "dnv/vista/sdk/GmodVersioning.h"
 #include "dnv/vista/sdk/LocalIdBuilder.h"
 
@@ -57,7 +59,7 @@ namespace dnv::vista::sdk
 		return VisVersionExtensions::allVersions();
 	}
 
-	GmodVersioning VIS::gmodVersioning()
+	const GmodVersioning& VIS::gmodVersioning()
 	{
 		{
 			std::shared_lock lock( m_cacheMutex );
@@ -80,7 +82,8 @@ namespace dnv::vista::sdk
 			throw std::runtime_error( "Failed to load GMOD versioning data" );
 		}
 
-		auto [inserted_it, success] = m_gmodVersioningCache.emplace( VERSIONING, GmodVersioning( *dto ) );
+		auto [inserted_it, success] = m_gmodVersioningCache.emplace(
+			std::piecewise_construct, std::forward_as_tuple( VERSIONING ), std::forward_as_tuple( *dto ) );
 		return inserted_it->second;
 	}
 
@@ -111,12 +114,70 @@ namespace dnv::vista::sdk
 			return it->second;
 		}
 
+		/* Prefer the binary GMOD cache shipped next to the JSON resources, if it was built from the current resource */
+		if ( auto path = EmbeddedResource::resourcePath( GmodSnapshot::fileName( visVersion ) ) )
+		{
+			std::optional<GmodSnapshot> snapshot;
+			if ( GmodSnapshot::tryOpen( *path, snapshot, GmodSnapshotValidation::Full ) && snapshot->visVersion() == visVersion )
+			{
+				bool isCurrent = true;
+				if ( auto sourcePath = EmbeddedResource::resourcePath( GmodSnapshot::sourceFileName( visVersion ) ) )
+				{
+					try
+					{
+						isCurrent = GmodSnapshot::fileChecksum( *sourcePath ) == snapshot->sourceChecksum();
+					}
+					catch ( [[maybe_unused]] const std::exception& ex )
+					{
+						SPDLOG_WARN( "Failed to checksum GMOD resource '{}': {}", sourcePath->string(), ex.what() );
+						isCurrent = false;
+					}
+				}
+
+				if ( isCurrent )
+				{
+					auto [inserted_it, success] = m_gmodCache.emplace( visVersion, Gmod( *snapshot ) );
+					return inserted_it->second;
+				}
+
+				SPDLOG_WARN( "Ignoring stale GMOD snapshot '{}', falling back to JSON resource.", path->string() );
+			}
+			else
+			{
+				SPDLOG_WARN( "Ignoring invalid GMOD snapshot '{}', falling back to JSON resource.", path->string() );
+			}
+		}
+
 		auto dto = loadGmodDto( visVersion );
 		if ( !dto )
 		{
 			throw std::runtime_error( "Failed to load GMOD DTO for version: " + VisVersionExtensions::toVersionString( visVersion ) );
 		}
 
+		/* Use the seed table from the offline CHD seed builder when available, skipping the seed search */
+		std::vector<int> seeds;
+		const auto seedsName = ChdSeedTable::fileName( "gmod-" + VisVersionExtensions::toVersionString( visVersion ) );
+		if ( auto path = EmbeddedResource::resourcePath( seedsName ) )
+		{
+			if ( !ChdSeedTable::tryRead( *path, dto->items().size(), seeds ) )
+			{
+				SPDLOG_WARN( "Ignoring stale or invalid CHD seed table '{}'.", path->string() );
+			}
+		}
+
+		if ( !seeds.empty() )
+		{
+			try
+			{
+				auto [inserted_it, success] = m_gmodCache.emplace( visVersion, Gmod( visVersion, *dto, seeds ) );
+				return inserted_it->second;
+			}
+			catch ( [[maybe_unused]] const std::invalid_argument& ex )
+			{
+				SPDLOG_WARN( "CHD seed table '{}' does not match the GMOD resource: {}", seedsName, ex.what() );
+			}
+		}
+
 		auto [inserted_it, success] = m_gmodCache.emplace( visVersion, Gmod( visVersion, std::move( *dto ) ) );
 		return inserted_it->second;
 	}
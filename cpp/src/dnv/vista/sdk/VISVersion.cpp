@@ -2,6 +2,8 @@
 
 #include "dnv/vista/sdk/VISVersion.h"
 
+#include "dnv/vista/sdk/StaticChdDictionary.h"
+
 namespace dnv::vista::sdk
 {
 	bool VisVersionExtensions::isValid( VisVersion version )
@@ -45,9 +47,9 @@ namespace dnv::vista::sdk
 		}
 	}
 
-	bool VisVersionExtensions::tryParse( const std::string& versionString, VisVersion& version )
+	bool VisVersionExtensions::tryParse( std::string_view versionString, VisVersion& version )
 	{
-		static const std::unordered_map<std::string, VisVersion> versionMap = {
+		static constexpr StaticChdDictionary<VisVersion, 10> s_versionMap{ { {
 			{ "3.4a", VisVersion::v3_4a },
 			{ "3.5a", VisVersion::v3_5a },
 			{ "3.6a", VisVersion::v3_6a },
@@ -58,29 +60,14 @@ namespace dnv::vista::sdk
 			{ "3-5a", VisVersion::v3_5a },
 			{ "3-6a", VisVersion::v3_6a },
 			{ "3-7a", VisVersion::v3_7a },
-			{ "3-8a", VisVersion::v3_8a } };
-
-		std::string normalizedVersion = versionString;
-
-		if ( normalizedVersion.rfind( "vis-", 0 ) == 0 )
-		{
-			normalizedVersion = normalizedVersion.substr( 4 );
-		}
-
-		auto it = versionMap.find( normalizedVersion );
-		if ( it != versionMap.end() )
-		{
-			version = it->second;
-			return true;
-		}
+			{ "3-8a", VisVersion::v3_8a } } } };
 
-		std::replace( normalizedVersion.begin(), normalizedVersion.end(), '-', '.' );
-		if ( normalizedVersion != versionString )
+		if ( versionString.starts_with( "vis-" ) )
 		{
-			return tryParse( normalizedVersion, version );
+			versionString.remove_prefix( 4 );
 		}
 
-		return false;
+		return s_versionMap.tryGetValue( versionString, version );
 	}
 
 	VisVersion VisVersionExtensions::parse( const std::string& versionString )
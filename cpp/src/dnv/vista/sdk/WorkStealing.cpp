@@ -0,0 +1,130 @@
+/**
+ * @file WorkStealing.cpp
+ * @brief Implementation of the work splitting shared by the parallel operations of the library.
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/WorkStealing.h"
+
+namespace dnv::vista::sdk
+{
+	namespace internal
+	{
+		//=====================================================================
+		// ChunkRanges class
+		//=====================================================================
+
+		//----------------------------------------------
+		// Construction / destruction
+		//----------------------------------------------
+
+		ChunkRanges::ChunkRanges( size_t chunkCount, size_t workerCount )
+			: m_ranges( workerCount )
+		{
+			for ( size_t worker = 0; worker < workerCount; ++worker )
+			{
+				const uint64_t begin = chunkCount * worker / workerCount;
+				const uint64_t end = chunkCount * ( worker + 1 ) / workerCount;
+				m_ranges[worker].value.store( begin << 32 | end, std::memory_order_relaxed );
+			}
+		}
+
+		//----------------------------------------------
+		// Claiming
+		//----------------------------------------------
+
+		bool ChunkRanges::next( size_t worker, size_t& chunk )
+		{
+			if ( popFront( worker, chunk ) )
+			{
+				return true;
+			}
+
+			for ( size_t offset = 1; offset < m_ranges.size(); ++offset )
+			{
+				const size_t victim = ( worker + offset ) % m_ranges.size();
+				if ( stealHalf( victim, worker ) && popFront( worker, chunk ) )
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		//----------------------------------------------
+		// Private helper methods
+		//----------------------------------------------
+
+		bool ChunkRanges::popFront( size_t worker, size_t& chunk )
+		{
+			std::atomic<uint64_t>& value = m_ranges[worker].value;
+			uint64_t range = value.load( std::memory_order_acquire );
+			while ( beginOf( range ) < endOf( range ) )
+			{
+				if ( value.compare_exchange_weak( range, range + ( uint64_t{ 1 } << 32 ), std::memory_order_acq_rel ) )
+				{
+					chunk = static_cast<size_t>( beginOf( range ) );
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		bool ChunkRanges::stealHalf( size_t victim, size_t thief )
+		{
+			std::atomic<uint64_t>& value = m_ranges[victim].value;
+			uint64_t range = value.load( std::memory_order_acquire );
+			while ( beginOf( range ) < endOf( range ) )
+			{
+				const uint64_t begin = beginOf( range );
+				const uint64_t end = endOf( range );
+				const uint64_t middle = begin + ( end - begin ) / 2;
+				if ( value.compare_exchange_weak( range, begin << 32 | middle, std::memory_order_acq_rel ) )
+				{
+					/* The thief's own range is empty, so nobody else changes it meanwhile */
+					m_ranges[thief].value.store( middle << 32 | end, std::memory_order_release );
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		//=====================================================================
+		// Workers
+		//=====================================================================
+
+		void runWorkers(
+			size_t workerCount,
+			const std::function<void( size_t workerCount, const std::function<void( size_t worker )>& task )>& executor,
+			const std::function<void( size_t worker )>& task )
+		{
+			if ( executor )
+			{
+				executor( workerCount, task );
+
+				return;
+			}
+
+			/* Worker 0 runs on the calling thread */
+			std::vector<std::future<void>> futures;
+			futures.reserve( workerCount - 1 );
+			for ( size_t worker = 1; worker < workerCount; ++worker )
+			{
+				futures.push_back( std::async( std::launch::async, [&task, worker]() { task( worker ); } ) );
+			}
+
+			task( 0 );
+
+			for ( auto& future : futures )
+			{
+				future.get();
+			}
+		}
+	}
+}
@@ -0,0 +1,94 @@
+/**
+ * @file WorkStealing.h
+ * @brief Work splitting shared by the parallel operations of the library.
+ * @details Internal header: used by `GmodPath::tryParseMany()` and `GmodTraversal::traverseParallel()`,
+ *          not part of the public API.
+ */
+
+#pragma once
+
+namespace dnv::vista::sdk
+{
+	namespace internal
+	{
+		//=====================================================================
+		// ChunkRanges class
+		//=====================================================================
+
+		/**
+		 * @brief Chunk ranges of the workers of a parallel operation.
+		 * @details Each worker owns a contiguous range of chunks, packed as `begin << 32 | end` into
+		 *          one atomic word. The owner claims chunks from the front of its range; a worker
+		 *          whose range is empty steals the back half of another one. Both update the word
+		 *          with a compare-exchange, so every chunk is claimed exactly once.
+		 */
+		class ChunkRanges final
+		{
+		public:
+			//----------------------------------------------
+			// Construction / destruction
+			//----------------------------------------------
+
+			/**
+			 * @brief Constructor.
+			 * @param chunkCount The number of chunks, split evenly between the workers.
+			 * @param workerCount The number of workers.
+			 */
+			ChunkRanges( size_t chunkCount, size_t workerCount );
+
+			//----------------------------------------------
+			// Claiming
+			//----------------------------------------------
+
+			/**
+			 * @brief Claims the next chunk of a worker, stealing from the others once its range is empty.
+			 * @param worker The claiming worker.
+			 * @param[out] chunk Receives the claimed chunk.
+			 * @return False once no chunk is left to claim.
+			 */
+			bool next( size_t worker, size_t& chunk );
+
+		private:
+			//----------------------------------------------
+			// Range struct
+			//----------------------------------------------
+
+			struct alignas( 64 ) Range
+			{
+				std::atomic<uint64_t> value{ 0 };
+			};
+
+			//----------------------------------------------
+			// Private helper methods
+			//----------------------------------------------
+
+			static uint64_t beginOf( uint64_t range ) noexcept { return range >> 32; }
+			static uint64_t endOf( uint64_t range ) noexcept { return range & 0xFFFFFFFFu; }
+
+			bool popFront( size_t worker, size_t& chunk );
+			bool stealHalf( size_t victim, size_t thief );
+
+			//----------------------------------------------
+			// Private member variables
+			//----------------------------------------------
+
+			std::vector<Range> m_ranges;
+		};
+
+		//=====================================================================
+		// Workers
+		//=====================================================================
+
+		/**
+		 * @brief Runs `task( worker )` for the workers `[0, workerCount)`.
+		 * @param workerCount The number of workers.
+		 * @param executor Runs the workers; when empty, worker 0 runs on the calling thread and the
+		 *        others on `std::async` threads.
+		 * @param task The work of one worker.
+		 */
+		void runWorkers(
+			size_t workerCount,
+			const std::function<void( size_t workerCount, const std::function<void( size_t worker )>& task )>& executor,
+			const std::function<void( size_t worker )>& task );
+	}
+}
@@ -5,11 +5,13 @@
 /* STL */
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cctype>
 #include <charconv>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <functional>
@@ -24,6 +26,7 @@
 #include <numeric>
 #include <optional>
 #include <queue>
+#include <ranges>
 #include <regex>
 #include <set>
 #include <shared_mutex>
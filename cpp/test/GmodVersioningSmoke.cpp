@@ -0,0 +1,204 @@
+/**
+ * @file GmodVersioningSmoke.cpp
+ * @brief Long-running path conversion soak test; built with VISTA_SDK_CPP_BUILD_SMOKE_TESTS.
+ */
+
+#include "pch.h"
+
+#include "TestDataLoader.h"
+
+#include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/GmodVersioning.h"
+#include "dnv/vista/sdk/Locations.h"
+#include "dnv/vista/sdk/VIS.h"
+
+#if defined( __linux__ )
+#	include <unistd.h>
+#endif
+
+namespace dnv::vista::sdk::tests
+{
+	namespace
+	{
+		constexpr const char* GMOD_PATH_TEST_DATA_PATH = "testdata/GmodPaths.json";
+		constexpr const char* VERSIONING_TEST_DATA_PATH = "testdata/VersioningTestCases.json";
+
+		/** @brief Default number of conversions; override with VISTA_SDK_SOAK_CONVERSIONS. */
+		constexpr size_t DEFAULT_SOAK_CONVERSIONS{ 1'000'000 };
+
+		/** @brief Allowed resident set growth from before the warm-up pass. */
+		constexpr size_t MAX_RSS_GROWTH_BYTES{ 16 * 1024 * 1024 };
+
+		struct Conversion
+		{
+			VisVersion sourceVersion;
+			GmodPath sourcePath;
+			VisVersion targetVersion;
+		};
+
+		size_t soakConversions()
+		{
+			const char* value = std::getenv( "VISTA_SDK_SOAK_CONVERSIONS" );
+
+			return value != nullptr ? static_cast<size_t>( std::stoull( value ) ) : DEFAULT_SOAK_CONVERSIONS;
+		}
+
+		/**
+		 * @brief Gets the resident set size of the process.
+		 * @return The size in bytes, or 0 where it cannot be read.
+		 */
+		size_t residentSetBytes()
+		{
+#if defined( __linux__ )
+			std::ifstream statm( "/proc/self/statm" );
+			size_t totalPages = 0;
+			size_t residentPages = 0;
+			statm >> totalPages >> residentPages;
+
+			return residentPages * static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+#else
+			return 0;
+#endif
+		}
+
+		/** @brief Loads the GMODs, locations and versioning data of every VIS version. */
+		void loadResources()
+		{
+			auto& vis = VIS::instance();
+			for ( const VisVersion version : vis.visVersions() )
+			{
+				(void)vis.gmod( version );
+				(void)vis.locations( version );
+			}
+			(void)vis.gmodVersioning();
+		}
+
+		/**
+		 * @brief Gets a copy of a path with a location on its first individualizable set.
+		 * @param path The path.
+		 * @param location The location.
+		 * @return The located path, or `std::nullopt` if the path has no individualizable set.
+		 */
+		std::optional<GmodPath> withLocation( const GmodPath& path, const Location& location )
+		{
+			std::vector<GmodIndividualizableSet> sets = path.individualizableSets();
+			if ( sets.empty() )
+			{
+				return std::nullopt;
+			}
+
+			sets[0].setLocation( location );
+
+			return sets[0].build();
+		}
+
+		/**
+		 * @brief Location of the soak iteration `n`; every iteration gets a location no earlier one used.
+		 * @param version The VIS version of the locations.
+		 * @param n The iteration.
+		 * @return The location.
+		 */
+		Location soakLocation( VisVersion version, size_t n )
+		{
+			return VIS::instance().locations( version ).parse( std::to_string( n + 1 ) );
+		}
+
+		/**
+		 * @brief Every path of the test data that converts with a location on its first individualizable
+		 *        set, paired with its conversion target.
+		 */
+		std::vector<Conversion> loadConversions()
+		{
+			auto& vis = VIS::instance();
+			const VisVersion latest = vis.latestVisVersion();
+			std::vector<Conversion> conversions;
+
+			auto add = [&]( VisVersion source, std::optional<GmodPath> path, VisVersion target ) {
+				if ( !path.has_value() || source == target )
+				{
+					return;
+				}
+
+				try
+				{
+					/* The warm-up uses a location that the soak does not */
+					std::optional<GmodPath> located = withLocation( *path, vis.locations( source ).parse( "P" ) );
+					if ( located.has_value() && vis.convertPath( source, *located, target ).has_value() )
+					{
+						conversions.push_back( { source, std::move( *path ), target } );
+					}
+				}
+				catch ( const std::exception& )
+				{
+					/* Paths the converter does not support are not part of the soak */
+				}
+			};
+
+			for ( const auto& item : loadTestData( GMOD_PATH_TEST_DATA_PATH )["Valid"] )
+			{
+				const VisVersion source = VisVersionExtensions::parse( item["visVersion"].get<std::string>() );
+
+				std::optional<GmodPath> path;
+				(void)GmodPath::tryParse( item["path"].get<std::string>(), source, path );
+				add( source, std::move( path ), latest );
+			}
+
+			for ( const auto& [name, cases] : loadTestData( VERSIONING_TEST_DATA_PATH ).items() )
+			{
+				for ( const auto& item : cases )
+				{
+					const VisVersion source = VisVersionExtensions::parse( item["from"].get<std::string>() );
+					const VisVersion target = VisVersionExtensions::parse( item["to"].get<std::string>() );
+
+					std::optional<GmodPath> path;
+					(void)GmodPath::tryParseFullPath( item["sourceFullPath"].get<std::string>(), source, path );
+					add( source, std::move( path ), target );
+				}
+			}
+
+			return conversions;
+		}
+	}
+
+	//=====================================================================
+	// Soak
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test_GmodVersioning_ConvertPath_Soak
+	//----------------------------------------------
+
+	TEST( GmodVersioningSmokeTest, Test_GmodVersioning_ConvertPath_Soak )
+	{
+		auto& vis = VIS::instance();
+		loadResources();
+
+		/* Measured before the warm-up, so nothing the warm-up allocates is excluded from the growth */
+		const size_t rssBefore = residentSetBytes();
+
+		const std::vector<Conversion> conversions = loadConversions();
+		ASSERT_FALSE( conversions.empty() );
+
+		const size_t total = soakConversions();
+
+		/* Each conversion gets a location never seen before, so nothing can be reused across conversions */
+		for ( size_t n = 0; n < total; ++n )
+		{
+			const Conversion& conversion = conversions[n % conversions.size()];
+			std::optional<GmodPath> source = withLocation( conversion.sourcePath, soakLocation( conversion.sourceVersion, n ) );
+			ASSERT_TRUE( source.has_value() ) << conversion.sourcePath.toString();
+
+			std::optional<GmodPath> target = vis.convertPath( conversion.sourceVersion, *source, conversion.targetVersion );
+			ASSERT_TRUE( target.has_value() ) << source->toString();
+		}
+
+		const size_t rssAfter = residentSetBytes();
+		if ( rssBefore == 0 )
+		{
+			GTEST_SKIP() << "Resident set size is not available on this platform";
+		}
+
+		EXPECT_LE( rssAfter, rssBefore + MAX_RSS_GROWTH_BYTES )
+			<< "RSS grew from " << rssBefore << " to " << rssAfter << " bytes over " << total << " conversions";
+	}
+}
@@ -101,5 +101,53 @@ namespace dnv::vista::sdk
 				ASSERT_EQ( static_cast<int>( i + 1 ), sortedValues[i] );
 			}
 		}
+
+		//----------------------------------------------
+		// Test_CodebookName_Prefix_RoundTrip
+		//----------------------------------------------
+
+		TEST( CodebooksTests, Test_CodebookName_Prefix_RoundTrip )
+		{
+			for ( int i = static_cast<int>( CodebookName::Quantity ); i <= static_cast<int>( CodebookName::Detail ); ++i )
+			{
+				const auto name = static_cast<CodebookName>( i );
+				EXPECT_EQ( CodebookNames::fromPrefix( CodebookNames::toPrefix( name ) ), name );
+			}
+
+			EXPECT_THROW( (void)CodebookNames::fromPrefix( "" ), std::invalid_argument );
+			EXPECT_THROW( (void)CodebookNames::fromPrefix( "po" ), std::invalid_argument );
+			EXPECT_THROW( (void)CodebookNames::fromPrefix( "posx" ), std::invalid_argument );
+			EXPECT_THROW( (void)CodebookNames::fromPrefix( "Pos" ), std::invalid_argument );
+
+			VisVersion version = VisVersion::Unknown;
+			EXPECT_TRUE( VisVersionExtensions::tryParse( "vis-3-4a", version ) );
+			EXPECT_EQ( version, VisVersion::v3_4a );
+			EXPECT_TRUE( VisVersionExtensions::tryParse( "3.8a", version ) );
+			EXPECT_EQ( version, VisVersion::v3_8a );
+			EXPECT_FALSE( VisVersionExtensions::tryParse( "vis-3-9a", version ) );
+			EXPECT_FALSE( VisVersionExtensions::tryParse( "", version ) );
+		}
+
+		//----------------------------------------------
+		// Test_StaticChdDictionary_ConstantEvaluation
+		//----------------------------------------------
+
+		TEST( CodebooksTests, Test_StaticChdDictionary_ConstantEvaluation )
+		{
+			static constexpr StaticChdDictionary<int, 5> dictionary{ { {
+				{ "a", 1 }, { "bb", 2 }, { "ccc", 3 }, { "dddd", 4 }, { "eeeee", 5 } } } };
+
+			static_assert( dictionary.size() == 5 );
+			static_assert( decltype( dictionary )::TABLE_SIZE == 16 );
+			static_assert( *dictionary.find( "ccc" ) == 3 );
+			static_assert( dictionary.find( "cc" ) == nullptr );
+			static_assert( !dictionary.contains( "" ) );
+
+			int value = 0;
+			EXPECT_TRUE( dictionary.tryGetValue( "eeeee", value ) );
+			EXPECT_EQ( value, 5 );
+			EXPECT_FALSE( dictionary.tryGetValue( "f", value ) );
+			EXPECT_EQ( value, 5 );
+		}
 	}
 }
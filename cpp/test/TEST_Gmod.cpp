@@ -5,8 +5,11 @@
 
 #include "pch.h"
 
+#include "dnv/vista/sdk/ChdSeedTable.h"
+#include "dnv/vista/sdk/GmodDto.h"
 #include "dnv/vista/sdk/GmodTraversal.h"
 #include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/StringInterner.h"
 #include "dnv/vista/sdk/VIS.h"
 
 namespace dnv::vista::sdk::tests
@@ -82,6 +85,92 @@ namespace dnv::vista::sdk::tests
 			EXPECT_NE( &node1, &node4 );
 		}
 
+		//----------------------------------------------
+		// Test_Gmod_Node_Shared_Metadata
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_Node_Shared_Metadata )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			const GmodNode& node = gmod["C101.31"];
+			const GmodNode located = node.withLocation( "1" );
+
+			/* Copies share metadata and relationships with the original node */
+			EXPECT_EQ( &located.metadata(), &node.metadata() );
+			EXPECT_EQ( &located.children(), &node.children() );
+			EXPECT_EQ( &located.parents(), &node.parents() );
+
+			/* Equal metadata is stored once per Gmod */
+			std::unordered_map<std::string, const GmodNode*> firstByName;
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				const GmodNode& current = enumerator.current();
+				auto [it, inserted] = firstByName.try_emplace( current.metadata().name(), &current );
+				if ( !inserted )
+				{
+					EXPECT_EQ( it->second->metadata() == current.metadata(), &it->second->metadata() == &current.metadata() );
+				}
+			}
+
+			/* Metadata is owned by the nodes, not by a process-wide store, and outlives its Gmod in copies */
+			std::optional<GmodNode> copy;
+			{
+				auto dto = VIS::loadGmodDto( VisVersion::v3_4a );
+				ASSERT_TRUE( dto.has_value() );
+
+				const Gmod ownGmod{ VisVersion::v3_4a, *dto };
+				copy.emplace( ownGmod["C101.31"].withLocation( "1" ) );
+
+				EXPECT_NE( &copy->metadata(), &node.metadata() );
+			}
+			EXPECT_EQ( copy->metadata(), node.metadata() );
+			EXPECT_EQ( copy->metadata().name(), node.metadata().name() );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Node_Located
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_Node_Located )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			const GmodNode& node = gmod["C101.31"];
+
+			const GmodLocatedNode withoutLocation = node.located( std::nullopt );
+			EXPECT_EQ( &withoutLocation.node(), &node );
+			EXPECT_FALSE( withoutLocation.hasLocation() );
+			EXPECT_FALSE( withoutLocation.location().has_value() );
+			EXPECT_EQ( withoutLocation.toString(), node.toString() );
+			EXPECT_EQ( withoutLocation.toNode(), node );
+
+			const GmodLocatedNode withLocation = node.located( Location{ "1" } );
+			EXPECT_TRUE( withLocation.hasLocation() );
+			EXPECT_EQ( withLocation.code(), "C101.31" );
+			EXPECT_EQ( withLocation.location(), std::optional<Location>{ Location{ "1" } } );
+			EXPECT_EQ( withLocation.toString(), "C101.31-1" );
+			EXPECT_EQ( withLocation.toNode(), node.withLocation( "1" ) );
+
+			EXPECT_NE( withLocation, withoutLocation );
+			EXPECT_EQ( withLocation, node.located( Location{ "1" } ) );
+			EXPECT_NE( withLocation, node.located( Location{ "2" } ) );
+			EXPECT_NE( withLocation, gmod["C101"].located( Location{ "1" } ) );
+
+			/* Locations longer than the inline capacity are stored by id */
+			const Location longLocation{ "12345678901" };
+			const GmodLocatedNode withLongLocation = node.located( longLocation );
+			EXPECT_EQ( withLongLocation.location(), std::optional<Location>{ longLocation } );
+			EXPECT_EQ( withLongLocation.toString(), "C101.31-12345678901" );
+			EXPECT_EQ( withLongLocation, node.located( longLocation ) );
+			EXPECT_NE( withLongLocation, withLocation );
+
+			/* They do not take ids from the table of GMOD codes */
+			uint32_t codeId;
+			EXPECT_FALSE( StringInterner::instance().tryGetId( longLocation.value(), codeId ) );
+		}
+
 		//----------------------------------------------
 		// Test_Gmod_Node_Types
 		//----------------------------------------------
@@ -311,6 +400,580 @@ namespace dnv::vista::sdk::tests
 
 			EXPECT_TRUE( completed );
 		}
+
+		//----------------------------------------------
+		// Test_Traversal_Inlined_Handler
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Traversal_Inlined_Handler )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			struct VisitState
+			{
+				std::vector<std::pair<const GmodNode*, size_t>> visits;
+			};
+
+			TraversalOptions options;
+			options.maxTraversalOccurrence = 2;
+
+			VisitState expected;
+			TraverseHandlerWithState<VisitState> handler =
+				[]( VisitState& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+				state.visits.emplace_back( &node, parents.size() );
+
+				return node.code() == "411.1" ? TraversalHandlerResult::SkipSubtree : TraversalHandlerResult::Continue;
+			};
+			ASSERT_TRUE( GmodTraversal::traverse( expected, gmod, handler, options ) );
+
+			std::vector<std::pair<const GmodNode*, size_t>> visits;
+			bool completed = GmodTraversal::traverse(
+				gmod,
+				[&visits]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) {
+					visits.emplace_back( &node, parents.size() );
+
+					return node.code() == "411.1" ? TraversalHandlerResult::SkipSubtree : TraversalHandlerResult::Continue;
+				},
+				options );
+
+			EXPECT_TRUE( completed );
+			EXPECT_EQ( expected.visits, visits );
+
+			size_t visited = 0;
+			completed = GmodTraversal::traverse( gmod["400a"], [&visited]( const std::vector<const GmodNode*>&, const GmodNode& ) {
+				return ++visited == 10 ? TraversalHandlerResult::Stop : TraversalHandlerResult::Continue;
+			} );
+
+			EXPECT_FALSE( completed );
+			EXPECT_EQ( 10u, visited );
+		}
+
+		//----------------------------------------------
+		// Test_Paths_View
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Paths_View )
+		{
+			static_assert( std::ranges::view<GmodTraversal::PathView> );
+			static_assert( std::ranges::input_range<GmodTraversal::PathView> );
+
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			TraversalOptions options;
+			options.maxTraversalOccurrence = 2;
+
+			std::vector<std::vector<const GmodNode*>> expected;
+			ASSERT_TRUE( GmodTraversal::traverse( gmod["411.1"], [&expected]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) {
+				expected.push_back( parents );
+				expected.back().push_back( &node );
+
+				return TraversalHandlerResult::Continue;
+			}, options ) );
+
+			std::vector<std::vector<const GmodNode*>> enumerated;
+			for ( const GmodTraversal::TraversalPath path : GmodTraversal::paths( gmod["411.1"], options ) )
+			{
+				enumerated.emplace_back( path.parents.begin(), path.parents.end() );
+				enumerated.back().push_back( path.node );
+			}
+
+			EXPECT_EQ( expected, enumerated );
+
+			std::vector<const GmodNode*> expectedLeaves;
+			(void)GmodTraversal::traverse( gmod, [&expectedLeaves]( const std::vector<const GmodNode*>&, const GmodNode& node ) {
+				if ( node.isLeafNode() )
+				{
+					expectedLeaves.push_back( &node );
+				}
+
+				return expectedLeaves.size() == 5 ? TraversalHandlerResult::Stop : TraversalHandlerResult::Continue;
+			} );
+
+			std::vector<const GmodNode*> leaves;
+			for ( const GmodTraversal::TraversalPath path : GmodTraversal::paths( gmod ) |
+															   std::views::filter( []( const GmodTraversal::TraversalPath& p ) { return p.node->isLeafNode(); } ) |
+															   std::views::take( 5 ) )
+			{
+				EXPECT_TRUE( path.parents.front()->isRoot() );
+				leaves.push_back( path.node );
+			}
+
+			EXPECT_EQ( expectedLeaves, leaves );
+		}
+
+		//----------------------------------------------
+		// Test_Parallel_Traversal
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Parallel_Traversal )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_8a );
+
+			struct CountState
+			{
+				size_t nodeCount = 0;
+				size_t depthSum = 0;
+			};
+
+			auto count = []( CountState& state, const std::vector<const GmodNode*>& parents, const GmodNode& ) {
+				++state.nodeCount;
+				state.depthSum += parents.size();
+
+				return TraversalHandlerResult::Continue;
+			};
+			auto merge = []( CountState& state, CountState&& workerState ) {
+				state.nodeCount += workerState.nodeCount;
+				state.depthSum += workerState.depthSum;
+			};
+
+			ParallelTraversalOptions options;
+			options.threadCount = 4;
+
+			CountState expected;
+			ASSERT_TRUE( GmodTraversal::traverse( gmod, [&]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) {
+				return count( expected, parents, node );
+			}, options ) );
+
+			CountState parallel;
+			EXPECT_TRUE( GmodTraversal::traverseParallel( parallel, gmod, count, merge, options ) );
+			EXPECT_EQ( expected.nodeCount, parallel.nodeCount );
+			EXPECT_EQ( expected.depthSum, parallel.depthSum );
+
+			/* An executor may run the workers one after the other */
+			size_t executedWorkers = 0;
+			options.executor = [&executedWorkers]( size_t workerCount, const std::function<void( size_t )>& task ) {
+				for ( size_t worker = 0; worker < workerCount; ++worker )
+				{
+					task( worker );
+					++executedWorkers;
+				}
+			};
+
+			CountState sequential;
+			EXPECT_TRUE( GmodTraversal::traverseParallel( sequential, gmod, count, merge, options ) );
+			EXPECT_EQ( 4u, executedWorkers );
+			EXPECT_EQ( expected.nodeCount, sequential.nodeCount );
+			EXPECT_EQ( expected.depthSum, sequential.depthSum );
+
+			options.executor = {};
+
+			CountState stopped;
+			bool completed = GmodTraversal::traverseParallel(
+				stopped, gmod,
+				[]( CountState& state, const std::vector<const GmodNode*>&, const GmodNode& node ) {
+					++state.nodeCount;
+
+					return node.code() == "C101" ? TraversalHandlerResult::Stop : TraversalHandlerResult::Continue;
+				},
+				merge, options );
+
+			EXPECT_FALSE( completed );
+			EXPECT_LT( stopped.nodeCount, expected.nodeCount );
+		}
+
+		//----------------------------------------------
+		// Test_Subtree_Statistics
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Subtree_Statistics )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			auto check = [&gmod]( const GmodNode& node, const TraversalOptions& options ) {
+				uint64_t nodeCount = 0;
+				size_t depth = 0;
+				(void)GmodTraversal::traverse( node, [&]( const std::vector<const GmodNode*>& parents, const GmodNode& ) {
+					++nodeCount;
+					depth = std::max( depth, parents.size() );
+
+					return TraversalHandlerResult::Continue;
+				}, options );
+
+				EXPECT_EQ( nodeCount, GmodTraversal::pathCount( gmod, node, options ) ) << node.code();
+				EXPECT_EQ( depth, GmodTraversal::maxDepth( gmod, node, options ) ) << node.code();
+			};
+
+			TraversalOptions options;
+			for ( const char* code : { "VE", "411.1", "C101", "C101.31", "S206", "511.11" } )
+			{
+				check( gmod[code], options );
+			}
+
+			auto enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				check( enumerator.current(), options );
+			}
+
+			options.maxTraversalOccurrence = 2;
+			for ( const char* code : { "411.1", "C101.31", "S206", "C101" } )
+			{
+				check( gmod[code], options );
+			}
+
+			EXPECT_THROW( (void)GmodTraversal::pathCount( gmod, VIS::instance().gmod( VisVersion::v3_5a )["411.1"] ), std::invalid_argument );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_From_NodeMap
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_From_NodeMap )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			std::unordered_map<std::string, GmodNode> nodeMap;
+			auto enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				nodeMap.emplace( enumerator.current().code(), enumerator.current() );
+			}
+
+			const Gmod mapGmod( VisVersion::v3_4a, nodeMap );
+			const internal::GmodGraph* graph = mapGmod.rootNode().graph();
+			ASSERT_NE( graph, nullptr );
+			EXPECT_EQ( graph->children.size(), gmod.rootNode().graph()->children.size() );
+
+			/* Relationships are relinked to the new Gmod's own nodes */
+			auto mapEnumerator = mapGmod.enumerator();
+			while ( mapEnumerator.next() )
+			{
+				const GmodNode& node = mapEnumerator.current();
+				ASSERT_EQ( node.children().size(), gmod[node.code()].children().size() ) << node.code();
+				for ( const GmodNode* child : node.children() )
+				{
+					ASSERT_EQ( child, &mapGmod[child->code()] );
+					ASSERT_EQ( child->graph(), graph );
+					ASSERT_TRUE( node.isChild( *child ) );
+				}
+				for ( const GmodNode* parent : node.parents() )
+				{
+					ASSERT_EQ( parent, &mapGmod[parent->code()] );
+				}
+			}
+
+			size_t mapNodeCount = 0;
+			EXPECT_TRUE( GmodTraversal::traverse( mapGmod.rootNode(), [&]( const std::vector<const GmodNode*>& parents, const GmodNode& node ) {
+				EXPECT_EQ( node.graph(), graph );
+				EXPECT_TRUE( parents.empty() || parents.back()->isChild( node ) );
+				++mapNodeCount;
+
+				return TraversalHandlerResult::Continue;
+			} ) );
+			EXPECT_GT( mapNodeCount, mapGmod.rootNode().children().size() );
+			EXPECT_EQ( mapNodeCount, GmodTraversal::pathCount( gmod, gmod.rootNode() ) );
+
+			/* The source Gmod is left untouched */
+			EXPECT_EQ( gmod["411.1"].children()[0], &gmod[gmod["411.1"].children()[0]->code()] );
+		}
+
+		//----------------------------------------------
+		// Test_GmodDto_Parse
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_GmodDto_Parse )
+		{
+			auto expectSame = []( const GmodDto& expected, const GmodDto& actual ) {
+				EXPECT_EQ( expected.visVersion(), actual.visVersion() );
+				ASSERT_EQ( expected.items().size(), actual.items().size() );
+				for ( size_t i = 0; i < expected.items().size(); ++i )
+				{
+					const GmodNodeDto& a = expected.items()[i];
+					const GmodNodeDto& b = actual.items()[i];
+					EXPECT_EQ( a.category(), b.category() ) << a.code();
+					EXPECT_EQ( a.type(), b.type() ) << a.code();
+					EXPECT_EQ( a.code(), b.code() );
+					EXPECT_EQ( a.name(), b.name() ) << a.code();
+					EXPECT_EQ( a.commonName(), b.commonName() ) << a.code();
+					EXPECT_EQ( a.definition(), b.definition() ) << a.code();
+					EXPECT_EQ( a.commonDefinition(), b.commonDefinition() ) << a.code();
+					EXPECT_EQ( a.installSubstructure(), b.installSubstructure() ) << a.code();
+					EXPECT_EQ( a.normalAssignmentNames(), b.normalAssignmentNames() ) << a.code();
+				}
+				EXPECT_EQ( expected.relations(), actual.relations() );
+			};
+
+			const GmodDto dto = VIS::instance().gmodDto( VisVersion::v3_7a );
+			const std::string text = dto.toJson().dump();
+
+			auto parsed = GmodDto::tryParse( text );
+			ASSERT_TRUE( parsed.has_value() );
+			expectSame( dto, *parsed );
+			expectSame( GmodDto::fromJson( nlohmann::json::parse( text ) ), *parsed );
+
+			/* Malformed entries are skipped as by the DOM based parser */
+			const std::string malformed = R"({
+				"schemaVersion": "1.0",
+				"extra": { "nested": [ 1, { "code": "X" } ], "items": [] },
+				"visRelease": "3-7a",
+				"items": [
+					{ "category": "PRODUCT", "type": "TYPE", "code": "A", "name": "a", "installSubstructure": false,
+					  "normalAssignmentNames": { "B": "b" }, "unknown": [ { "code": "Y" } ], "definition": null },
+					{ "category": "PRODUCT", "type": "TYPE", "name": "missing code" },
+					{ "category": "PRODUCT", "type": 1, "code": "C", "name": "c" },
+					[ "not", "a", "node" ],
+					{ "category": "PRODUCT", "type": "TYPE", "code": "D", "commonName": 3, "installSubstructure": "no",
+					  "normalAssignmentNames": { "E": 1 } },
+					{ "category": "PRODUCT", "type": "TYPE", "code": "F", "name": [ "f" ] }
+				],
+				"relations": [ [ "A", "D" ], [ "A", 1 ], "A", [], [ "D", "A" ] ]
+			})";
+
+			auto malformedParsed = GmodDto::tryParse( malformed );
+			ASSERT_TRUE( malformedParsed.has_value() );
+			ASSERT_EQ( 2u, malformedParsed->items().size() );
+			EXPECT_EQ( "A", malformedParsed->items()[0].code() );
+			EXPECT_EQ( "D", malformedParsed->items()[1].code() );
+			EXPECT_EQ( 2u, malformedParsed->relations().size() );
+			expectSame( GmodDto::fromJson( nlohmann::json::parse( malformed ) ), *malformedParsed );
+
+			EXPECT_FALSE( GmodDto::tryParse( R"({ "items": [] })" ).has_value() );
+			EXPECT_FALSE( GmodDto::tryParse( R"({ "visRelease": 3 })" ).has_value() );
+			EXPECT_FALSE( GmodDto::tryParse( R"({ "visRelease": "3-7a", "items": [ )" ).has_value() );
+			EXPECT_FALSE( GmodDto::tryParse( "[]" ).has_value() );
+		}
+
+		//----------------------------------------------
+		// Test_PathExistsBetween
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_PathExistsBetween )
+		{
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+
+			const std::vector<std::string> paths{
+				"411.1/C101.72/I101",
+				"1012.22/S201.1/C151.2/S110.2/C101.61/S203.2/S101",
+				"511.11/C101.663i/C663.5/CS6d",
+				"632.32i/S110.2/C111.42/G203.31/S90.5/C401" };
+
+			for ( const auto& item : paths )
+			{
+				GmodPath path = gmod.parsePath( item );
+				std::vector<const GmodNode*> nodes;
+				for ( size_t i = 0; i < path.length(); ++i )
+				{
+					nodes.push_back( path[i] );
+				}
+
+				/* Every prefix of the path reaches every later node of it, with the same result when memoized */
+				for ( size_t prefix = 1; prefix < nodes.size(); ++prefix )
+				{
+					const std::vector<const GmodNode*> fromPath( nodes.begin(), nodes.begin() + static_cast<std::ptrdiff_t>( prefix ) );
+					for ( size_t end = prefix; end < nodes.size(); ++end )
+					{
+						std::vector<const GmodNode*> remaining;
+						ASSERT_TRUE( GmodTraversal::pathExistsBetween( gmod, fromPath, *nodes[end], remaining ) ) << item << " " << prefix << " " << end;
+
+						std::vector<const GmodNode*> again;
+						ASSERT_TRUE( GmodTraversal::pathExistsBetween( gmod, fromPath, *nodes[end], again ) );
+						EXPECT_EQ( remaining, again ) << item << " " << prefix << " " << end;
+
+						for ( const GmodNode* node : remaining )
+						{
+							EXPECT_TRUE( std::none_of( fromPath.begin(), fromPath.end(), [node]( const GmodNode* p ) { return p->code() == node->code(); } ) )
+								<< item << " " << prefix << " " << end << " " << node->code();
+						}
+					}
+				}
+			}
+
+			/* A node outside of the asset function subtree is not reachable */
+			std::vector<const GmodNode*> remaining;
+			const std::vector<const GmodNode*> fromPath{ &gmod["VE"], &gmod["400a"], &gmod["410"], &gmod["411"], &gmod["411i"], &gmod["411.1"] };
+			EXPECT_FALSE( GmodTraversal::pathExistsBetween( gmod, fromPath, gmod["511.11"], remaining ) );
+			EXPECT_TRUE( remaining.empty() );
+			EXPECT_GT( gmod.pathExistsIndex().size(), 0u );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Hash_WideWord
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_Hash_WideWord )
+		{
+			if ( !internal::hasSSE42Support() )
+			{
+				GTEST_SKIP() << "SSE4.2 not available";
+			}
+
+			/* Byte-at-a-time reference: per 4-char chunk the 4 bytes then 4 zero bytes, per tail char the byte then a zero byte */
+			auto reference = []( std::string_view key ) {
+				uint32_t hashValue = 0x811C9DC5;
+				size_t i = 0;
+				for ( ; i + 4 <= key.size(); i += 4 )
+				{
+					for ( size_t j = 0; j < 4; ++j )
+					{
+						hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( key[i + j] ) );
+					}
+					for ( size_t j = 0; j < 4; ++j )
+					{
+						hashValue = internal::Hashing::crc32( hashValue, 0 );
+					}
+				}
+				for ( ; i < key.size(); ++i )
+				{
+					hashValue = internal::Hashing::crc32( hashValue, static_cast<uint8_t>( key[i] ) );
+					hashValue = internal::Hashing::crc32( hashValue, 0 );
+				}
+
+				return hashValue;
+			};
+
+			const std::string alphabet = "H346.11112/C101.31-2meta~\xff\x80";
+			for ( size_t length = 0; length <= alphabet.size(); ++length )
+			{
+				const std::string_view key{ alphabet.data(), length };
+				EXPECT_EQ( ChdDictionary<int>::hash( key ), reference( key ) ) << key;
+			}
+
+			auto [vis, gmod] = visAndGmod( VisVersion::v3_4a );
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				const std::string& code = enumerator.current().code();
+				ASSERT_EQ( ChdDictionary<int>::hash( code ), reference( code ) ) << code;
+			}
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_HashCollisions
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_HashCollisions )
+		{
+			/* Keys with the same full hash cannot be separated by any seed */
+			std::unordered_map<uint32_t, std::string> seen;
+			std::pair<std::string, std::string> colliding;
+			for ( size_t i = 0; colliding.first.empty(); ++i )
+			{
+				std::string key = fmt::format( "tag-{}", i );
+				auto [it, inserted] = seen.emplace( ChdDictionary<int>::hash( key ), key );
+				if ( !inserted )
+				{
+					colliding = { it->second, std::move( key ) };
+				}
+			}
+			ASSERT_EQ( ChdDictionary<int>::hash( colliding.first ), ChdDictionary<int>::hash( colliding.second ) );
+
+			auto items = [&colliding]() {
+				std::vector<std::pair<std::string, int>> result;
+				result.emplace_back( colliding.first, -1 );
+				for ( int i = 0; i < 100; ++i )
+				{
+					result.emplace_back( fmt::format( "C{}", i ), i );
+				}
+				result.emplace_back( colliding.second, -2 );
+
+				return result;
+			};
+
+			auto expectAllFound = [&items]( const ChdDictionary<int>& dict ) {
+				for ( const auto& [key, value] : items() )
+				{
+					const int* found = nullptr;
+					ASSERT_TRUE( dict.tryGetValue( key, found ) ) << key;
+					EXPECT_EQ( *found, value ) << key;
+				}
+
+				std::vector<std::string_view> keys{ std::string_view{ "missing" } };
+				auto source = items();
+				for ( const auto& [key, value] : source )
+				{
+					keys.push_back( key );
+				}
+				std::vector<const int*> values( keys.size() );
+				EXPECT_EQ( dict.tryGetValues( keys, values ), source.size() );
+				EXPECT_EQ( values[0], nullptr );
+				EXPECT_EQ( *values[1], -1 );
+				EXPECT_EQ( *values.back(), -2 );
+			};
+
+			const ChdDictionary<int> dict{ items() };
+			expectAllFound( dict );
+
+			const ChdDictionary<int> seeded{ items(), dict.seeds() };
+			expectAllFound( seeded );
+
+			auto duplicated = items();
+			duplicated.emplace_back( colliding.first, -3 );
+			EXPECT_THROW( ChdDictionary<int>{ std::move( duplicated ) }, std::invalid_argument );
+
+			/* A repeated collider resolves to the slot of the key it collides with */
+			auto duplicatedCollider = items();
+			duplicatedCollider.emplace_back( colliding.second, -3 );
+			EXPECT_THROW( ( ChdDictionary<int>{ std::move( duplicatedCollider ), dict.seeds() } ), std::invalid_argument );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Dictionary_DuplicateKeys
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_Dictionary_DuplicateKeys )
+		{
+			auto items = []() {
+				std::vector<std::pair<std::string, int>> result;
+				for ( int i = 0; i < 100; ++i )
+				{
+					result.emplace_back( fmt::format( "C{}", i ), i );
+				}
+
+				return result;
+			};
+
+			EXPECT_NO_THROW( ChdDictionary<int>{ items() } );
+
+			/* Rejected up front, instead of exhausting the seed search */
+			auto duplicated = items();
+			duplicated.emplace_back( "C42", -1 );
+			EXPECT_THROW( ChdDictionary<int>{ std::move( duplicated ) }, std::invalid_argument );
+
+			/* Reported as a duplicate by the precomputed-seed constructor too, not as a slot clash */
+			const ChdDictionary<int> dict{ items() };
+			auto seededDuplicate = items();
+			seededDuplicate.emplace_back( "C42", -1 );
+			try
+			{
+				const ChdDictionary<int> seeded{ std::move( seededDuplicate ), dict.seeds() };
+				FAIL() << "Expected std::invalid_argument";
+			}
+			catch ( const std::invalid_argument& ex )
+			{
+				EXPECT_NE( std::string_view{ ex.what() }.find( "Duplicate key 'C42'" ), std::string_view::npos ) << ex.what();
+			}
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Dictionary_Ignores_Interner
+		//----------------------------------------------
+
+		TEST_F( GmodTests, Test_Gmod_Dictionary_Ignores_Interner )
+		{
+			auto& interner = StringInterner::instance();
+			(void)interner.intern( "dictionary-key-interned" );
+			const size_t internedCount = interner.size();
+
+			std::vector<std::pair<std::string, int>> items;
+			items.emplace_back( "dictionary-key-interned", -1 );
+			for ( int i = 0; i < 100; ++i )
+			{
+				items.emplace_back( fmt::format( "dictionary-key-{}", i ), i );
+			}
+			const ChdDictionary<int> dict{ std::move( items ) };
+
+			/* Building a dictionary neither grows nor depends on the GMOD code interner */
+			EXPECT_EQ( interner.size(), internedCount );
+
+			const int* value = nullptr;
+			ASSERT_TRUE( dict.tryGetValue( std::string_view{ "dictionary-key-interned" }, value ) );
+			EXPECT_EQ( *value, -1 );
+
+			uint32_t keyId = 0;
+			EXPECT_FALSE( interner.tryGetId( "dictionary-key-42", keyId ) );
+			ASSERT_TRUE( dict.tryGetValue( std::string_view{ "dictionary-key-42" }, value ) );
+			EXPECT_EQ( *value, 42 );
+		}
 	}
 
 	namespace GmodTestsParametrized
@@ -490,6 +1153,427 @@ namespace dnv::vista::sdk::tests
 			ASSERT_FALSE( gmod.tryGetNode( std::string_view( "ag✅" ), tempNodePtr ) );
 		}
 
+		//----------------------------------------------
+		// Test_Gmod_Lookup_Batched
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_Lookup_Batched )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			const GmodDto& dto = vis.gmodDto( visVersion );
+
+			std::vector<std::string_view> codes;
+			for ( const GmodNodeDto& nodeDto : dto.items() )
+			{
+				codes.push_back( nodeDto.code() );
+			}
+			const size_t expectedFound = codes.size();
+
+			/* Misses inserted at indices 3, 10, 17, ... ( i * 7 + 3 ) so that the first batches mix hits and misses */
+			const std::array<std::string_view, 6> misses{ "", "ABC", "VE.", "400a/", "not-a-code", "H346.111120" };
+			for ( size_t i = 0; i < misses.size(); ++i )
+			{
+				codes.insert( codes.begin() + static_cast<std::ptrdiff_t>( i * 7 + 3 ), misses[i] );
+			}
+
+			std::vector<const GmodNode*> nodes( codes.size() );
+			EXPECT_EQ( gmod.tryGetNodes( codes, nodes ), expectedFound );
+
+			for ( size_t i = 0; i < codes.size(); ++i )
+			{
+				const GmodNode* expected = nullptr;
+				const bool found = gmod.tryGetNode( codes[i], expected );
+				EXPECT_EQ( nodes[i], found ? expected : nullptr ) << codes[i];
+			}
+
+			EXPECT_EQ( gmod.tryGetNodes( {}, {} ), 0u );
+
+			std::vector<const GmodNode*> tooShort( codes.size() - 1 );
+			EXPECT_THROW( (void)gmod.tryGetNodes( codes, tooShort ), std::invalid_argument );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Lookup_ByCodeId
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_Lookup_ByCodeId )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+			const auto& latestGmod = vis.gmod( vis.latestVisVersion() );
+
+			auto& interner = StringInterner::instance();
+
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				const GmodNode& node = enumerator.current();
+
+				uint32_t codeId = StringInterner::NPOS;
+				ASSERT_TRUE( interner.tryGetId( node.code(), codeId ) ) << node.code();
+				ASSERT_EQ( codeId, node.codeId() );
+				ASSERT_EQ( interner.string( codeId ), node.code() );
+				ASSERT_EQ( interner.intern( node.code() ), codeId );
+
+				const GmodNode* byId = nullptr;
+				ASSERT_TRUE( gmod.tryGetNode( codeId, byId ) );
+				ASSERT_EQ( byId, &node );
+
+				/* Ids are shared across versions */
+				const GmodNode* byCode = nullptr;
+				const GmodNode* latestById = nullptr;
+				const bool inLatest = latestGmod.tryGetNode( node.code(), byCode );
+				ASSERT_EQ( latestGmod.tryGetNode( codeId, latestById ), inLatest ) << node.code();
+				ASSERT_EQ( latestById, inLatest ? byCode : nullptr );
+
+				for ( const auto* child : node.children() )
+				{
+					ASSERT_TRUE( node.isChild( child->codeId() ) );
+					ASSERT_TRUE( node.isChild( child->code() ) );
+				}
+			}
+
+			const GmodNode* node = nullptr;
+			EXPECT_FALSE( gmod.tryGetNode( StringInterner::NPOS, node ) );
+			EXPECT_EQ( node, nullptr );
+
+			uint32_t unknownId = 0;
+			EXPECT_FALSE( interner.tryGetId( "NOT-A-GMOD-CODE", unknownId ) );
+			EXPECT_EQ( unknownId, StringInterner::NPOS );
+			EXPECT_FALSE( gmod.rootNode().isChild( std::string{ "NOT-A-GMOD-CODE" } ) );
+
+			const uint32_t internedId = interner.intern( "NOT-A-GMOD-CODE-INTERNED" );
+			EXPECT_FALSE( gmod.tryGetNode( internedId, node ) );
+			EXPECT_FALSE( gmod.rootNode().isChild( internedId ) );
+			EXPECT_THROW( (void)interner.string( static_cast<uint32_t>( interner.size() ) ), std::out_of_range );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Graph
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_Graph )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			const internal::GmodGraph* graph = gmod.rootNode().graph();
+			ASSERT_NE( graph, nullptr );
+			ASSERT_EQ( graph->nodes.size(), graph->flags.size() );
+			ASSERT_EQ( graph->childOffsets.size(), graph->nodes.size() + 1 );
+			ASSERT_EQ( graph->parentOffsets.size(), graph->nodes.size() + 1 );
+
+			using Flags = internal::GmodNodeFlags;
+
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			size_t count = 0;
+			while ( enumerator.next() )
+			{
+				const GmodNode& node = enumerator.current();
+				++count;
+
+				ASSERT_EQ( node.graph(), graph );
+				const uint32_t index = node.graphIndex();
+				ASSERT_EQ( graph->nodes[index], &node );
+
+				/* Children in GMOD order, parents as linked */
+				const auto children = graph->childrenOf( index );
+				ASSERT_EQ( children.size(), node.children().size() ) << node.code();
+				for ( size_t i = 0; i < children.size(); ++i )
+				{
+					ASSERT_EQ( graph->nodes[children[i]], node.children()[i] );
+					ASSERT_TRUE( graph->isChild( index, node.children()[i]->codeId() ) );
+				}
+
+				const auto parents = graph->parentsOf( index );
+				ASSERT_EQ( parents.size(), node.parents().size() ) << node.code();
+				for ( size_t i = 0; i < parents.size(); ++i )
+				{
+					ASSERT_EQ( graph->nodes[parents[i]], node.parents()[i] );
+					ASSERT_TRUE( node.parents()[i]->isChild( node ) );
+				}
+
+				const uint16_t flags = graph->flags[index];
+				ASSERT_EQ( ( flags & Flags::PRODUCT_SELECTION ) != 0, node.isProductSelection() );
+				ASSERT_EQ( ( flags & Flags::PRODUCT_TYPE ) != 0, node.isProductType() );
+				ASSERT_EQ( ( flags & Flags::ASSET ) != 0, node.isAsset() );
+				ASSERT_EQ( ( flags & Flags::FUNCTION_NODE ) != 0, node.isFunctionNode() );
+				ASSERT_EQ( ( flags & Flags::ASSET_FUNCTION_NODE ) != 0, node.isAssetFunctionNode() );
+				ASSERT_EQ( ( flags & Flags::LEAF_NODE ) != 0, node.isLeafNode() );
+				ASSERT_EQ( ( flags & Flags::FUNCTION_COMPOSITION ) != 0, node.isFunctionComposition() );
+				ASSERT_EQ( ( flags & Flags::ROOT ) != 0, node.isRoot() );
+
+				for ( const auto* child : node.children() )
+				{
+					ASSERT_EQ( graph->isProductSelectionAssignment( index, child->graphIndex() ),
+						Gmod::isProductSelectionAssignment( &node, child ) );
+				}
+			}
+			EXPECT_EQ( count, graph->nodes.size() );
+
+			/* Membership is decided by the sorted child range only */
+			const GmodNode& root = gmod.rootNode();
+			for ( const auto* child : root.children() )
+			{
+				EXPECT_FALSE( child->isChild( root ) );
+			}
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_ReachLabels
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_ReachLabels )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			const internal::GmodGraph& graph = *gmod.rootNode().graph();
+			const auto nodeCount = static_cast<uint32_t>( graph.nodes.size() );
+			ASSERT_EQ( graph.reach.size(), nodeCount );
+
+			/* Labels may only reject pairs that are really unreachable */
+			std::vector<uint32_t> stamp( nodeCount, std::numeric_limits<uint32_t>::max() );
+			std::vector<uint32_t> pending;
+			size_t rejected = 0;
+			for ( uint32_t from = 0; from < nodeCount; ++from )
+			{
+				stamp[from] = from;
+				pending.assign( 1, from );
+				while ( !pending.empty() )
+				{
+					const uint32_t current = pending.back();
+					pending.pop_back();
+					ASSERT_TRUE( graph.mayReach( from, current ) ) << graph.nodes[from]->code() << " -> " << graph.nodes[current]->code();
+
+					for ( const uint32_t child : graph.childrenOf( current ) )
+					{
+						if ( stamp[child] != from )
+						{
+							stamp[child] = from;
+							pending.push_back( child );
+						}
+					}
+				}
+
+				for ( uint32_t to = 0; to < nodeCount; to += 97 )
+				{
+					rejected += ( stamp[to] != from && !graph.mayReach( from, to ) ) ? 1 : 0;
+				}
+			}
+
+			EXPECT_GT( rejected, 0u );
+			const uint32_t root = gmod.rootNode().graphIndex();
+			EXPECT_TRUE( graph.mayReach( root, gmod["C101"].graphIndex() ) );
+			EXPECT_FALSE( graph.mayReach( gmod["C101"].graphIndex(), root ) );
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_Node_Classification
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_Node_Classification )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			/* Reference predicates, comparing the metadata strings on every call */
+			auto contains = []( const std::string& str, std::string_view part ) { return str.find( part ) != std::string::npos; };
+			auto isProductType = []( const GmodNode& n ) { return n.metadata().category() == "PRODUCT" && n.metadata().type() == "TYPE"; };
+			auto isComposition = []( const GmodNode& n ) {
+				const auto& category = n.metadata().category();
+				return ( category == "ASSET FUNCTION" || category == "PRODUCT FUNCTION" ) && n.metadata().type() == "COMPOSITION";
+			};
+			auto productType = [&]( const GmodNode& n ) -> const GmodNode* {
+				if ( n.children().size() != 1 || !contains( n.metadata().category(), "FUNCTION" ) )
+					return nullptr;
+				const GmodNode* child = n.children()[0];
+				return isProductType( *child ) ? child : nullptr;
+			};
+			auto productSelection = [&]( const GmodNode& n ) -> const GmodNode* {
+				if ( n.children().size() != 1 || !contains( n.metadata().category(), "FUNCTION" ) )
+					return nullptr;
+				const GmodNode* child = n.children()[0];
+				return contains( child->metadata().category(), "PRODUCT" ) && child->metadata().type() == "SELECTION" ? child : nullptr;
+			};
+			auto isIndividualizable = [&]( const GmodNode& n, bool isTargetNode, bool isInSet ) {
+				const auto& type = n.metadata().type();
+				if ( type == "GROUP" || type == "SELECTION" || isProductType( n ) )
+					return false;
+				if ( n.metadata().category() == "ASSET" && type == "TYPE" )
+					return false;
+				if ( isComposition( n ) )
+					return !n.code().empty() && ( n.code().back() == 'i' || isInSet || isTargetNode );
+				return true;
+			};
+			auto isMappable = [&]( const GmodNode& n ) {
+				if ( productType( n ) || productSelection( n ) )
+					return false;
+				if ( contains( n.metadata().category(), "PRODUCT" ) && n.metadata().type() == "SELECTION" )
+					return false;
+				if ( n.metadata().category() == "ASSET" || n.code().empty() )
+					return false;
+				return n.code().back() != 'a' && n.code().back() != 's';
+			};
+
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				const GmodNode& node = enumerator.current();
+				const auto& metadata = node.metadata();
+				const auto& category = metadata.category();
+
+				ASSERT_EQ( node.isProductSelection(), category == "PRODUCT" && metadata.type() == "SELECTION" ) << node.code();
+				ASSERT_EQ( node.isProductType(), isProductType( node ) ) << node.code();
+				ASSERT_EQ( node.isAsset(), category == "ASSET" ) << node.code();
+				ASSERT_EQ( node.isFunctionNode(), category != "PRODUCT" && category != "ASSET" ) << node.code();
+				ASSERT_EQ( node.isAssetFunctionNode(), category == "ASSET FUNCTION" ) << node.code();
+				ASSERT_EQ( node.isLeafNode(), metadata.fullType() == "ASSET FUNCTION LEAF" || metadata.fullType() == "PRODUCT FUNCTION LEAF" ) << node.code();
+				ASSERT_EQ( node.isFunctionComposition(), isComposition( node ) ) << node.code();
+				ASSERT_EQ( node.isRoot(), node.code() == "VE" ) << node.code();
+				ASSERT_EQ( ( node.flags() & internal::GmodNodeFlags::POTENTIAL_PARENT ) != 0, Gmod::isPotentialParent( metadata.type() ) ) << node.code();
+
+				ASSERT_EQ( Gmod::isLeafNode( metadata ), node.isLeafNode() );
+				ASSERT_EQ( Gmod::isFunctionNode( metadata ), node.isFunctionNode() );
+				ASSERT_EQ( Gmod::isProductSelection( metadata ), node.isProductSelection() );
+				ASSERT_EQ( Gmod::isProductType( metadata ), node.isProductType() );
+				ASSERT_EQ( Gmod::isAsset( metadata ), node.isAsset() );
+				ASSERT_EQ( Gmod::isAssetFunctionNode( metadata ), node.isAssetFunctionNode() );
+
+				for ( bool isTargetNode : { false, true } )
+				{
+					for ( bool isInSet : { false, true } )
+					{
+						ASSERT_EQ( node.isIndividualizable( isTargetNode, isInSet ), isIndividualizable( node, isTargetNode, isInSet ) ) << node.code();
+					}
+				}
+
+				ASSERT_EQ( node.productType(), productType( node ) ) << node.code();
+				ASSERT_EQ( node.productSelection(), productSelection( node ) ) << node.code();
+				ASSERT_EQ( node.isMappable(), isMappable( node ) ) << node.code();
+
+				for ( const auto* child : node.children() )
+				{
+					const bool parentIsFunction = contains( category, "FUNCTION" );
+					ASSERT_EQ( Gmod::isProductTypeAssignment( &node, child ), parentIsFunction && isProductType( *child ) );
+					ASSERT_EQ( Gmod::isProductSelectionAssignment( &node, child ),
+						parentIsFunction && contains( child->metadata().category(), "PRODUCT" ) && child->metadata().type() == "SELECTION" );
+				}
+
+				/* Copies share the cached classification */
+				const GmodNode copy = node.withLocation( "1" );
+				ASSERT_EQ( copy.flags(), node.flags() );
+				ASSERT_EQ( copy.productType(), node.productType() );
+			}
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_ParallelConstruction
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_ParallelConstruction )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			const GmodDto& dto = vis.gmodDto( visVersion );
+
+			auto items = [&dto]( size_t syntheticCount ) {
+				std::vector<std::pair<std::string, int>> result;
+				for ( const GmodNodeDto& nodeDto : dto.items() )
+				{
+					result.emplace_back( nodeDto.code(), static_cast<int>( result.size() ) );
+				}
+				for ( size_t i = 0; i < syntheticCount; ++i )
+				{
+					result.emplace_back( fmt::format( "tag-{}", i ), static_cast<int>( result.size() ) );
+				}
+
+				return result;
+			};
+
+			for ( size_t syntheticCount : { size_t{ 0 }, size_t{ 50000 } } )
+			{
+				ASSERT_GE( items( syntheticCount ).size(), ChdDictionary<int>::PARALLEL_CONSTRUCTION_THRESHOLD );
+
+				const ChdDictionary<int> sequential( items( syntheticCount ), ChdConstructionMode::Sequential );
+				/* Explicit thread count so that the speculative path also runs on single-core machines */
+				const ChdDictionary<int> parallel( items( syntheticCount ), ChdConstructionMode::Parallel, 4 );
+
+				/* Identical layout: same seeds and same slot for every key */
+				ASSERT_EQ( parallel.seeds(), sequential.seeds() );
+
+				auto sequentialIt = sequential.begin();
+				auto parallelIt = parallel.begin();
+				for ( ; sequentialIt != sequential.end() && parallelIt != parallel.end(); ++sequentialIt, ++parallelIt )
+				{
+					ASSERT_EQ( parallelIt.index(), sequentialIt.index() );
+					ASSERT_EQ( parallelIt->first, sequentialIt->first );
+					ASSERT_EQ( parallelIt->second, sequentialIt->second );
+				}
+				EXPECT_TRUE( sequentialIt == sequential.end() );
+				EXPECT_TRUE( parallelIt == parallel.end() );
+
+				for ( const auto& [key, value] : items( syntheticCount ) )
+				{
+					const int* found = nullptr;
+					ASSERT_TRUE( parallel.tryGetValue( key, found ) ) << key;
+					ASSERT_EQ( *found, value );
+				}
+			}
+		}
+
+		//----------------------------------------------
+		// Test_Gmod_PrecomputedSeeds
+		//----------------------------------------------
+
+		TEST_P( GmodTests, Test_Gmod_PrecomputedSeeds )
+		{
+			auto visVersion = GetParam();
+			auto [vis, gmod] = visAndGmod( visVersion );
+
+			const GmodDto& dto = vis.gmodDto( visVersion );
+
+			std::vector<std::pair<std::string, int>> items;
+			for ( const GmodNodeDto& nodeDto : dto.items() )
+			{
+				items.emplace_back( nodeDto.code(), 0 );
+			}
+			const ChdDictionary<int> reference{ std::move( items ) };
+
+			const auto path = std::filesystem::temp_directory_path() /
+							  ChdSeedTable::fileName( "vista-sdk-test-gmod-" + VisVersionExtensions::toVersionString( visVersion ) );
+			ChdSeedTable::write( path, reference.seeds(), dto.items().size() );
+
+			std::vector<int> seeds;
+			ASSERT_TRUE( ChdSeedTable::tryRead( path, dto.items().size(), seeds ) );
+			EXPECT_EQ( seeds, reference.seeds() );
+			EXPECT_FALSE( ChdSeedTable::tryRead( path, dto.items().size() + 1, seeds ) );
+			EXPECT_TRUE( seeds.empty() );
+			std::filesystem::remove( path );
+
+			const Gmod seeded{ visVersion, dto, reference.seeds() };
+			Gmod::Enumerator enumerator = gmod.enumerator();
+			while ( enumerator.next() )
+			{
+				const GmodNode& expected = enumerator.current();
+
+				const GmodNode* actual = nullptr;
+				ASSERT_TRUE( seeded.tryGetNode( expected.code(), actual ) ) << expected.code();
+				EXPECT_EQ( actual->code(), expected.code() );
+				EXPECT_EQ( actual->children().size(), expected.children().size() );
+				EXPECT_EQ( actual->parents().size(), expected.parents().size() );
+			}
+
+			const std::vector<int> zeroSeeds( reference.seeds().size(), 0 );
+			EXPECT_THROW( ( Gmod{ visVersion, dto, zeroSeeds } ), std::invalid_argument );
+
+			const std::vector<int> shortSeeds( 3, 0 );
+			EXPECT_THROW( ( Gmod{ visVersion, dto, shortSeeds } ), std::invalid_argument );
+		}
+
 		//----------------------------------------------
 		// Test_Gmod_RootNode_Children
 		//----------------------------------------------
@@ -9,6 +9,7 @@
 
 #include "dnv/vista/sdk/Gmod.h"
 #include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/GmodTraversal.h"
 #include "dnv/vista/sdk/VIS.h"
 
 namespace dnv::vista::sdk::tests
@@ -190,6 +191,76 @@ namespace dnv::vista::sdk::tests
 			GmodPathParseValidTest,
 			::testing::ValuesIn( loadValidGmodPathData() ) );
 
+		//----------------------------------------------
+		// Test_GmodPath_Parse_MatchesTraversal
+		//----------------------------------------------
+
+		struct ReferenceSearch
+		{
+			std::vector<std::string> codes;
+			size_t next = 0;
+			std::vector<std::string> found;
+		};
+
+		TEST_P( GmodPathParseValidTest, Test_GmodPath_Parse_MatchesTraversal )
+		{
+			const auto& param = GetParam();
+
+			VisVersion visVersion = VisVersionExtensions::parse( param.visVersionString );
+			const Gmod& gmod = m_vis.gmod( visVersion );
+
+			/* Reference: the first match of each part in a full depth-first traversal from the first part */
+			ReferenceSearch search;
+			std::stringstream parts( param.pathString );
+			std::string part;
+			while ( std::getline( parts, part, '/' ) )
+			{
+				search.codes.push_back( part.substr( 0, part.find( '-' ) ) );
+			}
+
+			TraverseHandlerWithState<ReferenceSearch> handler =
+				[]( ReferenceSearch& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+				if ( node.code() != state.codes[state.next] )
+				{
+					return node.isLeafNode() ? TraversalHandlerResult::SkipSubtree : TraversalHandlerResult::Continue;
+				}
+				if ( ++state.next < state.codes.size() )
+				{
+					return TraversalHandlerResult::Continue;
+				}
+				for ( const GmodNode* parent : parents )
+				{
+					state.found.push_back( parent->code() );
+				}
+				state.found.push_back( node.code() );
+
+				return TraversalHandlerResult::Stop;
+			};
+			(void)GmodTraversal::traverse( search, gmod[search.codes.front()], handler );
+			ASSERT_FALSE( search.found.empty() );
+
+			GmodPath path = GmodPath::parse( param.pathString, visVersion );
+			std::vector<std::string> resolved;
+			for ( const GmodNode* parent : path.parents() )
+			{
+				resolved.push_back( parent->code() );
+			}
+			resolved.push_back( path.node()->code() );
+
+			/* The parser only prepends the unique parent chain above the traversal result */
+			ASSERT_GE( resolved.size(), search.found.size() );
+			const size_t prefix = resolved.size() - search.found.size();
+			ASSERT_TRUE( std::equal( search.found.begin(), search.found.end(), resolved.begin() + static_cast<ptrdiff_t>( prefix ) ) ) << path.toFullPathString();
+			if ( prefix > 0 )
+			{
+				ASSERT_EQ( resolved.front(), gmod.rootNode().code() );
+			}
+			for ( size_t i = 1; i < prefix; ++i )
+			{
+				ASSERT_EQ( path.parents()[i]->parents().size(), 1 ) << path.toFullPathString();
+			}
+		}
+
 		//----------------------------------------------
 		// Test_GmodPath_Parse_Invalid
 		//----------------------------------------------
@@ -632,5 +703,407 @@ namespace dnv::vista::sdk::tests
 				"VE/800a/840/846/G203/G203.3-2/G203.32-2/S110/S110.2-1/CS1/E31",
 				path.toFullPathString() );
 		}
+
+		//----------------------------------------------
+		// Test_GmodPath_Stores_Located_Nodes
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_GmodPath_Stores_Located_Nodes )
+		{
+			VisVersion version = VisVersion::v3_7a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+
+			GmodPath first = gmod.parsePath( "511.11-1/C101.663i-1/C663" );
+			GmodPath second = gmod.parsePath( "511.11-1/C101.663i-1/C663" );
+			GmodPath full = gmod.parseFromFullPath( first.toFullPathString() );
+
+			const GmodPath copy = first;
+
+			ASSERT_EQ( first.length(), second.length() );
+			ASSERT_EQ( first.length(), full.length() );
+			ASSERT_EQ( first.locatedNodes().size(), first.length() );
+			for ( size_t i = 0; i < first.length(); ++i )
+			{
+				/* Copies and separately parsed paths hold equal handles to the Gmod's nodes */
+				EXPECT_EQ( first.locatedNodes()[i], copy.locatedNodes()[i] ) << i;
+				EXPECT_EQ( first.locatedNodes()[i], second.locatedNodes()[i] ) << i;
+				EXPECT_EQ( first.locatedNodes()[i], full.locatedNodes()[i] ) << i;
+				EXPECT_EQ( *first[i], *copy[i] ) << i;
+				EXPECT_EQ( first[i]->codeId(), second[i]->codeId() ) << i;
+				EXPECT_EQ( first[i]->location(), second[i]->location() ) << i;
+				EXPECT_EQ( first[i]->codeId(), full[i]->codeId() ) << i;
+				EXPECT_EQ( first[i]->location(), full[i]->location() ) << i;
+
+				const GmodNode* base = nullptr;
+				ASSERT_TRUE( gmod.tryGetNode( first[i]->codeId(), base ) );
+				EXPECT_FALSE( base->location().has_value() );
+				EXPECT_EQ( &first.locatedNodes()[i].node(), base ) << i;
+				EXPECT_EQ( first.locatedNodes()[i].location(), first[i]->location() ) << i;
+				if ( !first[i]->location().has_value() )
+				{
+					EXPECT_EQ( first[i], base ) << i;
+				}
+
+				/* Located nodes are created once per path */
+				const GmodNode* node = first[i];
+				EXPECT_EQ( first[i], node ) << i;
+				if ( i + 1 < first.length() )
+				{
+					EXPECT_EQ( first.parents()[i], node ) << i;
+				}
+				else
+				{
+					EXPECT_EQ( first.node(), node );
+				}
+			}
+
+			EXPECT_EQ( first, second );
+			EXPECT_EQ( first.hashCode(), second.hashCode() );
+			EXPECT_EQ( first, full );
+			EXPECT_EQ( first.hashCode(), full.hashCode() );
+
+			GmodPath other = gmod.parsePath( "511.11-2/C101.663i-2/C663" );
+			EXPECT_NE( first, other );
+			EXPECT_NE( first.hashCode(), other.hashCode() );
+			EXPECT_EQ( first.withoutLocations(), other.withoutLocations() );
+			EXPECT_EQ( first.withoutLocations().hashCode(), other.withoutLocations().hashCode() );
+		}
+
+		//----------------------------------------------
+		// Test_GmodPath_Constructors
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_GmodPath_Constructors )
+		{
+			VisVersion version = VisVersion::v3_7a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+
+			const GmodPath path = gmod.parsePath( "511.11-1/C101.663i-1/C663" );
+
+			const std::vector<GmodNode*>& parents = path.parents();
+			EXPECT_TRUE( GmodPath::isValid( parents, *path.node() ) );
+			EXPECT_EQ( path, GmodPath( gmod, path.node(), parents ) );
+			EXPECT_EQ( path, GmodPath( gmod, path.locatedNodes() ) );
+
+			int missingLinkAt;
+			EXPECT_TRUE( GmodPath::isValid( path.locatedNodes(), missingLinkAt ) );
+			EXPECT_EQ( missingLinkAt, -1 );
+
+			const std::span<const GmodLocatedNode> nodes = path.locatedNodes();
+			std::vector<GmodLocatedNode> withoutRoot( nodes.begin() + 1, nodes.end() );
+			EXPECT_FALSE( GmodPath::isValid( withoutRoot, missingLinkAt ) );
+			EXPECT_THROW( GmodPath( gmod, withoutRoot ), std::invalid_argument );
+			EXPECT_THROW( GmodPath( gmod, std::span<const GmodLocatedNode>{} ), std::invalid_argument );
+
+			/* Threads reading the same path get the same nodes */
+			const GmodPath shared = path;
+			std::vector<std::future<const std::vector<GmodNode*>*>> readers;
+			for ( size_t i = 0; i < 4; ++i )
+			{
+				readers.push_back( std::async( std::launch::async, [&shared]() { return &shared.parents(); } ) );
+			}
+			for ( auto& reader : readers )
+			{
+				EXPECT_EQ( reader.get(), &shared.parents() );
+			}
+		}
+
+		//----------------------------------------------
+		// Test_GmodPath_Copies_Are_Independent
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_GmodPath_Copies_Are_Independent )
+		{
+			VisVersion version = VisVersion::v3_7a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+			const std::string expected = "VE/800a/840/846/G203/G203.3-2/G203.32-2/S110/S110.2-1/CS1/E31";
+
+			GmodPath assigned = gmod.parsePath( "411.1/C101.72/I101" );
+			std::optional<GmodPath> copied;
+			{
+				GmodPath source = gmod.parsePath( "846/G203.32-2/S110.2-1/E31" );
+				assigned = source;
+				copied.emplace( source );
+
+				for ( size_t i = 0; i < source.length(); ++i )
+				{
+					EXPECT_EQ( assigned.locatedNodes()[i], source.locatedNodes()[i] ) << i;
+					EXPECT_EQ( *assigned[i], *source[i] ) << i;
+				}
+
+				source = gmod.parsePath( "411.1/C101.72/I101" );
+			}
+
+			EXPECT_EQ( expected, assigned.toFullPathString() );
+			EXPECT_EQ( expected, copied->toFullPathString() );
+			EXPECT_EQ( assigned, *copied );
+
+			GmodPath moved = std::move( assigned );
+			EXPECT_EQ( expected, moved.toFullPathString() );
+		}
+
+		//----------------------------------------------
+		// Test_GmodPath_Deep_Path
+		//----------------------------------------------
+
+		struct DeepPathSearch
+		{
+			std::vector<GmodNode*> parents;
+			GmodNode* node = nullptr;
+		};
+
+		TEST( GmodPathTest, Test_GmodPath_Deep_Path )
+		{
+			VisVersion version = VisVersion::v3_7a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+
+			/* Find a path with more parents than are stored inline */
+			DeepPathSearch search;
+			TraverseHandlerWithState<DeepPathSearch> handler =
+				[]( DeepPathSearch& state, const std::vector<const GmodNode*>& parents, const GmodNode& node ) -> TraversalHandlerResult {
+				if ( parents.size() <= GmodPath::INLINE_PARENTS_CAPACITY )
+				{
+					return TraversalHandlerResult::Continue;
+				}
+				for ( const GmodNode* parent : parents )
+				{
+					state.parents.push_back( const_cast<GmodNode*>( parent ) );
+				}
+				state.node = const_cast<GmodNode*>( &node );
+
+				return TraversalHandlerResult::Stop;
+			};
+			(void)GmodTraversal::traverse( search, gmod, handler );
+			ASSERT_NE( search.node, nullptr );
+
+			GmodPath shallow = gmod.parsePath( "411.1/C101.72/I101" );
+			std::optional<GmodPath> deep;
+			deep.emplace( gmod, search.node, search.parents );
+
+			GmodPath copy = *deep;
+			deep = shallow;
+
+			EXPECT_GT( copy.parents().size(), GmodPath::INLINE_PARENTS_CAPACITY );
+			EXPECT_EQ( copy.node(), search.node );
+			EXPECT_EQ( copy, GmodPath::parseFullPath( copy.toFullPathString(), version ) );
+			EXPECT_EQ( shallow, *deep );
+			EXPECT_EQ( shallow.toFullPathString(), deep->toFullPathString() );
+		}
+
+		//----------------------------------------------
+		// Test_IndividualizableSet_SetLocation_Does_Not_Modify_Gmod
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_IndividualizableSet_SetLocation_Does_Not_Modify_Gmod )
+		{
+			VisVersion version = VisVersion::v3_7a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+			const Locations& locations = VIS::instance().locations( version );
+
+			GmodPath path = gmod.parsePath( "411.1/C101.72/I101" );
+			std::vector<GmodIndividualizableSet> sets = path.individualizableSets();
+			ASSERT_FALSE( sets.empty() );
+
+			sets[0].setLocation( locations.parse( "2" ) );
+			GmodPath located = sets[0].build();
+
+			EXPECT_NE( path, located );
+			EXPECT_EQ( path, located.withoutLocations() );
+			for ( size_t i = 0; i < path.length(); ++i )
+			{
+				EXPECT_FALSE( path[i]->location().has_value() ) << i;
+				EXPECT_FALSE( gmod[path[i]->code()].location().has_value() ) << i;
+			}
+			EXPECT_EQ( located, gmod.parsePath( located.toString() ) );
+		}
+
+		//----------------------------------------------
+		// Test_FullPath_Parse_Reports_First_Invalid_Segment
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_FullPath_Parse_Reports_First_Invalid_Segment )
+		{
+			VisVersion version = VisVersion::v3_4a;
+
+			auto errorOf = [version]( std::string_view item ) -> std::string {
+				try
+				{
+					(void)GmodPath::parseFullPath( item, version );
+				}
+				catch ( const std::invalid_argument& ex )
+				{
+					return ex.what();
+				}
+
+				return {};
+			};
+
+			EXPECT_EQ( errorOf( "VE/400a/XXX/411-Q/411i" ), "Failed to get GmodNode for XXX" );
+			EXPECT_EQ( errorOf( "VE/400a-Q/XXX/411i" ), "Failed to parse location - Q" );
+			EXPECT_NE( errorOf( "VE/400a//410" ).find( "contains an empty segment" ), std::string::npos );
+			EXPECT_NE( errorOf( "VE/400a/411" ).find( "Sequence of nodes is invalid" ), std::string::npos );
+		}
+
+		//----------------------------------------------
+		// Test_FullPath_Parse_Uses_Gmod_Nodes
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_FullPath_Parse_Uses_Gmod_Nodes )
+		{
+			VisVersion version = VisVersion::v3_4a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+			const Locations& locations = VIS::instance().locations( version );
+
+			std::optional<GmodPath> path;
+			ASSERT_TRUE( GmodPath::tryParseFullPath(
+				"VE/600a/610/612/612.2/612.2i/612.21-1/CS10/C701/C701.1/C701.13/S93", gmod, locations, path ) );
+
+			for ( size_t i = 0; i < path->length(); ++i )
+			{
+				const GmodNode* node = ( *path )[i];
+				if ( !node->location().has_value() )
+				{
+					EXPECT_EQ( node, &gmod[node->code()] ) << i;
+					continue;
+				}
+
+				/* Located nodes are copies owned by the path, linked like the Gmod's node */
+				EXPECT_NE( node, &gmod[node->code()] ) << i;
+				EXPECT_EQ( node->graph(), gmod.rootNode().graph() ) << i;
+				EXPECT_EQ( node->graphIndex(), gmod[node->code()].graphIndex() ) << i;
+				EXPECT_EQ( node->location()->toString(), "1" ) << i;
+			}
+
+			std::optional<GmodPath> again;
+			ASSERT_TRUE( GmodPath::tryParseFullPath( path->toFullPathString(), gmod, locations, again ) );
+			EXPECT_EQ( *path, *again );
+			EXPECT_EQ( path->hashCode(), again->hashCode() );
+
+			/* Copies hold the same handles; each path owns the located nodes it hands out */
+			std::optional<GmodPath> copy = *path;
+			ASSERT_EQ( ( *path )[6]->code(), "612.21" );
+			ASSERT_TRUE( ( *path )[6]->location().has_value() );
+			EXPECT_EQ( copy->locatedNodes()[6], path->locatedNodes()[6] );
+			path.reset();
+			const GmodNode* locatedNode = ( *copy )[6];
+			EXPECT_EQ( locatedNode->code(), "612.21" );
+			EXPECT_EQ( locatedNode->location()->toString(), "1" );
+
+			/* Changing the location of a set leaves the other copies as they were */
+			GmodPath relocated = *copy;
+			auto sets = relocated.individualizableSets();
+			ASSERT_FALSE( sets.empty() );
+			sets[0].setLocation( locations.parse( "2" ) );
+			const GmodPath built = sets[0].build();
+			EXPECT_EQ( ( *copy )[6], locatedNode );
+			EXPECT_EQ( locatedNode->location()->toString(), "1" );
+			EXPECT_NE( built, *copy );
+			EXPECT_EQ( built.withoutLocations(), copy->withoutLocations() );
+		}
+
+		//----------------------------------------------
+		// Test_GmodPath_TryParseMany
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_GmodPath_TryParseMany )
+		{
+			VisVersion version = VisVersion::v3_4a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+			const Locations& locations = VIS::instance().locations( version );
+
+			std::vector<std::string> paths;
+			for ( const auto& param : GmodPathTestsParametrized::loadValidGmodPathData() )
+			{
+				paths.push_back( param.pathString );
+			}
+			for ( const auto& param : GmodPathTestsParametrized::loadInvalidGmodPathData() )
+			{
+				paths.push_back( param.pathString );
+			}
+
+			/* Enough items for several chunks per worker */
+			std::vector<std::string_view> items;
+			while ( items.size() < 2000 )
+			{
+				items.insert( items.end(), paths.begin(), paths.end() );
+			}
+
+			std::atomic<size_t> executorWorkers{ 0 };
+			GmodPathParseOptions defaults{};
+			EXPECT_EQ( defaults.threadCount, ParallelTraversalOptions{}.threadCount );
+			GmodPathParseOptions inline1{};
+			inline1.threadCount = 1;
+			GmodPathParseOptions threads4{};
+			threads4.threadCount = 4;
+			GmodPathParseOptions executor{};
+			executor.threadCount = 3;
+			executor.executor = [&executorWorkers]( size_t workerCount, const std::function<void( size_t )>& task ) {
+				/* Only runs the last worker; the others' chunks have to be stolen */
+				executorWorkers = workerCount;
+				task( workerCount - 1 );
+			};
+
+			for ( const GmodPathParseOptions* options : { &defaults, &inline1, &threads4, &executor } )
+			{
+				std::vector<GmodPathParseOutcome> outcomes = GmodPath::tryParseMany( items, gmod, locations, *options );
+				ASSERT_EQ( outcomes.size(), items.size() );
+
+				for ( size_t i = 0; i < items.size(); ++i )
+				{
+					std::optional<GmodPath> expected;
+					bool parsed = GmodPath::tryParse( items[i], gmod, locations, expected );
+
+					ASSERT_EQ( outcomes[i].path.has_value(), parsed ) << items[i];
+					ASSERT_EQ( outcomes[i].error.empty(), parsed ) << items[i];
+					if ( parsed )
+					{
+						ASSERT_EQ( *outcomes[i].path, *expected ) << items[i];
+					}
+				}
+			}
+			EXPECT_EQ( executorWorkers.load(), 3u );
+		}
+
+		//----------------------------------------------
+		// Test_GmodPath_TryParseMany_FullPath
+		//----------------------------------------------
+
+		TEST( GmodPathTest, Test_GmodPath_TryParseMany_FullPath )
+		{
+			VisVersion version = VisVersion::v3_4a;
+			const Gmod& gmod = VIS::instance().gmod( version );
+			const Locations& locations = VIS::instance().locations( version );
+
+			std::vector<std::string> fullPaths;
+			for ( const auto& param : GmodPathTestsParametrized::loadValidGmodPathData() )
+			{
+				if ( param.visVersionString == "3-4a" )
+				{
+					fullPaths.push_back( GmodPath::parse( param.pathString, version ).toFullPathString() );
+				}
+			}
+			ASSERT_FALSE( fullPaths.empty() );
+			fullPaths.push_back( "VE/400a/XXX" );
+			fullPaths.push_back( "" );
+
+			std::vector<std::string_view> items( fullPaths.begin(), fullPaths.end() );
+
+			GmodPathParseOptions options{};
+			options.fullPath = true;
+			options.threadCount = 2;
+			std::vector<GmodPathParseOutcome> outcomes = GmodPath::tryParseMany( items, gmod, locations, options );
+			ASSERT_EQ( outcomes.size(), items.size() );
+
+			for ( size_t i = 0; i + 2 < items.size(); ++i )
+			{
+				ASSERT_TRUE( outcomes[i].path.has_value() ) << outcomes[i].error;
+				EXPECT_EQ( outcomes[i].path->toFullPathString(), items[i] );
+			}
+			EXPECT_EQ( outcomes[items.size() - 2].error, "Failed to get GmodNode for XXX" );
+			EXPECT_FALSE( outcomes.back().path.has_value() );
+			EXPECT_FALSE( outcomes.back().error.empty() );
+
+			EXPECT_THROW( (void)GmodPath::tryParseMany( items, gmod, VIS::instance().locations( VisVersion::v3_5a ) ), std::invalid_argument );
+		}
 	}
 }
@@ -0,0 +1,241 @@
+/**
+ * @file TEST_GmodPathCache.cpp
+ * @brief Unit tests for the GmodPathCache class.
+ */
+
+#include "pch.h"
+
+#include "TestDataLoader.h"
+
+#include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/GmodPath.h"
+#include "dnv/vista/sdk/GmodPathCache.h"
+#include "dnv/vista/sdk/VIS.h"
+
+namespace dnv::vista::sdk::tests
+{
+	namespace
+	{
+		constexpr const char* GMOD_PATH_TEST_DATA_PATH = "testdata/GmodPaths.json";
+
+		std::vector<std::string> loadValidPaths( std::string_view visVersion )
+		{
+			std::vector<std::string> paths;
+			for ( const auto& item : loadTestData( GMOD_PATH_TEST_DATA_PATH )["Valid"] )
+			{
+				if ( item["visVersion"].get<std::string>() == visVersion )
+				{
+					paths.push_back( item["path"].get<std::string>() );
+				}
+			}
+
+			return paths;
+		}
+	}
+
+	//=====================================================================
+	// GmodPathCache
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test_GmodPathCache_Hit
+	//----------------------------------------------
+
+	TEST( GmodPathCacheTest, Test_GmodPathCache_Hit )
+	{
+		GmodPathCache cache;
+
+		std::shared_ptr<const GmodPath> first;
+		std::shared_ptr<const GmodPath> second;
+		std::shared_ptr<const GmodPath> trimmed;
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", VisVersion::v3_4a, first ) );
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", VisVersion::v3_4a, second ) );
+		ASSERT_TRUE( cache.tryParse( " /411.1/C101.72/I101\t", VisVersion::v3_4a, trimmed ) );
+
+		EXPECT_EQ( first, second );
+		EXPECT_EQ( first, trimmed );
+		EXPECT_EQ( *first, GmodPath::parse( "411.1/C101.72/I101", VisVersion::v3_4a ) );
+
+		GmodPathCache::Statistics statistics = cache.statistics();
+		EXPECT_EQ( statistics.hits, 2u );
+		EXPECT_EQ( statistics.misses, 1u );
+		EXPECT_EQ( statistics.evictions, 0u );
+		EXPECT_EQ( statistics.size, 1u );
+
+		/* Same string, other version: another entry */
+		std::shared_ptr<const GmodPath> other;
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", VisVersion::v3_5a, other ) );
+		EXPECT_NE( first, other );
+		EXPECT_EQ( other->visVersion(), VisVersion::v3_5a );
+		EXPECT_EQ( cache.statistics().size, 2u );
+	}
+
+	//----------------------------------------------
+	// Test_GmodPathCache_Invalid
+	//----------------------------------------------
+
+	TEST( GmodPathCacheTest, Test_GmodPathCache_Invalid )
+	{
+		GmodPathCache cache;
+
+		std::shared_ptr<const GmodPath> path = std::make_shared<const GmodPath>();
+		EXPECT_FALSE( cache.tryParse( "411.1/XXX/I101", VisVersion::v3_4a, path ) );
+		EXPECT_EQ( path, nullptr );
+		EXPECT_FALSE( cache.tryParse( "   ", VisVersion::v3_4a, path ) );
+		EXPECT_FALSE( cache.tryParse( "411.1/XXX/I101", VisVersion::v3_4a, path ) );
+
+		GmodPathCache::Statistics statistics = cache.statistics();
+		EXPECT_EQ( statistics.hits, 0u );
+		EXPECT_EQ( statistics.misses, 3u );
+		EXPECT_EQ( statistics.size, 0u );
+
+		EXPECT_THROW( GmodPathCache( 0 ), std::invalid_argument );
+		EXPECT_THROW( GmodPathCache( 16, 0 ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Test_GmodPathCache_Eviction
+	//----------------------------------------------
+
+	TEST( GmodPathCacheTest, Test_GmodPathCache_Eviction )
+	{
+		const std::vector<std::string> paths = loadValidPaths( "3-4a" );
+		ASSERT_GE( paths.size(), 10u );
+
+		GmodPathCache cache( 4, 1 );
+		EXPECT_EQ( cache.capacity(), 4u );
+
+		std::vector<std::shared_ptr<const GmodPath>> parsed( 6 );
+		for ( size_t i = 0; i < 4; ++i )
+		{
+			ASSERT_TRUE( cache.tryParse( paths[i], VisVersion::v3_4a, parsed[i] ) );
+		}
+
+		/* Referencing the first entry lets it survive the next pass of the clock hand */
+		std::shared_ptr<const GmodPath> hit;
+		ASSERT_TRUE( cache.tryParse( paths[0], VisVersion::v3_4a, hit ) );
+		EXPECT_EQ( hit, parsed[0] );
+
+		ASSERT_TRUE( cache.tryParse( paths[4], VisVersion::v3_4a, parsed[4] ) );
+		EXPECT_EQ( cache.statistics().evictions, 1u );
+
+		ASSERT_TRUE( cache.tryParse( paths[0], VisVersion::v3_4a, hit ) );
+		EXPECT_EQ( hit, parsed[0] );
+
+		/* The second entry was evicted; its path object stays valid for the caller */
+		std::shared_ptr<const GmodPath> reparsed;
+		ASSERT_TRUE( cache.tryParse( paths[1], VisVersion::v3_4a, reparsed ) );
+		EXPECT_NE( reparsed, parsed[1] );
+		EXPECT_EQ( *reparsed, *parsed[1] );
+
+		for ( size_t i = 5; i < paths.size(); ++i )
+		{
+			std::shared_ptr<const GmodPath> path;
+			ASSERT_TRUE( cache.tryParse( paths[i], VisVersion::v3_4a, path ) );
+			EXPECT_EQ( path->toString(), paths[i] );
+		}
+
+		GmodPathCache::Statistics statistics = cache.statistics();
+		EXPECT_EQ( statistics.size, 4u );
+		EXPECT_EQ( statistics.evictions, statistics.misses - 4 );
+
+		cache.clear();
+		EXPECT_EQ( cache.statistics().size, 0u );
+		ASSERT_TRUE( cache.tryParse( paths[0], VisVersion::v3_4a, hit ) );
+		EXPECT_EQ( *hit, *parsed[0] );
+	}
+
+	//----------------------------------------------
+	// Test_GmodPathCache_Reused_Gmod_Address
+	//----------------------------------------------
+
+	TEST( GmodPathCacheTest, Test_GmodPathCache_Reused_Gmod_Address )
+	{
+		const auto dto = VIS::loadGmodDto( VisVersion::v3_4a );
+		ASSERT_TRUE( dto.has_value() );
+		const Locations& locations = VIS::instance().locations( VisVersion::v3_4a );
+
+		GmodPathCache cache;
+
+		/* The second Gmod is constructed in the storage of the destroyed first one */
+		std::optional<Gmod> storage;
+		storage.emplace( VisVersion::v3_4a, *dto );
+		const Gmod* address = &*storage;
+		const uint64_t firstId = storage->instanceId();
+
+		std::shared_ptr<const GmodPath> first;
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", *storage, locations, first ) );
+		EXPECT_EQ( first->gmod(), address );
+
+		first.reset();
+		storage.reset();
+		storage.emplace( VisVersion::v3_4a, *dto );
+		ASSERT_EQ( &*storage, address );
+		EXPECT_NE( storage->instanceId(), firstId );
+
+		std::shared_ptr<const GmodPath> second;
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", *storage, locations, second ) );
+		EXPECT_EQ( cache.statistics().hits, 0u );
+		EXPECT_EQ( cache.statistics().misses, 2u );
+		EXPECT_EQ( second->node(), &( *storage )["I101"] );
+
+		/* Copies are other objects, so they do not share entries either */
+		const Gmod copy = *storage;
+		EXPECT_NE( copy.instanceId(), storage->instanceId() );
+		std::shared_ptr<const GmodPath> copied;
+		ASSERT_TRUE( cache.tryParse( "411.1/C101.72/I101", copy, locations, copied ) );
+		EXPECT_EQ( cache.statistics().hits, 0u );
+	}
+
+	//----------------------------------------------
+	// Test_GmodPathCache_Concurrent
+	//----------------------------------------------
+
+	TEST( GmodPathCacheTest, Test_GmodPathCache_Concurrent )
+	{
+		const std::vector<std::string> paths = loadValidPaths( "3-4a" );
+		const Gmod& gmod = VIS::instance().gmod( VisVersion::v3_4a );
+
+		std::vector<GmodPath> expected;
+		for ( const std::string& path : paths )
+		{
+			expected.push_back( GmodPath::parse( path, VisVersion::v3_4a ) );
+		}
+
+		/* Smaller than the working set, so lookups race with evictions */
+		GmodPathCache cache( paths.size() / 2, 4 );
+		constexpr size_t threadCount = 8;
+		constexpr size_t rounds = 20;
+
+		std::vector<std::future<size_t>> futures;
+		for ( size_t t = 0; t < threadCount; ++t )
+		{
+			futures.push_back( std::async( std::launch::async, [&, t]() {
+				size_t mismatches = 0;
+				for ( size_t round = 0; round < rounds; ++round )
+				{
+					for ( size_t i = 0; i < paths.size(); ++i )
+					{
+						const size_t index = ( i * ( t + 1 ) + round ) % paths.size();
+						std::shared_ptr<const GmodPath> path;
+						if ( !cache.tryParse( paths[index], gmod, path ) || *path != expected[index] )
+						{
+							++mismatches;
+						}
+					}
+				}
+
+				return mismatches;
+			} ) );
+		}
+
+		for ( auto& future : futures )
+		{
+			EXPECT_EQ( future.get(), 0u );
+		}
+
+		GmodPathCache::Statistics statistics = cache.statistics();
+		EXPECT_EQ( statistics.hits + statistics.misses, threadCount * rounds * paths.size() );
+		EXPECT_LE( statistics.size, cache.capacity() );
+	}
+}
@@ -0,0 +1,237 @@
+/**
+ * @file TEST_GmodSnapshot.cpp
+ * @brief Unit tests for the binary GMOD snapshot format
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/EmbeddedResource.h"
+#include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/GmodSnapshot.h"
+#include "dnv/vista/sdk/VIS.h"
+
+namespace dnv::vista::sdk::tests
+{
+	class GmodSnapshotTests : public ::testing::TestWithParam<VisVersion>
+	{
+	protected:
+		void SetUp() override
+		{
+			/* One file per test: ctest runs the tests of a suite concurrently */
+			const std::string_view testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+			m_path = std::filesystem::temp_directory_path() /
+					 ( fmt::format( "vista-sdk-test-{}-", testName.substr( 0, testName.find( '/' ) ) ) +
+						 GmodSnapshot::fileName( GetParam() ) );
+		}
+
+		void TearDown() override
+		{
+			std::error_code ec;
+			std::filesystem::remove( m_path, ec );
+		}
+
+		std::filesystem::path m_path;
+	};
+
+	//=====================================================================
+	// Helper Functions
+	//=====================================================================
+
+	static std::vector<std::string> codes( const std::vector<GmodNode*>& nodes )
+	{
+		std::vector<std::string> result;
+		result.reserve( nodes.size() );
+		for ( const auto* node : nodes )
+		{
+			result.push_back( node->code() );
+		}
+
+		return result;
+	}
+
+	//=====================================================================
+	// Tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Test_GmodSnapshot_RoundTrip
+	//----------------------------------------------
+
+	TEST_P( GmodSnapshotTests, Test_GmodSnapshot_RoundTrip )
+	{
+		const auto visVersion = GetParam();
+		const auto& gmod = VIS::instance().gmod( visVersion );
+
+		GmodSnapshot::write( gmod, m_path );
+		const GmodSnapshot snapshot = GmodSnapshot::open( m_path );
+
+		EXPECT_EQ( snapshot.visVersion(), visVersion );
+
+		const Gmod restored{ snapshot };
+		EXPECT_EQ( restored.visVersion(), visVersion );
+		EXPECT_EQ( restored.rootNode().code(), "VE" );
+
+		size_t count = 0;
+		Gmod::Enumerator enumerator = gmod.enumerator();
+		while ( enumerator.next() )
+		{
+			const GmodNode& expected = enumerator.current();
+			++count;
+
+			const GmodNode* actual = nullptr;
+			ASSERT_TRUE( restored.tryGetNode( expected.code(), actual ) ) << expected.code();
+			ASSERT_NE( actual, nullptr );
+
+			EXPECT_EQ( actual->code(), expected.code() );
+			EXPECT_EQ( actual->visVersion(), expected.visVersion() );
+			EXPECT_EQ( actual->metadata(), expected.metadata() );
+			EXPECT_EQ( codes( actual->children() ), codes( expected.children() ) ) << expected.code();
+			EXPECT_EQ( codes( actual->parents() ), codes( expected.parents() ) ) << expected.code();
+
+			uint32_t index = internal::GMOD_SNAPSHOT_NPOS;
+			ASSERT_TRUE( snapshot.tryFindNode( expected.code(), index ) ) << expected.code();
+			EXPECT_EQ( snapshot.string( snapshot.nodes()[index].code ), expected.code() );
+		}
+
+		EXPECT_EQ( snapshot.nodeCount(), count );
+
+		uint32_t index = 0;
+		EXPECT_FALSE( snapshot.tryFindNode( "NOT-A-NODE", index ) );
+		EXPECT_EQ( index, internal::GMOD_SNAPSHOT_NPOS );
+		EXPECT_FALSE( snapshot.tryFindNode( "", index ) );
+	}
+
+	//----------------------------------------------
+	// Test_GmodSnapshot_RejectsCorruptFile
+	//----------------------------------------------
+
+	TEST_P( GmodSnapshotTests, Test_GmodSnapshot_RejectsCorruptFile )
+	{
+		const auto& gmod = VIS::instance().gmod( GetParam() );
+		GmodSnapshot::write( gmod, m_path );
+
+		const auto size = std::filesystem::file_size( m_path );
+
+		{
+			std::fstream file( m_path, std::ios::in | std::ios::out | std::ios::binary );
+			file.seekp( static_cast<std::streamoff>( size / 2 ) );
+			char byte = 0;
+			file.read( &byte, 1 );
+			byte = static_cast<char>( byte ^ 0x5A );
+			file.seekp( static_cast<std::streamoff>( size / 2 ) );
+			file.write( &byte, 1 );
+		}
+
+		std::optional<GmodSnapshot> snapshot;
+		EXPECT_FALSE( GmodSnapshot::tryOpen( m_path, snapshot, GmodSnapshotValidation::Full ) );
+		EXPECT_FALSE( snapshot.has_value() );
+		EXPECT_THROW( (void)GmodSnapshot::open( m_path, GmodSnapshotValidation::Full ), std::runtime_error );
+
+		GmodSnapshot::write( gmod, m_path );
+		std::filesystem::resize_file( m_path, size - 8 );
+		EXPECT_FALSE( GmodSnapshot::tryOpen( m_path, snapshot ) );
+
+		EXPECT_FALSE( GmodSnapshot::tryOpen( m_path.string() + ".missing", snapshot ) );
+	}
+
+	//----------------------------------------------
+	// Test_GmodSnapshot_ChecksumCheckedByDefault
+	//----------------------------------------------
+
+	TEST_P( GmodSnapshotTests, Test_GmodSnapshot_ChecksumCheckedByDefault )
+	{
+		GmodSnapshot::write( VIS::instance().gmod( GetParam() ), m_path );
+
+		internal::GmodSnapshotHeader header{};
+		{
+			std::ifstream file( m_path, std::ios::binary );
+			file.read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+		}
+
+		/* A changed string character keeps every reference in bounds; only the checksum sees it */
+		{
+			const auto offset = static_cast<std::streamoff>( header.stringsOffset + header.stringsSize / 2 );
+			std::fstream file( m_path, std::ios::in | std::ios::out | std::ios::binary );
+			file.seekg( offset );
+			char byte = 0;
+			file.read( &byte, 1 );
+			byte = static_cast<char>( byte ^ 0x01 );
+			file.seekp( offset );
+			file.write( &byte, 1 );
+		}
+
+		std::optional<GmodSnapshot> snapshot;
+		EXPECT_FALSE( GmodSnapshot::tryOpen( m_path, snapshot ) );
+		EXPECT_FALSE( GmodSnapshot::tryOpen( m_path, snapshot, GmodSnapshotValidation::Full ) );
+		EXPECT_TRUE( GmodSnapshot::tryOpen( m_path, snapshot, GmodSnapshotValidation::Structure ) );
+	}
+
+	//----------------------------------------------
+	// Test_GmodSnapshot_SourceChecksum
+	//----------------------------------------------
+
+	TEST_P( GmodSnapshotTests, Test_GmodSnapshot_SourceChecksum )
+	{
+		const auto& gmod = VIS::instance().gmod( GetParam() );
+
+		GmodSnapshot::write( gmod, m_path );
+		EXPECT_EQ( GmodSnapshot::open( m_path ).sourceChecksum(), 0u );
+
+		GmodSnapshot::write( gmod, m_path, 0x1234ABCDu );
+		EXPECT_EQ( GmodSnapshot::open( m_path ).sourceChecksum(), 0x1234ABCDu );
+
+		const auto source = EmbeddedResource::resourcePath( GmodSnapshot::sourceFileName( GetParam() ) );
+		ASSERT_TRUE( source.has_value() );
+
+		const uint32_t sourceChecksum = GmodSnapshot::fileChecksum( *source );
+		EXPECT_EQ( GmodSnapshot::fileChecksum( *source ), sourceChecksum );
+		EXPECT_NE( GmodSnapshot::fileChecksum( m_path ), sourceChecksum );
+
+		EXPECT_THROW( (void)GmodSnapshot::fileChecksum( m_path.string() + ".missing" ), std::runtime_error );
+	}
+
+	//----------------------------------------------
+	// Test_GmodSnapshot_GeneratedResource
+	//----------------------------------------------
+
+	TEST_P( GmodSnapshotTests, Test_GmodSnapshot_GeneratedResource )
+	{
+		const auto path = EmbeddedResource::resourcePath( GmodSnapshot::fileName( GetParam() ) );
+		if ( !path.has_value() )
+		{
+			GTEST_SKIP() << "No generated snapshot; the GmodSnapshotBuilder tool is built with VISTA_SDK_CPP_BUILD_TOOLS";
+		}
+
+		const GmodSnapshot snapshot = GmodSnapshot::open( *path, GmodSnapshotValidation::Full );
+		EXPECT_EQ( snapshot.visVersion(), GetParam() );
+
+		/* Generated at build time from the resources next to it, so it is never stale */
+		const auto source = EmbeddedResource::resourcePath( GmodSnapshot::sourceFileName( GetParam() ) );
+		ASSERT_TRUE( source.has_value() );
+		EXPECT_EQ( snapshot.sourceChecksum(), GmodSnapshot::fileChecksum( *source ) );
+
+		const Gmod& gmod = VIS::instance().gmod( GetParam() );
+		size_t count = 0;
+		Gmod::Enumerator enumerator = gmod.enumerator();
+		while ( enumerator.next() )
+		{
+			++count;
+		}
+
+		EXPECT_EQ( snapshot.nodeCount(), count );
+	}
+
+	//=====================================================================
+	// Instantiate
+	//=====================================================================
+
+	INSTANTIATE_TEST_SUITE_P(
+		GmodSnapshotTestSuite,
+		GmodSnapshotTests,
+		::testing::Values(
+			VisVersion::v3_4a,
+			VisVersion::v3_5a,
+			VisVersion::v3_6a,
+			VisVersion::v3_7a,
+			VisVersion::v3_8a ) );
+}
@@ -315,6 +315,122 @@ namespace dnv::vista::sdk::tests
 		PathConversionTest,
 		::testing::ValuesIn( validPathTestData() ) );
 
+	//----------------------------------------------
+	// Test_GmodVersioning_ConvertPath_Owns_Located_Nodes
+	//----------------------------------------------
+
+	TEST( GmodVersioningPathTest, Test_GmodVersioning_ConvertPath_Owns_Located_Nodes )
+	{
+		auto& vis = VIS::instance();
+		const Gmod& targetGmod = vis.gmod( VisVersion::v3_6a );
+		GmodPath source = vis.gmod( VisVersion::v3_4a ).parsePath( "511.11-1/C101.663i/C663.5/CS6d" );
+
+		std::optional<GmodPath> first = vis.convertPath( VisVersion::v3_4a, source, VisVersion::v3_6a );
+		std::optional<GmodPath> second = vis.convertPath( VisVersion::v3_4a, source, VisVersion::v3_6a );
+		ASSERT_TRUE( first.has_value() );
+		ASSERT_TRUE( second.has_value() );
+		ASSERT_EQ( first->length(), second->length() );
+		EXPECT_EQ( *first, *second );
+
+		/* Located nodes belong to each converted path and stay valid without the other conversions */
+		second.reset();
+
+		bool hasLocatedNode = false;
+		for ( size_t i = 0; i < first->length(); ++i )
+		{
+			const GmodNode* node = ( *first )[i];
+			EXPECT_EQ( &first->locatedNodes()[i].node(), &targetGmod[node->code()] ) << i;
+			if ( !node->location().has_value() )
+			{
+				EXPECT_EQ( node, &targetGmod[node->code()] ) << i;
+				continue;
+			}
+
+			hasLocatedNode = true;
+			EXPECT_NE( node, &targetGmod[node->code()] ) << i;
+			EXPECT_EQ( node->graphIndex(), targetGmod[node->code()].graphIndex() ) << i;
+			EXPECT_EQ( node->location()->toString(), "1" ) << i;
+		}
+		EXPECT_TRUE( hasLocatedNode );
+	}
+
+	//----------------------------------------------
+	// Test_GmodVersioning_ConvertPath_Concurrent
+	//----------------------------------------------
+
+	TEST( GmodVersioningPathTest, Test_GmodVersioning_ConvertPath_Concurrent )
+	{
+		auto& vis = VIS::instance();
+		const std::vector<PathTestData> cases = validPathTestData();
+
+		std::vector<GmodPath> sources;
+		for ( const auto& testData : cases )
+		{
+			sources.push_back( vis.gmod( testData.sourceVersion ).parsePath( testData.inputPath ) );
+		}
+
+		constexpr size_t threadCount = 8;
+		constexpr size_t rounds = 4;
+
+		std::vector<std::future<std::vector<std::string>>> futures;
+		for ( size_t t = 0; t < threadCount; ++t )
+		{
+			futures.push_back( std::async( std::launch::async, [&, t]() {
+				std::vector<std::string> failures;
+				for ( size_t round = 0; round < rounds; ++round )
+				{
+					for ( size_t i = 0; i < cases.size(); ++i )
+					{
+						const size_t index = ( i + t ) % cases.size();
+						const PathTestData& testData = cases[index];
+
+						std::optional<GmodPath> target = vis.convertPath( testData.sourceVersion, sources[index], testData.targetVersion );
+						if ( !target.has_value() || target->toString() != testData.expectedPath )
+						{
+							failures.push_back( testData.inputPath );
+						}
+					}
+				}
+
+				return failures;
+			} ) );
+		}
+
+		for ( auto& future : futures )
+		{
+			std::vector<std::string> failures = future.get();
+			EXPECT_TRUE( failures.empty() ) << "First failure: " << ( failures.empty() ? "" : failures.front() );
+		}
+	}
+
+	//----------------------------------------------
+	// Test_GmodVersioning_ConvertPath_Repeated
+	//----------------------------------------------
+
+	TEST( GmodVersioningPathTest, Test_GmodVersioning_ConvertPath_Repeated )
+	{
+		auto& vis = VIS::instance();
+
+		/* Later rounds are served by the conversion plan and its path templates */
+		for ( size_t round = 0; round < 3; ++round )
+		{
+			for ( const auto& testData : validPathTestData() )
+			{
+				GmodPath source = vis.gmod( testData.sourceVersion ).parsePath( testData.inputPath );
+
+				std::optional<GmodPath> target = vis.convertPath( testData.sourceVersion, source, testData.targetVersion );
+				ASSERT_TRUE( target.has_value() ) << testData.inputPath;
+				EXPECT_EQ( testData.expectedPath, target->toString() ) << testData.inputPath << " round " << round;
+
+				/* A template reconstructed without locations must not be reused for a located path */
+				GmodPath withoutLocations = source.withoutLocations();
+				std::optional<GmodPath> targetWithoutLocations = vis.convertPath( testData.sourceVersion, withoutLocations, testData.targetVersion );
+				ASSERT_TRUE( targetWithoutLocations.has_value() ) << testData.inputPath;
+				EXPECT_EQ( targetWithoutLocations->toString(), target->withoutLocations().toString() ) << testData.inputPath;
+			}
+		}
+	}
+
 	//----------------------------------------------
 	// Test_GmodVersioning_ConvertFullPath
 	//----------------------------------------------
@@ -459,4 +575,46 @@ namespace dnv::vista::sdk::tests
 		ValidNodeTests,
 		NodeConversionTest,
 		::testing::ValuesIn( validNodeTestData() ) );
+
+	//----------------------------------------------
+	// Test_GmodVersioning_ConvertNode_Across_Versions
+	//----------------------------------------------
+
+	TEST( GmodVersioningNodeTest, Test_GmodVersioning_ConvertNode_Across_Versions )
+	{
+		auto& vis = VIS::instance();
+		EXPECT_EQ( &vis.gmodVersioning(), &vis.gmodVersioning() );
+
+		const Gmod& sourceGmod = vis.gmod( VisVersion::v3_4a );
+		const Location location = vis.locations( VisVersion::v3_4a ).parse( "1" );
+
+		/* Converting straight to the last version must match converting one version at a time */
+		size_t converted = 0;
+		auto enumerator = sourceGmod.enumerator();
+		while ( enumerator.next() )
+		{
+			const GmodNode& node = enumerator.current();
+			const GmodNode sourceNode = node.isIndividualizable( false, false ) ? node.withLocation( location ) : node;
+
+			std::optional<GmodNode> stepwise = sourceNode;
+			for ( VisVersion version = VisVersion::v3_4a; stepwise.has_value() && version < VisVersion::v3_8a; )
+			{
+				const VisVersion next = static_cast<VisVersion>( static_cast<int>( version ) + 100 );
+				stepwise = vis.convertNode( version, *stepwise, next );
+				version = next;
+			}
+
+			std::optional<GmodNode> direct = vis.convertNode( VisVersion::v3_4a, sourceNode, VisVersion::v3_8a );
+			ASSERT_EQ( direct.has_value(), stepwise.has_value() ) << sourceNode.toString();
+			if ( direct.has_value() )
+			{
+				EXPECT_EQ( *direct, *stepwise ) << sourceNode.toString();
+				EXPECT_EQ( direct->visVersion(), VisVersion::v3_8a );
+				EXPECT_EQ( direct->location(), sourceNode.location() );
+				++converted;
+			}
+		}
+
+		EXPECT_GT( converted, 0u );
+	}
 }
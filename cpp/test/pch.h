@@ -1,10 +1,17 @@
 #pragma once
 
 /* STL */
+#include <atomic>
+#include <deque>
+#include <filesystem>
 #include <fstream>
 #include <future>
+#include <list>
 #include <queue>
+#include <ranges>
 #include <shared_mutex>
+#include <span>
+#include <thread>
 #include <unordered_set>
 
 /* Libs */
@@ -0,0 +1,68 @@
+/**
+ * @file ChdSeedBuilder.cpp
+ * @brief Offline generator for the CHD seed tables of the embedded resources
+ * @details Runs the ChdDictionary seed search once per GMOD resource and writes the resulting
+ *          seed table next to the resource (see `ChdSeedTable`), so that `VIS::gmod()` can lay
+ *          out the node dictionary without searching seeds at startup.
+ *
+ *          Usage: ChdSeedBuilder [output-directory]
+ *          Resources are located like at runtime (./resources, ../resources, ...); the output
+ *          directory defaults to "resources".
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/ChdDictionary.h"
+#include "dnv/vista/sdk/ChdSeedTable.h"
+#include "dnv/vista/sdk/GmodDto.h"
+#include "dnv/vista/sdk/VIS.h"
+#include "dnv/vista/sdk/VISVersion.h"
+
+using namespace dnv::vista::sdk;
+
+int main( int argc, char* argv[] )
+{
+	const std::filesystem::path outputDir{ argc > 1 ? argv[1] : "resources" };
+
+	try
+	{
+		std::filesystem::create_directories( outputDir );
+
+		for ( const auto visVersion : VisVersionExtensions::allVersions() )
+		{
+			const auto versionString = VisVersionExtensions::toVersionString( visVersion );
+
+			auto dto = VIS::loadGmodDto( visVersion );
+			if ( !dto )
+			{
+				std::cerr << "Skipping VIS " << versionString << ": GMOD resource not found\n";
+				continue;
+			}
+
+			/* Seeds depend on the keys only; the values are placeholders */
+			std::vector<std::pair<std::string, int>> items;
+			items.reserve( dto->items().size() );
+			for ( const auto& node : dto->items() )
+			{
+				items.emplace_back( node.code(), 0 );
+			}
+
+			const size_t itemCount{ items.size() };
+			const ChdDictionary<int> dictionary{ std::move( items ) };
+
+			const auto path = outputDir / ChdSeedTable::fileName( "gmod-" + versionString );
+			ChdSeedTable::write( path, dictionary.seeds(), itemCount );
+
+			std::cout << "Wrote " << path.string() << " (" << itemCount << " keys, "
+					  << dictionary.seeds().size() << " seeds)\n";
+		}
+	}
+	catch ( const std::exception& ex )
+	{
+		std::cerr << "CHD seed generation failed: " << ex.what() << '\n';
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
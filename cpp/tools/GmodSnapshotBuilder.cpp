@@ -0,0 +1,69 @@
+/**
+ * @file GmodSnapshotBuilder.cpp
+ * @brief Offline generator for the binary GMOD caches of the embedded resources
+ * @details Builds the Gmod of each GMOD resource once and writes it as a snapshot next to the
+ *          resource (see `GmodSnapshot`), so that `VIS::gmod()` loads the snapshot instead of
+ *          inflating and parsing the JSON resource at startup. Each snapshot records the checksum
+ *          of its resource; `VIS::gmod()` ignores it once the resource has changed.
+ *
+ *          Usage: GmodSnapshotBuilder [output-directory]
+ *          Resources are located like at runtime (./resources, ../resources, ...); the output
+ *          directory defaults to "resources".
+ */
+
+#include "pch.h"
+
+#include "dnv/vista/sdk/EmbeddedResource.h"
+#include "dnv/vista/sdk/Gmod.h"
+#include "dnv/vista/sdk/GmodDto.h"
+#include "dnv/vista/sdk/GmodSnapshot.h"
+#include "dnv/vista/sdk/VIS.h"
+#include "dnv/vista/sdk/VISVersion.h"
+
+using namespace dnv::vista::sdk;
+
+int main( int argc, char* argv[] )
+{
+	const std::filesystem::path outputDir{ argc > 1 ? argv[1] : "resources" };
+
+	try
+	{
+		std::filesystem::create_directories( outputDir );
+
+		for ( const auto visVersion : VisVersionExtensions::allVersions() )
+		{
+			const auto versionString = VisVersionExtensions::toVersionString( visVersion );
+
+			auto dto = VIS::loadGmodDto( visVersion );
+			if ( !dto )
+			{
+				std::cerr << "Skipping VIS " << versionString << ": GMOD resource not found\n";
+				continue;
+			}
+
+			/* Built from the JSON resource, never from an existing snapshot */
+			const Gmod gmod{ visVersion, *dto };
+
+			const auto source = EmbeddedResource::resourcePath( GmodSnapshot::sourceFileName( visVersion ) );
+			if ( !source )
+			{
+				std::cerr << "Skipping VIS " << versionString << ": GMOD resource file not found\n";
+				continue;
+			}
+
+			const auto path = outputDir / GmodSnapshot::fileName( visVersion );
+			GmodSnapshot::write( gmod, path, GmodSnapshot::fileChecksum( *source ) );
+
+			std::cout << "Wrote " << path.string() << " (" << dto->items().size() << " nodes, "
+					  << std::filesystem::file_size( path ) << " bytes)\n";
+		}
+	}
+	catch ( const std::exception& ex )
+	{
+		std::cerr << "GMOD snapshot generation failed: " << ex.what() << '\n';
+
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <immintrin.h>
+
+/* STL */
+#include <array>
+#include <atomic>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+#include <unordered_set>
+
+/* Libs */
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+#if defined( _MSC_VER )
+#	include <libcpuid.h>
+#elif defined( __GNUC__ )
+#	include <cpuid.h>
+#endif